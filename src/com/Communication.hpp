@@ -144,6 +144,17 @@ public:
    */
   virtual void closeConnection() = 0;
 
+  /**
+   * @brief Hints that a sequence of small blocking sends follows, which may be coalesced.
+   *
+   * The sends may be delayed until flush() is called, but are in any case written before
+   * the next receive. Communication classes without batching ignore the call.
+   */
+  virtual void startBatch() {}
+
+  /// Writes all sends delayed since startBatch().
+  virtual void flush() {}
+
   /// Performs a reduce summation on the rank given by rankMaster
   virtual void reduceSum(double *itemsToSend, double *itemsToReceive, int size, int rankMaster);
 
@@ -0,0 +1,917 @@
+#include "SharedMemoryCommunication.hpp"
+
+#include "SharedMemoryRequest.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include "utils/Publisher.hpp"
+#include "utils/assertion.hpp"
+
+using precice::utils::Publisher;
+using precice::utils::ScopedPublisher;
+
+namespace precice
+{
+namespace com
+{
+
+const size_t SharedMemoryCommunication::DEFAULT_BUFFER_SIZE;
+
+namespace
+{
+
+static_assert(ATOMIC_INT_LOCK_FREE == 2 && ATOMIC_LLONG_LOCK_FREE == 2,
+              "Shared memory communication requires lock-free atomics.");
+
+/// Number of polls of a ring buffer before a blocked process goes to sleep.
+const int SPIN_COUNT = 4096;
+
+/// Time a closing connection waits for its pending sends to be read by the other side.
+const std::chrono::seconds CLOSE_TIMEOUT(10);
+
+/// States of the lobby and connection segments during connection setup.
+enum SegmentState : int {
+  SEGMENT_CREATED   = 0,
+  SEGMENT_READY     = 1,
+  SEGMENT_ACCEPTED  = 2
+};
+
+/// Control block of the lobby segment created by the acceptor.
+struct alignas(64) LobbyHeader {
+  std::atomic<int> state;
+  std::atomic<int> nextSlot;
+  int              acceptorRank;
+  pid_t            acceptorPID;
+  uint64_t         capacity;
+};
+
+/// Control block of a connection segment created by the requester, followed by two rings.
+struct alignas(64) ConnectionHeader {
+  std::atomic<int> state;
+  int              requesterRank;
+  int              requesterCommunicatorSize;
+};
+
+/// Control block of a single-producer single-consumer ring buffer, followed by the data.
+struct alignas(64) RingHeader {
+  /// Total number of bytes written.
+  std::atomic<uint64_t> head;
+  /// Total number of bytes read.
+  std::atomic<uint64_t> tail;
+  /// Futex word, incremented after every write.
+  std::atomic<int32_t> written;
+  /// Futex word, incremented after every read.
+  std::atomic<int32_t> read;
+  /// Number of processes sleeping on one of the futex words.
+  std::atomic<int32_t> sleepers;
+  /// Set by the first side closing the connection, aborts all blocked operations on the ring.
+  std::atomic<int32_t> closed;
+  uint64_t             capacity;
+};
+
+size_t connectionSegmentSize(uint64_t capacity)
+{
+  return sizeof(ConnectionHeader) + 2 * (sizeof(RingHeader) + capacity);
+}
+
+RingHeader *getRing(void *segment, uint64_t capacity, int index)
+{
+  char *rings = static_cast<char *>(segment) + sizeof(ConnectionHeader);
+  return reinterpret_cast<RingHeader *>(rings + index * (sizeof(RingHeader) + capacity));
+}
+
+void initializeRing(RingHeader *ring, uint64_t capacity)
+{
+  ring->head.store(0);
+  ring->tail.store(0);
+  ring->written.store(0);
+  ring->read.store(0);
+  ring->sleepers.store(0);
+  ring->closed.store(0);
+  ring->capacity = capacity;
+}
+
+void futexWait(std::atomic<int32_t> &word, int32_t expected)
+{
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<int32_t *>(&word), FUTEX_WAIT, expected, nullptr, nullptr, 0);
+#else
+  if (word.load() == expected) {
+    std::this_thread::yield();
+  }
+#endif
+}
+
+void futexWakeAll(std::atomic<int32_t> &word)
+{
+#ifdef __linux__
+  syscall(SYS_futex, reinterpret_cast<int32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+#endif
+}
+
+/**
+ * @brief Blocks until condition is true, first by spinning, then by sleeping on the futex word.
+ *
+ * Returns false, if the ring has been closed before the condition became true.
+ */
+template <typename Condition>
+bool waitFor(RingHeader &ring, std::atomic<int32_t> &word, Condition condition)
+{
+  for (int spin = 0; spin < SPIN_COUNT; ++spin) {
+    if (condition()) {
+      return true;
+    }
+  }
+  while (true) {
+    ring.sleepers.fetch_add(1);
+    int32_t observed = word.load();
+    if (condition()) {
+      ring.sleepers.fetch_sub(1);
+      return true;
+    }
+    if (ring.closed.load() != 0) {
+      ring.sleepers.fetch_sub(1);
+      return false;
+    }
+    futexWait(word, observed);
+    ring.sleepers.fetch_sub(1);
+  }
+}
+
+/// Announces progress on the futex word and wakes the other side if it sleeps.
+void notify(RingHeader &ring, std::atomic<int32_t> &word)
+{
+  word.fetch_add(1);
+  if (ring.sleepers.load() > 0) {
+    futexWakeAll(word);
+  }
+}
+
+char *ringData(RingHeader &ring)
+{
+  return reinterpret_cast<char *>(&ring + 1);
+}
+
+/// Closes the ring and wakes all processes sleeping on it.
+void closeRing(RingHeader &ring)
+{
+  ring.closed.store(1);
+  ring.written.fetch_add(1);
+  ring.read.fetch_add(1);
+  futexWakeAll(ring.written);
+  futexWakeAll(ring.read);
+}
+
+/// Copies the bytes into the ring, blocks while the ring is full. Returns false, if the ring has been closed.
+bool writeRing(RingHeader &ring, const char *data, size_t size)
+{
+  const uint64_t capacity = ring.capacity;
+  while (size > 0) {
+    const uint64_t head = ring.head.load(std::memory_order_relaxed);
+    if (not waitFor(ring, ring.read, [&] { return head - ring.tail.load(std::memory_order_acquire) < capacity; })) {
+      return false;
+    }
+    const uint64_t freeBytes = capacity - (head - ring.tail.load(std::memory_order_acquire));
+    const size_t   chunk     = std::min<uint64_t>(size, freeBytes);
+    const size_t   offset    = head % capacity;
+    const size_t   first     = std::min<uint64_t>(chunk, capacity - offset);
+    std::memcpy(ringData(ring) + offset, data, first);
+    std::memcpy(ringData(ring), data + first, chunk - first);
+    ring.head.store(head + chunk, std::memory_order_release);
+    notify(ring, ring.written);
+    data += chunk;
+    size -= chunk;
+  }
+  return true;
+}
+
+/// Copies bytes out of the ring, blocks while the ring is empty. Returns false, if the ring has been closed.
+bool readRing(RingHeader &ring, char *data, size_t size)
+{
+  const uint64_t capacity = ring.capacity;
+  while (size > 0) {
+    const uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    if (not waitFor(ring, ring.written, [&] { return ring.head.load(std::memory_order_acquire) > tail; })) {
+      return false;
+    }
+    const uint64_t available = ring.head.load(std::memory_order_acquire) - tail;
+    const size_t   chunk     = std::min<uint64_t>(size, available);
+    const size_t   offset    = tail % capacity;
+    const size_t   first     = std::min<uint64_t>(chunk, capacity - offset);
+    std::memcpy(data, ringData(ring) + offset, first);
+    std::memcpy(data + first, ringData(ring), chunk - first);
+    ring.tail.store(tail + chunk, std::memory_order_release);
+    notify(ring, ring.read);
+    data += chunk;
+    size -= chunk;
+  }
+  return true;
+}
+
+/// Returns true, if size bytes can be written without blocking.
+bool ringHasSpace(RingHeader &ring, size_t size)
+{
+  return ring.head.load(std::memory_order_relaxed) - ring.tail.load(std::memory_order_acquire) + size <= ring.capacity;
+}
+
+/// Returns true, if size bytes can be read without blocking.
+bool ringHasData(RingHeader &ring, size_t size)
+{
+  return ring.head.load(std::memory_order_acquire) - ring.tail.load(std::memory_order_relaxed) >= size;
+}
+
+/// Returns a process-wide unique name for a lobby segment.
+std::string uniqueLobbyName()
+{
+  static std::atomic<int> counter(0);
+  return "/precice-" + std::to_string(getpid()) + "-" + std::to_string(counter++);
+}
+
+/// Returns true, if the process with the given id is still running on this node.
+bool isProcessAlive(pid_t pid)
+{
+  return kill(pid, 0) == 0 || errno == EPERM;
+}
+
+/// Polls until the predicate is true, used during connection setup only.
+template <typename Predicate>
+void pollUntil(Predicate predicate)
+{
+  while (not predicate()) {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+}
+
+} // namespace
+
+class SharedMemoryCommunication::Worker
+{
+public:
+  Worker()
+      : _thread([this] { run(); })
+  {
+  }
+
+  ~Worker()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _wakeUp.notify_one();
+    _thread.join();
+  }
+
+  /// Enqueues the operation, the returned request is completed after the operation.
+  PtrRequest post(std::function<void()> operation)
+  {
+    auto request = std::make_shared<SharedMemoryRequest>();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _operations.emplace_back(std::move(operation), request);
+    }
+    _wakeUp.notify_one();
+    return request;
+  }
+
+  bool isIdle()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _operations.empty() && not _busy;
+  }
+
+  /// Blocks until all enqueued operations are completed.
+  void drain()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _idle.wait(lock, [this] { return _operations.empty() && not _busy; });
+  }
+
+  /// Blocks until all enqueued operations are completed or the timeout expired, returns true if completed.
+  bool drain(std::chrono::seconds timeout)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _idle.wait_for(lock, timeout, [this] { return _operations.empty() && not _busy; });
+  }
+
+private:
+  void run()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+      _wakeUp.wait(lock, [this] { return _stop || not _operations.empty(); });
+      if (_operations.empty()) {
+        return;
+      }
+      auto operation = std::move(_operations.front());
+      _operations.pop_front();
+      _busy = true;
+      lock.unlock();
+      operation.first();
+      operation.second->complete();
+      lock.lock();
+      _busy = false;
+      if (_operations.empty()) {
+        _idle.notify_all();
+      }
+    }
+  }
+
+  std::mutex                                                                   _mutex;
+  std::condition_variable                                                      _wakeUp;
+  std::condition_variable                                                      _idle;
+  std::deque<std::pair<std::function<void()>, std::shared_ptr<SharedMemoryRequest>>> _operations;
+  bool                                                                         _busy = false;
+  bool                                                                         _stop = false;
+  std::thread                                                                  _thread;
+};
+
+struct SharedMemoryCommunication::Connection {
+  Connection(void *segment, size_t size, bool isAcceptor)
+      : segment(segment),
+        size(size)
+  {
+    // The offset of the first ring does not depend on the capacity
+    uint64_t capacity = getRing(segment, 0, 0)->capacity;
+    // Ring 0 transfers from requester to acceptor, ring 1 the other way round
+    in  = getRing(segment, capacity, isAcceptor ? 0 : 1);
+    out = getRing(segment, capacity, isAcceptor ? 1 : 0);
+  }
+
+  ~Connection()
+  {
+    logging::Logger _log("com::SharedMemoryCommunication");
+    // Pending sends are delivered, unless the other side closes without reading them or has died
+    if (sendWorker && not sendWorker->drain(CLOSE_TIMEOUT)) {
+      WARN("Pending sends of a shared memory connection were not read within "
+           << CLOSE_TIMEOUT.count() << " seconds and are dropped.");
+    }
+    // Pending receives cannot be consumed anymore. Closing aborts them, here and on the other side.
+    closeRing(*in);
+    closeRing(*out);
+    sendWorker.reset();
+    receiveWorker.reset();
+    munmap(segment, size);
+  }
+
+  ConnectionHeader &header()
+  {
+    return *static_cast<ConnectionHeader *>(segment);
+  }
+
+  void *      segment;
+  size_t      size;
+  RingHeader *in;
+  RingHeader *out;
+
+  /// Started on the first asynchronous send which cannot be completed immediately.
+  std::unique_ptr<Worker> sendWorker;
+
+  /// Started on the first asynchronous receive which cannot be completed immediately.
+  std::unique_ptr<Worker> receiveWorker;
+};
+
+
+namespace
+{
+
+/// Creates and maps a new shared memory segment, a stale segment of the same name is replaced.
+void *createSegment(std::string const &name, size_t size)
+{
+  logging::Logger _log("com::SharedMemoryCommunication");
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd < 0 && errno == EEXIST) {
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  }
+  CHECK(fd >= 0, "Creating shared memory segment " << name << " failed: " << std::strerror(errno));
+  CHECK(ftruncate(fd, size) == 0, "Resizing shared memory segment " << name << " failed: " << std::strerror(errno));
+  void *segment = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  CHECK(segment != MAP_FAILED, "Mapping shared memory segment " << name << " failed: " << std::strerror(errno));
+  return segment;
+}
+
+/// Maps the segment, if it exists with the given size. Returns nullptr otherwise.
+void *tryOpenSegment(std::string const &name, size_t size)
+{
+  logging::Logger _log("com::SharedMemoryCommunication");
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    CHECK(errno == ENOENT, "Opening shared memory segment " << name << " failed: " << std::strerror(errno));
+    return nullptr;
+  }
+  struct stat status;
+  if (fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) < size) {
+    close(fd);
+    return nullptr;
+  }
+  void *segment = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  CHECK(segment != MAP_FAILED, "Mapping shared memory segment " << name << " failed: " << std::strerror(errno));
+  return segment;
+}
+
+/// Waits until the segment exists with the given size and maps it.
+void *openSegment(std::string const &name, size_t size)
+{
+  void *segment = nullptr;
+  pollUntil([&] {
+    segment = tryOpenSegment(name, size);
+    return segment != nullptr;
+  });
+  return segment;
+}
+
+} // namespace
+
+SharedMemoryCommunication::SharedMemoryCommunication(std::string const &addressDirectory,
+                                                     size_t             bufferSize)
+    : _addressDirectory(addressDirectory),
+      _bufferSize(bufferSize)
+{
+  if (_addressDirectory.empty()) {
+    _addressDirectory = ".";
+  }
+  CHECK(_bufferSize > 0, "The buffer size of the shared memory communication has to be > 0!");
+  // Keep the rings aligned to cache lines
+  _bufferSize = (_bufferSize + 63) / 64 * 64;
+}
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+  TRACE(_isConnected);
+  closeConnection();
+}
+
+size_t SharedMemoryCommunication::getRemoteCommunicatorSize()
+{
+  TRACE();
+  assertion(isConnected());
+  return _connections.size();
+}
+
+void SharedMemoryCommunication::acceptConnection(std::string const &acceptorName,
+                                                 std::string const &requesterName,
+                                                 int                acceptorRank)
+{
+  TRACE(acceptorName, requesterName);
+  assertion(not isConnected());
+
+  const std::string addressFileName("." + requesterName + "-" + acceptorName + ".address");
+  const std::string lobbyName = uniqueLobbyName();
+
+  auto lobby = static_cast<LobbyHeader *>(createSegment(lobbyName, sizeof(LobbyHeader)));
+  lobby->nextSlot.store(0);
+  lobby->acceptorRank = acceptorRank;
+  lobby->acceptorPID  = getpid();
+  lobby->capacity     = _bufferSize;
+  lobby->state.store(SEGMENT_READY);
+
+  {
+    Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+    ScopedPublisher                        p(addressFileName);
+    p.write(lobbyName);
+    DEBUG("Accept connection at " << lobbyName);
+
+    int slot      = 0;
+    int peerCount = -1;
+    do {
+      auto connection                = acceptSlot(lobbyName, slot);
+      int  requesterRank             = connection->header().requesterRank;
+      int  requesterCommunicatorSize = connection->header().requesterCommunicatorSize;
+
+      CHECK(_connections.count(requesterRank) == 0,
+            "Duplicate request to connect by same rank (" << requesterRank << ")!");
+      if (slot == 0) {
+        peerCount = requesterCommunicatorSize;
+      }
+      CHECK(requesterCommunicatorSize == peerCount,
+            "Requester communicator sizes are inconsistent!");
+      CHECK(requesterCommunicatorSize > 0,
+            "Requester communicator size has to be > 0!");
+
+      _connections[requesterRank] = std::move(connection);
+    } while (++slot < peerCount);
+  }
+
+  munmap(lobby, sizeof(LobbyHeader));
+  shm_unlink(lobbyName.c_str());
+  _isConnected = true;
+}
+
+void SharedMemoryCommunication::acceptConnectionAsServer(std::string const &acceptorName,
+                                                         std::string const &requesterName,
+                                                         int                acceptorRank,
+                                                         int                requesterCommunicatorSize)
+{
+  TRACE(acceptorName, requesterName, acceptorRank, requesterCommunicatorSize);
+  CHECK(requesterCommunicatorSize > 0, "Requester communicator size has to be > 0!");
+  assertion(not isConnected());
+
+  const std::string addressFileName("." + requesterName + "-" +
+                                    acceptorName + "-" + std::to_string(acceptorRank) + ".address");
+  const std::string lobbyName = uniqueLobbyName();
+
+  auto lobby = static_cast<LobbyHeader *>(createSegment(lobbyName, sizeof(LobbyHeader)));
+  lobby->nextSlot.store(0);
+  lobby->acceptorRank = acceptorRank;
+  lobby->acceptorPID  = getpid();
+  lobby->capacity     = _bufferSize;
+  lobby->state.store(SEGMENT_READY);
+
+  {
+    Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+    ScopedPublisher                        p(addressFileName);
+    p.write(lobbyName);
+    DEBUG("Accepting connection at " << lobbyName);
+
+    for (int slot = 0; slot < requesterCommunicatorSize; ++slot) {
+      auto connection              = acceptSlot(lobbyName, slot);
+      int  requesterRank           = connection->header().requesterRank;
+      _connections[requesterRank] = std::move(connection);
+    }
+  }
+
+  munmap(lobby, sizeof(LobbyHeader));
+  shm_unlink(lobbyName.c_str());
+  _isConnected = true;
+}
+
+void SharedMemoryCommunication::requestConnection(std::string const &acceptorName,
+                                                  std::string const &requesterName,
+                                                  int                requesterRank,
+                                                  int                requesterCommunicatorSize)
+{
+  TRACE(acceptorName, requesterName);
+  assertion(not isConnected());
+
+  const std::string addressFileName("." + requesterName + "-" + acceptorName + ".address");
+  // All communication is addressed to rank 0, likewise in SocketCommunication
+  _connections[0] = requestSlot(addressFileName, requesterRank, requesterCommunicatorSize);
+  _isConnected    = true;
+}
+
+void SharedMemoryCommunication::requestConnectionAsClient(std::string   const &acceptorName,
+                                                          std::string   const &requesterName,
+                                                          std::set<int> const &acceptorRanks,
+                                                          int                  requesterRank)
+{
+  TRACE(acceptorName, requesterName, acceptorRanks, requesterRank);
+  assertion(not isConnected());
+
+  for (int acceptorRank : acceptorRanks) {
+    const std::string addressFileName("." + requesterName + "-" +
+                                      acceptorName + "-" + std::to_string(acceptorRank) + ".address");
+    _connections[acceptorRank] = requestSlot(addressFileName, requesterRank, 1);
+    DEBUG("Requested connection to rank " << acceptorRank);
+  }
+  _isConnected = true;
+}
+
+std::unique_ptr<SharedMemoryCommunication::Connection> SharedMemoryCommunication::acceptSlot(
+    std::string const &lobbyName,
+    int                slot)
+{
+  const std::string name = lobbyName + "-" + std::to_string(slot);
+  const size_t      size = connectionSegmentSize(_bufferSize);
+
+  void *segment = openSegment(name, size);
+  auto &header  = *static_cast<ConnectionHeader *>(segment);
+  pollUntil([&] { return header.state.load() == SEGMENT_READY; });
+  std::unique_ptr<Connection> connection(new Connection(segment, size, true));
+
+  // Both sides have mapped the segment now, the name is not needed anymore
+  shm_unlink(name.c_str());
+  header.state.store(SEGMENT_ACCEPTED);
+  DEBUG("Accepted connection of rank " << header.requesterRank << " at " << name);
+  return connection;
+}
+
+std::unique_ptr<SharedMemoryCommunication::Connection> SharedMemoryCommunication::requestSlot(
+    std::string const &addressFileName,
+    int                requesterRank,
+    int                requesterCommunicatorSize)
+{
+  // The address file may be left over by an acceptor which has finished or died, read it until it names a live lobby
+  std::string  lobbyName;
+  LobbyHeader *lobby = nullptr;
+  pollUntil([&] {
+    {
+      Publisher::ScopedChangePrefixDirectory scpd(_addressDirectory);
+      Publisher                              p(addressFileName);
+      lobbyName = p.read();
+    }
+    lobby = static_cast<LobbyHeader *>(tryOpenSegment(lobbyName, sizeof(LobbyHeader)));
+    if (lobby == nullptr) {
+      return false;
+    }
+    if (lobby->state.load() == SEGMENT_READY && isProcessAlive(lobby->acceptorPID)) {
+      return true;
+    }
+    if (lobby->state.load() == SEGMENT_READY) {
+      DEBUG("Remove stale lobby " << lobbyName);
+      shm_unlink(lobbyName.c_str());
+    }
+    munmap(lobby, sizeof(LobbyHeader));
+    return false;
+  });
+  DEBUG("Request connection to " << lobbyName);
+
+  const pid_t    acceptorPID = lobby->acceptorPID;
+  const uint64_t capacity    = lobby->capacity;
+  const int      slot     = lobby->nextSlot.fetch_add(1);
+  munmap(lobby, sizeof(LobbyHeader));
+
+  const std::string name    = lobbyName + "-" + std::to_string(slot);
+  const size_t      size    = connectionSegmentSize(capacity);
+  void *            segment = createSegment(name, size);
+
+  auto &header                     = *static_cast<ConnectionHeader *>(segment);
+  header.requesterRank             = requesterRank;
+  header.requesterCommunicatorSize = requesterCommunicatorSize;
+  initializeRing(getRing(segment, capacity, 0), capacity);
+  initializeRing(getRing(segment, capacity, 1), capacity);
+  header.state.store(SEGMENT_READY);
+
+  pollUntil([&] { return header.state.load() == SEGMENT_ACCEPTED || not isProcessAlive(acceptorPID); });
+  if (header.state.load() != SEGMENT_ACCEPTED) {
+    shm_unlink(name.c_str());
+    ERROR("The acceptor of the shared memory connection " << name << " has exited before accepting it.");
+  }
+  DEBUG("Requested connection to " << name);
+  return std::unique_ptr<Connection>(new Connection(segment, size, false));
+}
+
+void SharedMemoryCommunication::closeConnection()
+{
+  TRACE();
+
+  if (not isConnected())
+    return;
+
+  // Every connection joins its threads after its pending requests are completed
+  _connections.clear();
+  _isConnected = false;
+}
+
+SharedMemoryCommunication::Connection &SharedMemoryCommunication::getConnection(int rank)
+{
+  rank = rank - _rankOffset;
+  assertion(rank >= 0, rank);
+  assertion(isConnected());
+  assertion(_connections.count(rank) == 1, rank);
+  return *_connections[rank];
+}
+
+void SharedMemoryCommunication::writeBytes(int rankReceiver, const void *data, size_t size)
+{
+  Connection &connection = getConnection(rankReceiver);
+  if (connection.sendWorker) {
+    connection.sendWorker->drain();
+  }
+  CHECK(writeRing(*connection.out, static_cast<const char *>(data), size),
+        "Sending to rank " << rankReceiver << " failed, the connection has been closed by the other side.");
+}
+
+void SharedMemoryCommunication::readBytes(int rankSender, void *data, size_t size)
+{
+  Connection &connection = getConnection(rankSender);
+  if (connection.receiveWorker) {
+    connection.receiveWorker->drain();
+  }
+  CHECK(readRing(*connection.in, static_cast<char *>(data), size),
+        "Receiving from rank " << rankSender << " failed, the connection has been closed by the other side.");
+}
+
+PtrRequest SharedMemoryCommunication::aWriteBytes(int rankReceiver, const void *data, size_t size)
+{
+  Connection &connection = getConnection(rankReceiver);
+  RingHeader &ring       = *connection.out;
+  if ((not connection.sendWorker || connection.sendWorker->isIdle()) && ringHasSpace(ring, size)) {
+    writeRing(ring, static_cast<const char *>(data), size);
+    auto request = std::make_shared<SharedMemoryRequest>();
+    request->complete();
+    return request;
+  }
+  if (not connection.sendWorker) {
+    connection.sendWorker.reset(new Worker);
+  }
+  return connection.sendWorker->post([&ring, data, size] { writeRing(ring, static_cast<const char *>(data), size); });
+}
+
+PtrRequest SharedMemoryCommunication::aReadBytes(int rankSender, void *data, size_t size)
+{
+  Connection &connection = getConnection(rankSender);
+  RingHeader &ring       = *connection.in;
+  if ((not connection.receiveWorker || connection.receiveWorker->isIdle()) && ringHasData(ring, size)) {
+    readRing(ring, static_cast<char *>(data), size);
+    auto request = std::make_shared<SharedMemoryRequest>();
+    request->complete();
+    return request;
+  }
+  if (not connection.receiveWorker) {
+    connection.receiveWorker.reset(new Worker);
+  }
+  return connection.receiveWorker->post([&ring, data, size] { readRing(ring, static_cast<char *>(data), size); });
+}
+
+void SharedMemoryCommunication::send(std::string const &itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  size_t size = itemToSend.size();
+  writeBytes(rankReceiver, &size, sizeof(size_t));
+  writeBytes(rankReceiver, itemToSend.data(), size);
+}
+
+void SharedMemoryCommunication::send(const int *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  writeBytes(rankReceiver, itemsToSend, size * sizeof(int));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  return aWriteBytes(rankReceiver, itemsToSend, size * sizeof(int));
+}
+
+void SharedMemoryCommunication::send(const double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  writeBytes(rankReceiver, itemsToSend, size * sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double *itemsToSend, int size, int rankReceiver)
+{
+  TRACE(size, rankReceiver);
+  return aWriteBytes(rankReceiver, itemsToSend, size * sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(std::vector<double> const &itemsToSend, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  return aWriteBytes(rankReceiver, itemsToSend.data(), itemsToSend.size() * sizeof(double));
+}
+
+void SharedMemoryCommunication::send(double itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  writeBytes(rankReceiver, &itemToSend, sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const double &itemToSend, int rankReceiver)
+{
+  return aSend(&itemToSend, 1, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(int itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  writeBytes(rankReceiver, &itemToSend, sizeof(int));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const int &itemToSend, int rankReceiver)
+{
+  return aSend(&itemToSend, 1, rankReceiver);
+}
+
+void SharedMemoryCommunication::send(bool itemToSend, int rankReceiver)
+{
+  TRACE(itemToSend, rankReceiver);
+  writeBytes(rankReceiver, &itemToSend, sizeof(bool));
+}
+
+PtrRequest SharedMemoryCommunication::aSend(const bool &itemToSend, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  return aWriteBytes(rankReceiver, &itemToSend, sizeof(bool));
+}
+
+void SharedMemoryCommunication::receive(std::string &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  size_t size = 0;
+  readBytes(rankSender, &size, sizeof(size_t));
+  itemToReceive.resize(size);
+  readBytes(rankSender, &itemToReceive[0], size);
+}
+
+void SharedMemoryCommunication::receive(int *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+  readBytes(rankSender, itemsToReceive, size * sizeof(int));
+}
+
+void SharedMemoryCommunication::receive(double *itemsToReceive, int size, int rankSender)
+{
+  TRACE(size, rankSender);
+  readBytes(rankSender, itemsToReceive, size * sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double *itemsToReceive,
+                                               int     size,
+                                               int     rankSender)
+{
+  TRACE(size, rankSender);
+  return aReadBytes(rankSender, itemsToReceive, size * sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(std::vector<double> &itemsToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  return aReadBytes(rankSender, itemsToReceive.data(), itemsToReceive.size() * sizeof(double));
+}
+
+void SharedMemoryCommunication::receive(double &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  readBytes(rankSender, &itemToReceive, sizeof(double));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(double &itemToReceive, int rankSender)
+{
+  return aReceive(&itemToReceive, 1, rankSender);
+}
+
+void SharedMemoryCommunication::receive(int &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  readBytes(rankSender, &itemToReceive, sizeof(int));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(int &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  return aReadBytes(rankSender, &itemToReceive, sizeof(int));
+}
+
+void SharedMemoryCommunication::receive(bool &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  readBytes(rankSender, &itemToReceive, sizeof(bool));
+}
+
+PtrRequest SharedMemoryCommunication::aReceive(bool &itemToReceive, int rankSender)
+{
+  TRACE(rankSender);
+  return aReadBytes(rankSender, &itemToReceive, sizeof(bool));
+}
+
+void SharedMemoryCommunication::send(std::vector<int> const &v, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  size_t size = v.size();
+  writeBytes(rankReceiver, &size, sizeof(size_t));
+  writeBytes(rankReceiver, v.data(), size * sizeof(int));
+}
+
+void SharedMemoryCommunication::receive(std::vector<int> &v, int rankSender)
+{
+  TRACE(rankSender);
+  size_t size = 0;
+  readBytes(rankSender, &size, sizeof(size_t));
+  v.resize(size);
+  readBytes(rankSender, v.data(), size * sizeof(int));
+}
+
+void SharedMemoryCommunication::send(std::vector<double> const &v, int rankReceiver)
+{
+  TRACE(rankReceiver);
+  size_t size = v.size();
+  writeBytes(rankReceiver, &size, sizeof(size_t));
+  writeBytes(rankReceiver, v.data(), size * sizeof(double));
+}
+
+void SharedMemoryCommunication::receive(std::vector<double> &v, int rankSender)
+{
+  TRACE(rankSender);
+  size_t size = 0;
+  readBytes(rankSender, &size, sizeof(size_t));
+  v.resize(size);
+  readBytes(rankSender, v.data(), size * sizeof(double));
+}
+
+} // namespace com
+} // namespace precice
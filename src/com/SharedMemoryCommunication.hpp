@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include "com/Communication.hpp"
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Implements Communication by using POSIX shared memory.
+ *
+ * Can only be used if both communication partners run on the same node. Every connection
+ * to a remote rank is a shared memory segment holding two ring buffers, one per direction.
+ * A ring buffer is used as a byte stream, similar to a socket: the writer blocks if the buffer
+ * is full, the reader blocks if not enough data is available. A blocked process spins for a
+ * short while and then sleeps on a futex, which is woken by the other side.
+ *
+ * To set up a connection, the acceptor creates a small lobby segment and publishes its name
+ * in the exchange directory, in the same way SocketCommunication publishes its address.
+ * Every requester draws a slot number from the lobby and creates the connection segment for
+ * this slot. All segment names are unlinked once both sides have mapped them. A requester
+ * skips and removes a lobby left behind by an acceptor which has died.
+ *
+ * Asynchronous requests are completed immediately if possible. Otherwise, they are executed
+ * in order by a background thread per connection and direction. Synchronous operations only
+ * wait for the pending requests of their own connection, such that a pending receive from one
+ * rank never blocks the communication with another rank.
+ *
+ * Closing a connection waits a bounded time for its pending sends to be read. Afterwards,
+ * the rings are closed, which aborts all pending and blocked operations on both sides.
+ */
+class SharedMemoryCommunication : public Communication
+{
+public:
+  /// Default size of each ring buffer in bytes.
+  static const size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+  explicit SharedMemoryCommunication(std::string const &addressDirectory = ".",
+                                     size_t             bufferSize       = DEFAULT_BUFFER_SIZE);
+
+  virtual ~SharedMemoryCommunication();
+
+  virtual size_t getRemoteCommunicatorSize() override;
+
+  virtual void acceptConnection(std::string const &acceptorName,
+                                std::string const &requesterName,
+                                int                acceptorRank) override;
+
+  virtual void acceptConnectionAsServer(std::string const &acceptorName,
+                                        std::string const &requesterName,
+                                        int                acceptorRank,
+                                        int                requesterCommunicatorSize) override;
+
+  virtual void requestConnection(std::string const &acceptorName,
+                                 std::string const &requesterName,
+                                 int                requesterRank,
+                                 int                requesterCommunicatorSize) override;
+
+  virtual void requestConnectionAsClient(std::string   const &acceptorName,
+                                         std::string   const &requesterName,
+                                         std::set<int> const &acceptorRanks,
+                                         int                  requesterRank) override;
+
+  virtual void closeConnection() override;
+
+  /// Sends a std::string to process with given rank.
+  virtual void send(std::string const &itemToSend, int rankReceiver) override;
+
+  /// Sends an array of integer values.
+  virtual void send(const int *itemsToSend, int size, int rankReceiver) override;
+
+  /// Asynchronously sends an array of integer values.
+  virtual PtrRequest aSend(const int *itemsToSend, int size, int rankReceiver) override;
+
+  /// Sends an array of double values.
+  virtual void send(const double *itemsToSend, int size, int rankReceiver) override;
+
+  /// Asynchronously sends an array of double values.
+  virtual PtrRequest aSend(const double *itemsToSend, int size, int rankReceiver) override;
+
+  virtual PtrRequest aSend(std::vector<double> const &itemsToSend, int rankReceiver) override;
+
+  /// Sends a double to process with given rank.
+  virtual void send(double itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends a double to process with given rank.
+  virtual PtrRequest aSend(const double &itemToSend, int rankReceiver) override;
+
+  /// Sends an int to process with given rank.
+  virtual void send(int itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends an int to process with given rank.
+  virtual PtrRequest aSend(const int &itemToSend, int rankReceiver) override;
+
+  /// Sends a bool to process with given rank.
+  virtual void send(bool itemToSend, int rankReceiver) override;
+
+  /// Asynchronously sends a bool to process with given rank.
+  virtual PtrRequest aSend(const bool &itemToSend, int rankReceiver) override;
+
+  /// Receives a std::string from process with given rank.
+  virtual void receive(std::string &itemToReceive, int rankSender) override;
+
+  /// Receives an array of integer values.
+  virtual void receive(int *itemsToReceive, int size, int rankSender) override;
+
+  /// Receives an array of double values.
+  virtual void receive(double *itemsToReceive, int size, int rankSender) override;
+
+  /// Asynchronously receives an array of double values.
+  virtual PtrRequest aReceive(double *itemsToReceive,
+                              int     size,
+                              int     rankSender) override;
+
+  virtual PtrRequest aReceive(std::vector<double> &itemsToReceive, int rankSender) override;
+
+  /// Receives a double from process with given rank.
+  virtual void receive(double &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives a double from process with given rank.
+  virtual PtrRequest aReceive(double &itemToReceive, int rankSender) override;
+
+  /// Receives an int from process with given rank.
+  virtual void receive(int &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives an int from process with given rank.
+  virtual PtrRequest aReceive(int &itemToReceive, int rankSender) override;
+
+  /// Receives a bool from process with given rank.
+  virtual void receive(bool &itemToReceive, int rankSender) override;
+
+  /// Asynchronously receives a bool from process with given rank.
+  virtual PtrRequest aReceive(bool &itemToReceive, int rankSender) override;
+
+  void send(std::vector<int> const &v, int rankReceiver) override;
+  void receive(std::vector<int> &v, int rankSender) override;
+
+  void send(std::vector<double> const &v, int rankReceiver) override;
+  void receive(std::vector<double> &v, int rankSender) override;
+
+private:
+  logging::Logger _log{"com::SharedMemoryCommunication"};
+
+  /// Background thread executing the asynchronous requests of one connection and direction in order.
+  class Worker;
+
+  /// Mapped shared memory segment of the connection to one remote rank.
+  struct Connection;
+
+  /// Directory where the name of the lobby segment is exchanged by file.
+  std::string _addressDirectory;
+
+  /// Capacity of each ring buffer in bytes.
+  size_t _bufferSize;
+
+  /// Connections, indexed by the remote rank.
+  std::map<int, std::unique_ptr<Connection>> _connections;
+
+  /// Accepts the connection of slot in the lobby with the given name.
+  std::unique_ptr<Connection> acceptSlot(std::string const &lobbyName, int slot);
+
+  /// Connects to the acceptor whose lobby name is published in the given file.
+  std::unique_ptr<Connection> requestSlot(std::string const &addressFileName,
+                                          int                requesterRank,
+                                          int                requesterCommunicatorSize);
+
+  Connection &getConnection(int rank);
+
+  /// Blocks until all previously started asynchronous sends to the rank are completed and writes the bytes.
+  void writeBytes(int rankReceiver, const void *data, size_t size);
+
+  /// Blocks until all previously started asynchronous receives from the rank are completed and reads the bytes.
+  void readBytes(int rankSender, void *data, size_t size);
+
+  /// Writes the bytes after all previously started asynchronous sends to the rank.
+  PtrRequest aWriteBytes(int rankReceiver, const void *data, size_t size);
+
+  /// Reads the bytes after all previously started asynchronous receives from the rank.
+  PtrRequest aReadBytes(int rankSender, void *data, size_t size);
+};
+
+} // namespace com
+} // namespace precice
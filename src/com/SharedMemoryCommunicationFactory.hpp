@@ -0,0 +1,28 @@
+#pragma once
+
+#include "CommunicationFactory.hpp"
+#include "com/SharedPointer.hpp"
+#include <cstddef>
+#include <string>
+
+namespace precice
+{
+namespace com
+{
+class SharedMemoryCommunicationFactory : public CommunicationFactory
+{
+public:
+  SharedMemoryCommunicationFactory(std::string const &addressDirectory = ".",
+                                   size_t             bufferSize       = 1 << 20);
+
+  PtrCommunication newCommunication() override;
+
+  std::string addressDirectory() override;
+
+private:
+  std::string _addressDirectory;
+  size_t      _bufferSize;
+};
+
+} // namespace com
+} // namespace precice
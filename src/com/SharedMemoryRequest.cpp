@@ -0,0 +1,34 @@
+#include "SharedMemoryRequest.hpp"
+
+namespace precice
+{
+namespace com
+{
+SharedMemoryRequest::SharedMemoryRequest()
+    : _complete(false)
+{
+}
+
+void SharedMemoryRequest::complete()
+{
+  {
+    std::lock_guard<std::mutex> lock(_completeMutex);
+    _complete = true;
+  }
+
+  _completeCondition.notify_one();
+}
+
+bool SharedMemoryRequest::test()
+{
+  std::lock_guard<std::mutex> lock(_completeMutex);
+  return _complete;
+}
+
+void SharedMemoryRequest::wait()
+{
+  std::unique_lock<std::mutex> lock(_completeMutex);
+  _completeCondition.wait(lock, [this] { return _complete; });
+}
+} // namespace com
+} // namespace precice
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Request.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+namespace precice
+{
+namespace com
+{
+class SharedMemoryRequest : public Request
+{
+public:
+  SharedMemoryRequest();
+
+  void complete();
+
+  bool test() override;
+
+  void wait() override;
+
+private:
+  bool _complete;
+
+  std::condition_variable _completeCondition;
+  std::mutex              _completeMutex;
+};
+} // namespace com
+} // namespace precice
@@ -0,0 +1,60 @@
+#include "SharedMemorySegment.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace precice
+{
+namespace com
+{
+
+SharedMemorySegment::SharedMemorySegment(std::string const &name, size_t size)
+    : _name(name),
+      _size(size),
+      _isOwner(true)
+{
+  TRACE(name, size);
+  int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  if (fd < 0 && errno == EEXIST) {
+    shm_unlink(name.c_str());
+    fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+  }
+  CHECK(fd >= 0, "Creating shared memory segment " << name << " failed: " << std::strerror(errno));
+  // mmap does not accept an empty mapping
+  CHECK(ftruncate(fd, std::max<size_t>(size, 1)) == 0,
+        "Resizing shared memory segment " << name << " failed: " << std::strerror(errno));
+  _data = mmap(nullptr, std::max<size_t>(size, 1), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  CHECK(_data != MAP_FAILED, "Mapping shared memory segment " << name << " failed: " << std::strerror(errno));
+}
+
+SharedMemorySegment::SharedMemorySegment(std::string const &name)
+    : _name(name)
+{
+  TRACE(name);
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  CHECK(fd >= 0, "Opening shared memory segment " << name << " failed: " << std::strerror(errno));
+  struct stat status;
+  CHECK(fstat(fd, &status) == 0, "Querying shared memory segment " << name << " failed: " << std::strerror(errno));
+  _size = status.st_size;
+  _data = mmap(nullptr, std::max<size_t>(_size, 1), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  CHECK(_data != MAP_FAILED, "Mapping shared memory segment " << name << " failed: " << std::strerror(errno));
+}
+
+SharedMemorySegment::~SharedMemorySegment()
+{
+  munmap(_data, std::max<size_t>(_size, 1));
+  if (_isOwner) {
+    shm_unlink(_name.c_str());
+  }
+}
+
+} // namespace com
+} // namespace precice
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace com
+{
+/**
+ * @brief Maps a named POSIX shared memory segment into the address space of the process.
+ *
+ * The owner creates the segment and removes its name again on destruction. Other processes
+ * on the same node map the existing segment by its name. The memory is not synchronized,
+ * the processes have to order their accesses by other means, e.g. a SharedMemoryCommunication.
+ */
+class SharedMemorySegment
+{
+public:
+  /// Creates and maps a new segment of the given size in bytes, a stale segment of the same name is replaced.
+  SharedMemorySegment(std::string const &name, size_t size);
+
+  /// Maps the existing segment of the given name.
+  explicit SharedMemorySegment(std::string const &name);
+
+  /// Unmaps the segment, the owner also removes its name.
+  ~SharedMemorySegment();
+
+  SharedMemorySegment(SharedMemorySegment const &) = delete;
+  SharedMemorySegment &operator=(SharedMemorySegment const &) = delete;
+
+  std::string const &getName() const
+  {
+    return _name;
+  }
+
+  /// Size of the segment in bytes.
+  size_t size() const
+  {
+    return _size;
+  }
+
+  void *data()
+  {
+    return _data;
+  }
+
+private:
+  logging::Logger _log{"com::SharedMemorySegment"};
+
+  std::string _name;
+
+  size_t _size = 0;
+
+  void *_data = nullptr;
+
+  /// True, if the segment has been created by this object
+  bool _isOwner = false;
+};
+
+} // namespace com
+} // namespace precice
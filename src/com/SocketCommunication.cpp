@@ -22,11 +22,13 @@ namespace asio = boost::asio;
 SocketCommunication::SocketCommunication(unsigned short     portNumber,
                                          bool               reuseAddress,
                                          std::string const &networkName,
-                                         std::string const &addressDirectory)
+                                         std::string const &addressDirectory,
+                                         int                bufferSize)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(networkName),
       _addressDirectory(addressDirectory),
+      _bufferSize(bufferSize),
       _ioService(new IOService)
 {
   if (_addressDirectory.empty()) {
@@ -103,6 +105,7 @@ void SocketCommunication::acceptConnection(std::string const &acceptorName,
       CHECK(_sockets.count(requesterRank) == 0,
             "Duplicate request to connect by same rank (" << requesterRank << ")!");
       
+      configureSocket(*socket);
       _sockets[requesterRank] = socket;
       send(acceptorRank, requesterRank);
       receive(requesterCommunicatorSize, requesterRank);
@@ -177,6 +180,7 @@ void SocketCommunication::acceptConnectionAsServer(std::string const &acceptorNa
 
       int requesterRank;
       asio::read(*socket, asio::buffer(&requesterRank, sizeof(int)));
+      configureSocket(*socket);
       _sockets[requesterRank] = socket;
     }
 
@@ -238,6 +242,7 @@ void SocketCommunication::requestConnection(std::string const &acceptorName,
 
     DEBUG("Requested connection to " << address);
 
+    configureSocket(*socket);
     asio::write(*socket, asio::buffer(&requesterRank, sizeof(int)));
     
     int acceptorRank = -1;
@@ -306,6 +311,7 @@ void SocketCommunication::requestConnectionAsClient(std::string      const &acce
       }
       
       DEBUG("Requested connection to " << address << ", rank = " << acceptorRank);
+      configureSocket(*socket);
       _sockets[acceptorRank] = socket;
       send(requesterRank, acceptorRank); // send my rank
 
@@ -326,6 +332,9 @@ void SocketCommunication::closeConnection()
   if (not isConnected())
     return;
 
+  flushBatches();
+  _isBatching = false;
+
   if (_thread.joinable()) {
     _work.reset();
     _ioService->stop();
@@ -341,6 +350,19 @@ void SocketCommunication::closeConnection()
   _isConnected            = false;
 }
 
+void SocketCommunication::startBatch()
+{
+  TRACE();
+  _isBatching = true;
+}
+
+void SocketCommunication::flush()
+{
+  TRACE();
+  flushBatches();
+  _isBatching = false;
+}
+
 void SocketCommunication::send(std::string const &itemToSend, int rankReceiver)
 {
   TRACE(itemToSend, rankReceiver);
@@ -352,8 +374,7 @@ void SocketCommunication::send(std::string const &itemToSend, int rankReceiver)
 
   size_t size = itemToSend.size() + 1;
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(itemToSend.c_str(), size));
+    write(rankReceiver, {asio::buffer(&size, sizeof(size_t)), asio::buffer(itemToSend.c_str(), size)});
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -369,7 +390,7 @@ void SocketCommunication::send(const int *itemsToSend, int size, int rankReceive
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(itemsToSend, size * sizeof(int)));
+    write(rankReceiver, {asio::buffer(itemsToSend, size * sizeof(int))});
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -387,6 +408,7 @@ PtrRequest SocketCommunication::aSend(const int *itemsToSend, int size, int rank
   PtrRequest request(new SocketRequest);
 
   try {
+    flushBatch(rankReceiver);
     asio::async_write(*_sockets[rankReceiver],
                       asio::buffer(itemsToSend, size * sizeof(int)),
                       [request](boost::system::error_code const &, std::size_t) {
@@ -409,7 +431,7 @@ void SocketCommunication::send(const double *itemsToSend, int size, int rankRece
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(itemsToSend, size * sizeof(double)));
+    write(rankReceiver, {asio::buffer(itemsToSend, size * sizeof(double))});
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -427,6 +449,7 @@ PtrRequest SocketCommunication::aSend(const double *itemsToSend, int size, int r
   PtrRequest request(new SocketRequest);
 
   try {
+    flushBatch(rankReceiver);
     asio::async_write(*_sockets[rankReceiver],
                       asio::buffer(itemsToSend, size * sizeof(double)),
                       [request](boost::system::error_code const &, std::size_t) {
@@ -451,6 +474,7 @@ PtrRequest SocketCommunication::aSend(std::vector<double> const & itemsToSend, i
   PtrRequest request(new SocketRequest);
 
   try {
+    flushBatch(rankReceiver);
     asio::async_write(*_sockets[rankReceiver],
                       asio::buffer(itemsToSend),
                       [request](boost::system::error_code const &, std::size_t) {
@@ -474,7 +498,7 @@ void SocketCommunication::send(double itemToSend, int rankReceiver)
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&itemToSend, sizeof(double)));
+    write(rankReceiver, {asio::buffer(&itemToSend, sizeof(double))});
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -495,7 +519,7 @@ void SocketCommunication::send(int itemToSend, int rankReceiver)
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&itemToSend, sizeof(int)));
+    write(rankReceiver, {asio::buffer(&itemToSend, sizeof(int))});
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -516,7 +540,7 @@ void SocketCommunication::send(bool itemToSend, int rankReceiver)
   assertion(isConnected());
 
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&itemToSend, sizeof(bool)));
+    write(rankReceiver, {asio::buffer(&itemToSend, sizeof(bool))});
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -534,6 +558,7 @@ PtrRequest SocketCommunication::aSend(const bool & itemToSend, int rankReceiver)
   PtrRequest request(new SocketRequest);
 
   try {
+    flushBatch(rankReceiver);
     asio::async_write(*_sockets[rankReceiver],
                       asio::buffer(&itemToSend, sizeof(bool)),
                       [request](boost::system::error_code const &, std::size_t) {
@@ -558,10 +583,11 @@ void SocketCommunication::receive(std::string &itemToReceive, int rankSender)
   size_t size = 0;
 
   try {
+    flushBatches();
     asio::read(*_sockets[rankSender], asio::buffer(&size, sizeof(size_t)));
-    char msg[size];
-    asio::read(*_sockets[rankSender], asio::buffer(msg, size));
-    itemToReceive = msg;
+    std::vector<char> msg(size);
+    asio::read(*_sockets[rankSender], asio::buffer(msg));
+    itemToReceive = msg.data();
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
   }
@@ -577,6 +603,7 @@ void SocketCommunication::receive(int *itemsToReceive, int size, int rankSender)
   assertion(isConnected());
 
   try {
+    flushBatches();
     asio::read(*_sockets[rankSender], asio::buffer(itemsToReceive, size * sizeof(int)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
@@ -593,6 +620,7 @@ void SocketCommunication::receive(double *itemsToReceive, int size, int rankSend
   assertion(isConnected());
 
   try {
+    flushBatches();
     asio::read(*_sockets[rankSender], asio::buffer(itemsToReceive, size * sizeof(double)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
@@ -613,6 +641,7 @@ PtrRequest SocketCommunication::aReceive(double *itemsToReceive,
   PtrRequest request(new SocketRequest);
 
   try {
+    flushBatches();
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(itemsToReceive, size * sizeof(double)),
                      [request](boost::system::error_code const &, std::size_t) {
@@ -637,6 +666,7 @@ PtrRequest SocketCommunication::aReceive(std::vector<double> & itemsToReceive, i
   PtrRequest request(new SocketRequest);
 
   try {
+    flushBatches();
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(itemsToReceive),
                      [request](boost::system::error_code const &, std::size_t) {
@@ -659,6 +689,7 @@ void SocketCommunication::receive(double &itemToReceive, int rankSender)
   assertion(isConnected());
 
   try {
+    flushBatches();
     asio::read(*_sockets[rankSender], asio::buffer(&itemToReceive, sizeof(double)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
@@ -680,6 +711,7 @@ void SocketCommunication::receive(int &itemToReceive, int rankSender)
   assertion(isConnected());
 
   try {
+    flushBatches();
     asio::read(*_sockets[rankSender], asio::buffer(&itemToReceive, sizeof(int)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
@@ -699,6 +731,7 @@ PtrRequest SocketCommunication::aReceive(int &itemToReceive, int rankSender)
   PtrRequest request(new SocketRequest);
 
   try {
+    flushBatches();
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(&itemToReceive, sizeof(int)),
                      [request](boost::system::error_code const &, std::size_t) {
@@ -721,6 +754,7 @@ void SocketCommunication::receive(bool &itemToReceive, int rankSender)
   assertion(isConnected());
 
   try {
+    flushBatches();
     asio::read(*_sockets[rankSender], asio::buffer(&itemToReceive, sizeof(bool)));
   } catch (std::exception &e) {
     ERROR("Receive failed: " << e.what());
@@ -739,6 +773,7 @@ PtrRequest SocketCommunication::aReceive(bool &itemToReceive, int rankSender)
   PtrRequest request(new SocketRequest);
 
   try {
+    flushBatches();
     asio::async_read(*_sockets[rankSender],
                      asio::buffer(&itemToReceive, sizeof(bool)),
                      [request](boost::system::error_code const &, std::size_t) {
@@ -762,8 +797,7 @@ void SocketCommunication::send(std::vector<int> const &v, int rankReceiver)
 
   size_t size = v.size();
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(v));
+    write(rankReceiver, {asio::buffer(&size, sizeof(size_t)), asio::buffer(v)});
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -781,6 +815,7 @@ void SocketCommunication::receive(std::vector<int> &v, int rankSender)
   size_t size = 0;
 
   try {
+    flushBatches();
     asio::read(*_sockets[rankSender], asio::buffer(&size, sizeof(size_t)));
     v.resize(size);
     asio::read(*_sockets[rankSender], asio::buffer(v));
@@ -800,8 +835,7 @@ void SocketCommunication::send(std::vector<double> const &v, int rankReceiver)
 
   size_t size = v.size();
   try {
-    asio::write(*_sockets[rankReceiver], asio::buffer(&size, sizeof(size_t)));
-    asio::write(*_sockets[rankReceiver], asio::buffer(v));
+    write(rankReceiver, {asio::buffer(&size, sizeof(size_t)), asio::buffer(v)});
   } catch (std::exception &e) {
     ERROR("Send failed: " << e.what());
   }
@@ -819,6 +853,7 @@ void SocketCommunication::receive(std::vector<double> &v, int rankSender)
   size_t size = 0;
 
   try {
+    flushBatches();
     asio::read(*_sockets[rankSender], asio::buffer(&size, sizeof(size_t)));
     v.resize(size);
     asio::read(*_sockets[rankSender], asio::buffer(v));
@@ -827,6 +862,56 @@ void SocketCommunication::receive(std::vector<double> &v, int rankSender)
   }
 }
 
+void SocketCommunication::configureSocket(Socket &socket)
+{
+  socket.set_option(asio::ip::tcp::no_delay(true));
+  if (_bufferSize > 0) {
+    socket.set_option(asio::socket_base::send_buffer_size(_bufferSize));
+    socket.set_option(asio::socket_base::receive_buffer_size(_bufferSize));
+  }
+}
+
+void SocketCommunication::write(int rankReceiver, std::initializer_list<asio::const_buffer> buffers)
+{
+  auto &batch = _batches[rankReceiver];
+  if (_isBatching && asio::buffer_size(buffers) + batch.size() <= MAX_BATCH_SIZE) {
+    for (auto const &buffer : buffers) {
+      auto data = asio::buffer_cast<const char *>(buffer);
+      batch.insert(batch.end(), data, data + asio::buffer_size(buffer));
+    }
+    return;
+  }
+  if (batch.empty()) {
+    asio::write(*_sockets[rankReceiver], buffers);
+  } else {
+    // Preserve the order of messages, the pending batch goes first in the same write
+    std::vector<asio::const_buffer> all{asio::buffer(batch)};
+    all.insert(all.end(), buffers.begin(), buffers.end());
+    asio::write(*_sockets[rankReceiver], all);
+    batch.clear();
+  }
+}
+
+void SocketCommunication::flushBatch(int rankReceiver)
+{
+  auto batch = _batches.find(rankReceiver);
+  if (batch != _batches.end() && not batch->second.empty()) {
+    asio::write(*_sockets[rankReceiver], asio::buffer(batch->second));
+    batch->second.clear();
+  }
+}
+
+void SocketCommunication::flushBatches()
+{
+  try {
+    for (auto &batch : _batches) {
+      flushBatch(batch.first);
+    }
+  } catch (std::exception &e) {
+    ERROR("Send failed: " << e.what());
+  }
+}
+
 std::string SocketCommunication::getIpAddress()
 {
   TRACE();
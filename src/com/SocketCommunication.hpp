@@ -5,20 +5,35 @@
 #include "com/Communication.hpp"
 #include <boost/asio.hpp>
 #include "logging/Logger.hpp"
+#include <initializer_list>
 #include <thread>
+#include <vector>
 
 namespace precice
 {
 namespace com
 {
-/// Implements Communication by using sockets.
+/**
+ * @brief Implements Communication by using sockets.
+ *
+ * All sockets use TCP_NODELAY, i.e., every message is put on the wire immediately. Many small
+ * consecutive sends, e.g. of control flags, can be coalesced by enclosing them in startBatch()
+ * and flush(). In between, blocking sends are appended to a buffer per remote rank and written
+ * with a single gathering write at the end of the batch. Pending batches are also flushed
+ * before any receive or asynchronous operation, such that no deadlock can occur.
+ */
 class SocketCommunication : public Communication
 {
 public:
+  /**
+   * @param[in] bufferSize Size in bytes of the socket send and receive buffers of the OS.
+   *            Zero keeps the default of the OS.
+   */
   SocketCommunication(unsigned short     portNumber       = 0,
                       bool               reuseAddress     = false,
                       std::string const &networkName      = "lo",
-                      std::string const &addressDirectory = ".");
+                      std::string const &addressDirectory = ".",
+                      int                bufferSize       = 0);
 
   explicit SocketCommunication(std::string const &addressDirectory);
 
@@ -48,6 +63,12 @@ public:
 
   virtual void closeConnection() override;
 
+  /// Starts coalescing the following blocking sends until flush() is called.
+  virtual void startBatch() override;
+
+  /// Writes all batched sends and ends the batch.
+  virtual void flush() override;
+
   /// Sends a std::string to process with given rank.
   virtual void send(std::string const &itemToSend, int rankReceiver) override;
 
@@ -137,6 +158,18 @@ private:
   /// Directory where IP address is exchanged by file.
   std::string _addressDirectory;
 
+  /// Size of the socket buffers of the OS, zero for the default.
+  int _bufferSize;
+
+  /// Batches larger than this are written even before flush() is called.
+  static const size_t MAX_BATCH_SIZE = 1 << 16;
+
+  /// True, if blocking sends are coalesced.
+  bool _isBatching = false;
+
+  /// Remote rank -> bytes of the blocking sends not yet written
+  std::map<int, std::vector<char>> _batches;
+
   using IOService     = boost::asio::io_service;
   using TCP           = boost::asio::ip::tcp;
   using SocketService = boost::asio::stream_socket_service<TCP>;
@@ -154,6 +187,18 @@ private:
   bool isServer();
 
   std::string getIpAddress();
+
+  /// Sets TCP_NODELAY and the buffer sizes of a connected socket.
+  void configureSocket(Socket &socket);
+
+  /// Writes or batches the buffers as one message to the socket of the given (offset) rank.
+  void write(int rankReceiver, std::initializer_list<boost::asio::const_buffer> buffers);
+
+  /// Writes the pending batch to the given (offset) rank.
+  void flushBatch(int rankReceiver);
+
+  /// Writes the pending batches to all ranks.
+  void flushBatches();
 };
 } // namespace com
 } // namespace precice
@@ -11,11 +11,13 @@ SocketCommunicationFactory::SocketCommunicationFactory(
     unsigned short     portNumber,
     bool               reuseAddress,
     std::string const &networkName,
-    std::string const &addressDirectory)
+    std::string const &addressDirectory,
+    int                bufferSize)
     : _portNumber(portNumber),
       _reuseAddress(reuseAddress),
       _networkName(networkName),
-      _addressDirectory(addressDirectory)
+      _addressDirectory(addressDirectory),
+      _bufferSize(bufferSize)
 {
   if (_addressDirectory.empty()) {
     _addressDirectory = ".";
@@ -31,7 +33,7 @@ SocketCommunicationFactory::SocketCommunicationFactory(
 PtrCommunication SocketCommunicationFactory::newCommunication()
 {
   return std::make_shared<SocketCommunication>(
-      _portNumber, _reuseAddress, _networkName, _addressDirectory);
+      _portNumber, _reuseAddress, _networkName, _addressDirectory, _bufferSize);
 }
 
 std::string SocketCommunicationFactory::addressDirectory()
@@ -1,6 +1,7 @@
 #include "CommunicationConfiguration.hpp"
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunication.hpp"
+#include "com/SharedMemoryCommunication.hpp"
 #include "com/SocketCommunication.hpp"
 #include "xml/XMLAttribute.hpp"
 #include "utils/Helpers.hpp"
@@ -20,8 +21,18 @@ PtrCommunication CommunicationConfiguration::createCommunication(
     CHECK(not utils::isTruncated<unsigned short>(port),
           "The value given for the \"port\" attribute is not a 16-bit unsigned integer: " << port);
 
+    int bufferSize = tag.getIntAttributeValue("buffer-size");
+    CHECK(bufferSize >= 0, "The value given for the \"buffer-size\" attribute must not be negative: " << bufferSize);
+
+    std::string dir = tag.getStringAttributeValue("exchange-directory");
+    com             = std::make_shared<com::SocketCommunication>(port, false, network, dir, bufferSize);
+  }
+  else if (tag.getName() == "shared-memory") {
+    int bufferSize = tag.getIntAttributeValue("buffer-size");
+    CHECK(bufferSize > 0, "The value given for the \"buffer-size\" attribute has to be positive: " << bufferSize);
+
     std::string dir = tag.getStringAttributeValue("exchange-directory");
-    com             = std::make_shared<com::SocketCommunication>(port, false, network, dir);
+    com             = std::make_shared<com::SharedMemoryCommunication>(dir, bufferSize);
   }
   else if (tag.getName() == "mpi") {
     std::string dir = tag.getStringAttributeValue("exchange-directory");
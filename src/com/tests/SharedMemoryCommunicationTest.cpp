@@ -0,0 +1,202 @@
+#include "com/SharedMemoryCommunication.hpp"
+#include "testing/Testing.hpp"
+#include "GenericTestFunctions.hpp"
+#include "utils/Parallel.hpp"
+#include "utils/Publisher.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace precice;
+using namespace precice::com;
+
+
+BOOST_TEST_SPECIALIZED_COLLECTION_COMPARE(std::vector<int>)
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemory)
+
+
+BOOST_AUTO_TEST_CASE(SendAndReceive,
+                     * testing::MinRanks(2))
+{
+  TestSendAndReceive<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcesses,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcesses<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveTwoProcessesServerClient,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveTwoProcessesServerClient<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClient,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcessesServerClient<SharedMemoryCommunication>();
+}
+
+BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2,
+                     * testing::MinRanks(4)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  TestSendReceiveFourProcessesServerClientV2<SharedMemoryCommunication>();
+}
+
+/// Messages larger than the ring buffer are streamed through it in chunks
+BOOST_AUTO_TEST_CASE(SendReceiveLargerThanBuffer,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  SharedMemoryCommunication com(".", 128);
+  const int                 rank = utils::Parallel::getProcessRank();
+  std::vector<double>       data(1000);
+
+  if (rank == 0) {
+    com.acceptConnection("process0", "process1", rank);
+    for (size_t i = 0; i < data.size(); i++) {
+      data[i] = i;
+    }
+    com.send(data, 0);
+    auto request = com.aSend(data.data(), data.size(), 0);
+    request->wait();
+    com.closeConnection();
+  } else if (rank == 1) {
+    com.requestConnection("process0", "process1", 0, 1);
+    std::vector<double> received;
+    com.receive(received, 0);
+    BOOST_TEST(received.size() == data.size());
+    BOOST_TEST(received[999] == 999.0);
+    auto request = com.aReceive(data, 0);
+    request->wait();
+    BOOST_TEST(data == received, boost::test_tools::per_element());
+    com.closeConnection();
+  }
+}
+
+/// A pending receive from one client must not block the communication with another client
+BOOST_AUTO_TEST_CASE(PendingReceiveDoesNotBlockOtherRanks,
+                     * testing::MinRanks(3)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  SharedMemoryCommunication com;
+  const int                 rank = utils::Parallel::getProcessRank();
+
+  if (rank == 0) {
+    com.acceptConnectionAsServer("A", "B", rank, 2);
+    int  quietMessage = -1;
+    auto request      = com.aReceive(quietMessage, 2);
+    for (int i = 0; i < 3; i++) {
+      int message = -1;
+      com.receive(message, 1);
+      BOOST_TEST(message == i);
+      com.send(2 * message, 1);
+    }
+    BOOST_TEST(not request->test());
+    // Rank 2 only sends after it has been woken up
+    com.send(true, 2);
+    request->wait();
+    BOOST_TEST(quietMessage == 42);
+    com.closeConnection();
+  } else if (rank == 1) {
+    com.requestConnectionAsClient("A", "B", {0}, rank);
+    for (int i = 0; i < 3; i++) {
+      com.send(i, 0);
+      int message = -1;
+      com.receive(message, 0);
+      BOOST_TEST(message == 2 * i);
+    }
+    com.closeConnection();
+  } else if (rank == 2) {
+    com.requestConnectionAsClient("A", "B", {0}, rank);
+    bool wakeUp = false;
+    com.receive(wakeUp, 0);
+    BOOST_TEST(wakeUp);
+    com.send(42, 0);
+    com.closeConnection();
+  }
+}
+
+/// Closing returns although the other side never reads the pending send
+BOOST_AUTO_TEST_CASE(CloseWithPendingSend,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  SharedMemoryCommunication com(".", 128);
+  const int                 rank = utils::Parallel::getProcessRank();
+
+  if (rank == 0) {
+    com.acceptConnection("process0", "process1", rank);
+    std::vector<double> data(1000, 1.0);
+    auto                request = com.aSend(data.data(), data.size(), 0);
+    com.closeConnection();
+    BOOST_TEST(request->test());
+  } else if (rank == 1) {
+    com.requestConnection("process0", "process1", 0, 1);
+    com.closeConnection();
+  }
+}
+
+/// Closing returns although the other side never sends the pending receive
+BOOST_AUTO_TEST_CASE(CloseWithPendingReceive,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  SharedMemoryCommunication com;
+  const int                 rank = utils::Parallel::getProcessRank();
+
+  if (rank == 0) {
+    com.acceptConnection("process0", "process1", rank);
+    int  message = -1;
+    auto request = com.aReceive(message, 0);
+    com.closeConnection();
+    BOOST_TEST(request->test());
+  } else if (rank == 1) {
+    com.requestConnection("process0", "process1", 0, 1);
+    com.closeConnection();
+  }
+}
+
+/// A left over address file naming a lobby which does not exist anymore is skipped
+BOOST_AUTO_TEST_CASE(StaleAddressFile,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  SharedMemoryCommunication com;
+  const int                 rank = utils::Parallel::getProcessRank();
+
+  if (rank == 0) {
+    {
+      utils::Publisher::ScopedChangePrefixDirectory scpd(".");
+      utils::Publisher                              p(".process1-process0.address");
+      p.write("/precice-stale-lobby");
+    }
+    utils::Parallel::synchronizeProcesses();
+    // Let the requester read the stale address first
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    com.acceptConnection("process0", "process1", rank);
+    com.send(42, 0);
+    com.closeConnection();
+  } else if (rank == 1) {
+    utils::Parallel::synchronizeProcesses();
+    com.requestConnection("process0", "process1", 0, 1);
+    int message = -1;
+    com.receive(message, 0);
+    BOOST_TEST(message == 42);
+    com.closeConnection();
+  } else {
+    utils::Parallel::synchronizeProcesses();
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemory
+BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -0,0 +1,45 @@
+#include "com/SharedMemorySegment.hpp"
+#include "testing/Testing.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace precice;
+using namespace precice::com;
+
+BOOST_AUTO_TEST_SUITE(CommunicationTests)
+
+BOOST_AUTO_TEST_SUITE(SharedMemorySegmentTests)
+
+BOOST_AUTO_TEST_CASE(CreateAndOpen)
+{
+  std::string name = "/precice-SharedMemorySegmentTest-" + std::to_string(getpid());
+  {
+    SharedMemorySegment owner(name, 4 * sizeof(double));
+    BOOST_TEST(owner.getName() == name);
+    BOOST_TEST(owner.size() == 4 * sizeof(double));
+    double *ownerValues = static_cast<double *>(owner.data());
+    ownerValues[3] = 3.0;
+
+    SharedMemorySegment other(name);
+    BOOST_TEST(other.size() == 4 * sizeof(double));
+    double *otherValues = static_cast<double *>(other.data());
+    BOOST_TEST(otherValues[3] == 3.0);
+    otherValues[0] = 1.0;
+    BOOST_TEST(ownerValues[0] == 1.0);
+  }
+  // The owner has removed the name
+  BOOST_TEST(shm_unlink(name.c_str()) == -1);
+}
+
+BOOST_AUTO_TEST_CASE(EmptySegment)
+{
+  std::string name = "/precice-SharedMemorySegmentTest-Empty-" + std::to_string(getpid());
+  SharedMemorySegment owner(name, 0);
+  BOOST_TEST(owner.size() == 0);
+  SharedMemorySegment other(name);
+  BOOST_TEST(other.size() / sizeof(double) == 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SharedMemorySegmentTests
+BOOST_AUTO_TEST_SUITE_END() // Communication
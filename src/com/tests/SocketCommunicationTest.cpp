@@ -56,6 +56,73 @@ BOOST_AUTO_TEST_CASE(SendReceiveFourProcessesServerClientV2,
   TestSendReceiveFourProcessesServerClientV2<SocketCommunication>();
 }
 
+BOOST_AUTO_TEST_CASE(BatchedSendAndReceive,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::SyncProcessesFixture>())
+{
+  SocketCommunication com(0, false, "lo", ".", 1 << 16);
+  const int rank = utils::Parallel::getProcessRank();
+
+  // larger than a batch, written together with the pending batch
+  std::vector<double> large(20000);
+  for (size_t i = 0; i < large.size(); i++) {
+    large[i] = i;
+  }
+
+  if (rank == 0) {
+    com.acceptConnection("process0", "process1", rank);
+    com.startBatch();
+    com.send(std::string("batched"), 0);
+    com.send(1, 0);
+    com.send(2.0, 0);
+    com.send(true, 0);
+    com.send(std::vector<int>{3, 4}, 0);
+    com.send(large, 0);
+    com.send(5, 0);
+    // implicitly flushes the batch
+    int reply = 0;
+    com.receive(reply, 0);
+    BOOST_TEST(reply == 6);
+
+    com.send(7, 0);
+    com.send(false, 0);
+    com.flush();
+    com.send(8.0, 0);
+    com.closeConnection();
+  } else if (rank == 1) {
+    com.requestConnection("process0", "process1", 0, 1);
+    std::string msg;
+    com.receive(msg, 0);
+    BOOST_TEST(msg == "batched");
+    int i = 0;
+    com.receive(i, 0);
+    BOOST_TEST(i == 1);
+    double d = 0.0;
+    com.receive(d, 0);
+    BOOST_TEST(d == 2.0);
+    bool b = false;
+    com.receive(b, 0);
+    BOOST_TEST(b == true);
+    std::vector<int> v;
+    com.receive(v, 0);
+    BOOST_TEST(v == std::vector<int>({3, 4}));
+    std::vector<double> received;
+    com.receive(received, 0);
+    BOOST_TEST(received == large, boost::test_tools::per_element());
+    com.receive(i, 0);
+    BOOST_TEST(i == 5);
+    com.send(6, 0);
+
+    com.receive(i, 0);
+    BOOST_TEST(i == 7);
+    com.receive(b, 0);
+    BOOST_TEST(b == false);
+    com.receive(d, 0);
+    BOOST_TEST(d == 8.0);
+    com.closeConnection();
+  }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END() // Socket
 BOOST_AUTO_TEST_SUITE_END() // Communication
@@ -1,11 +1,14 @@
 #include "BaseCouplingScheme.hpp"
 #include <Eigen/Core>
+#include <algorithm>
 #include <limits>
 #include <sstream>
 #include "com/Communication.hpp"
 #include "com/SharedPointer.hpp"
 #include "impl/ConvergenceMeasure.hpp"
 #include "impl/PostProcessing.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "io/TXTReader.hpp"
 #include "io/TXTWriter.hpp"
 #include "m2n/M2N.hpp"
@@ -89,9 +92,9 @@ BaseCouplingScheme::BaseCouplingScheme(
         "Valid digits of timestep length has to be between 1 and 16!");
   CHECK(_firstParticipant != _secondParticipant,
         "First participant and second participant must have different names! Called from BaseCoupling.");
-  if (dtMethod == constants::FIXED_DT) {
+  if (dtMethod == constants::FIXED_DT || dtMethod == constants::ADAPTIVE_DT) {
     CHECK(hasTimestepLength(),
-          "Timestep length value has to be given when the fixed timestep length method "
+          "Timestep length value has to be given when the fixed or adaptive timestep length method "
           << "is chosen for an implicit coupling scheme!");
   }
   if (localParticipant == _firstParticipant) {
@@ -99,9 +102,12 @@ BaseCouplingScheme::BaseCouplingScheme(
     if (dtMethod == constants::FIRST_PARTICIPANT_SETS_DT) {
       _participantSetsDt = true;
       setTimestepLength(UNDEFINED_TIMESTEP_LENGTH);
+    } else if (dtMethod == constants::ADAPTIVE_DT) {
+      _participantSetsDt   = true;
+      _participantAdaptsDt = true;
     }
   } else if (localParticipant == _secondParticipant) {
-    if (dtMethod == constants::FIRST_PARTICIPANT_SETS_DT) {
+    if (dtMethod == constants::FIRST_PARTICIPANT_SETS_DT || dtMethod == constants::ADAPTIVE_DT) {
       _participantReceivesDt = true;
     }
   } else {
@@ -113,9 +119,23 @@ BaseCouplingScheme::BaseCouplingScheme(
         "Maximal iteration limit has to be larger than zero!");
 }
 
+void BaseCouplingScheme::setAdaptiveTimestepLength(
+    double minTimestepLength,
+    double maxTimestepLength,
+    int    growIterations)
+{
+  TRACE(minTimestepLength, maxTimestepLength, growIterations);
+  CHECK(math::greater(minTimestepLength, 0.0) && math::greaterEquals(maxTimestepLength, minTimestepLength),
+        "The minimal timestep length has to be larger than zero and not larger than the maximal one!");
+  _minTimestepLength = minTimestepLength;
+  _maxTimestepLength = maxTimestepLength;
+  _growIterations    = growIterations;
+}
+
 void BaseCouplingScheme::receiveAndSetDt()
 {
   TRACE();
+  ScopedAdvanceTiming timing(_advanceTimings.receive);
   if (participantReceivesDt()) {
     double dt = UNDEFINED_TIMESTEP_LENGTH;
     getM2N()->receive(dt);
@@ -128,6 +148,7 @@ void BaseCouplingScheme::receiveAndSetDt()
 void BaseCouplingScheme::sendDt()
 {
   TRACE();
+  ScopedAdvanceTiming timing(_advanceTimings.send);
   if (participantSetsDt()) {
     DEBUG("sending timestep length of " << getComputedTimestepPart());
     getM2N()->send(getComputedTimestepPart());
@@ -137,12 +158,14 @@ void BaseCouplingScheme::sendDt()
 void BaseCouplingScheme::addDataToSend(
     mesh::PtrData data,
     mesh::PtrMesh mesh,
-    bool          initialize)
+    bool          initialize,
+    bool          singlePrecision)
 {
   TRACE();
   int id = data->getID();
   if (!utils::contained(id, _sendData)) {
     PtrCouplingData     ptrCplData(new CouplingData(&(data->values()), mesh, initialize, data->getDimensions()));
+    ptrCplData->singlePrecision = singlePrecision;
     DataMap::value_type pair = std::make_pair(id, ptrCplData);
     _sendData.insert(pair);
   } else {
@@ -153,12 +176,14 @@ void BaseCouplingScheme::addDataToSend(
 void BaseCouplingScheme::addDataToReceive(
     mesh::PtrData data,
     mesh::PtrMesh mesh,
-    bool          initialize)
+    bool          initialize,
+    bool          singlePrecision)
 {
   TRACE();
   int id = data->getID();
   if (!utils::contained(id, _receiveData)) {
     PtrCouplingData     ptrCplData(new CouplingData(&(data->values()), mesh, initialize, data->getDimensions()));
+    ptrCplData->singlePrecision = singlePrecision;
     DataMap::value_type pair = std::make_pair(id, ptrCplData);
     _receiveData.insert(pair);
   } else {
@@ -173,6 +198,7 @@ void BaseCouplingScheme::sendState(
   TRACE(rankReceiver);
   assertion(communication.get() != nullptr);
   assertion(communication->isConnected());
+  communication->startBatch();
   communication->send(_maxTime, rankReceiver);
   communication->send(_maxTimesteps, rankReceiver);
   communication->send(_timestepLength, rankReceiver);
@@ -191,6 +217,7 @@ void BaseCouplingScheme::sendState(
   communication->send(_iterations, rankReceiver);
   communication->send(_iterationsCoarseOptimization, rankReceiver); // new, correct?? TODO
   communication->send(_totalIterations, rankReceiver);
+  communication->flush();
 }
 
 void BaseCouplingScheme::receiveState(
@@ -227,9 +254,129 @@ void BaseCouplingScheme::receiveState(
   communication->receive(_totalIterations, rankSender);
 }
 
+void BaseCouplingScheme::exportState(
+    const std::string &filenamePrefix) const
+{
+  TRACE(filenamePrefix);
+  io::BinaryWriter writer(getCheckpointFilename(filenamePrefix));
+  writer.write(getCheckpointRanks());
+  writer.write(_timestepLength);
+  writer.write(_time);
+  writer.write(_timesteps);
+  writer.write(_computedTimestepPart);
+  writer.write(_isCouplingTimestepComplete);
+  writer.write(_hasDataBeenExchanged);
+  writer.write(_isCoarseModelOptimizationActive);
+  writer.write(_iterations);
+  writer.write(_iterationsCoarseOptimization);
+  writer.write(_totalIterations);
+  writer.write(_totalIterationsCoarseOptimization);
+  exportData(writer);
+  writer.write(_postProcessing.get() != nullptr);
+  if (_postProcessing.get() != nullptr) {
+    _postProcessing->exportState(writer);
+  }
+}
+
+void BaseCouplingScheme::importState(
+    const std::string &filenamePrefix)
+{
+  TRACE(filenamePrefix);
+  CHECK(_isInitialized, "A checkpoint can only be imported after initialize() has been called!");
+  std::string      filename = getCheckpointFilename(filenamePrefix);
+  io::BinaryReader reader(filename);
+  int              ranks = 0;
+  reader.read(ranks);
+  CHECK(ranks == getCheckpointRanks(),
+        "The checkpoint \"" << filename << "\" has been written by " << ranks << " ranks, but the participant runs on "
+        << getCheckpointRanks() << " ranks. A checkpoint can only be restored on the same decomposition.");
+  reader.read(_timestepLength);
+  reader.read(_time);
+  reader.read(_timesteps);
+  reader.read(_computedTimestepPart);
+  reader.read(_isCouplingTimestepComplete);
+  reader.read(_hasDataBeenExchanged);
+  reader.read(_isCoarseModelOptimizationActive);
+  reader.read(_iterations);
+  reader.read(_iterationsCoarseOptimization);
+  reader.read(_totalIterations);
+  reader.read(_totalIterationsCoarseOptimization);
+  importData(reader);
+  bool hasPostProcessing = false;
+  reader.read(hasPostProcessing);
+  CHECK(hasPostProcessing == (_postProcessing.get() != nullptr),
+        "The checkpoint \"" << filename << "\" does not match the configured post-processing!");
+  if (_postProcessing.get() != nullptr) {
+    _postProcessing->importState(reader);
+  }
+}
+
+std::string BaseCouplingScheme::getCheckpointFilename(
+    const std::string &filenamePrefix) const
+{
+  int rank = utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode ? utils::MasterSlave::_rank : 0;
+  return filenamePrefix + "-rank" + std::to_string(rank) + ".bin";
+}
+
+int BaseCouplingScheme::getCheckpointRanks() const
+{
+  return utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode ? utils::MasterSlave::_size : 1;
+}
+
+void BaseCouplingScheme::exportData(
+    io::BinaryWriter &writer) const
+{
+  writeCouplingData(writer, _sendData);
+  writeCouplingData(writer, _receiveData);
+}
+
+void BaseCouplingScheme::importData(
+    io::BinaryReader &reader)
+{
+  readCouplingData(reader, _sendData);
+  readCouplingData(reader, _receiveData);
+}
+
+void BaseCouplingScheme::writeCouplingData(
+    io::BinaryWriter &writer,
+    const DataMap &   data) const
+{
+  writer.write(static_cast<int>(data.size()));
+  for (const DataMap::value_type &pair : data) {
+    writer.write(pair.first);
+    writer.write(*pair.second->values);
+    writer.write(pair.second->oldValues);
+  }
+}
+
+void BaseCouplingScheme::readCouplingData(
+    io::BinaryReader &reader,
+    DataMap &         data)
+{
+  int size = 0;
+  reader.read(size);
+  CHECK(size == static_cast<int>(data.size()), "The checkpoint does not match the configured coupling data!");
+  for (DataMap::value_type &pair : data) {
+    int dataID = -1;
+    reader.read(dataID);
+    CHECK(dataID == pair.first, "The checkpoint does not match the configured coupling data!");
+    Eigen::VectorXd values;
+    Eigen::MatrixXd oldValues;
+    reader.read(values);
+    reader.read(oldValues);
+    CHECK(values.size() == pair.second->values->size() && oldValues.rows() == pair.second->oldValues.rows()
+              && oldValues.cols() == pair.second->oldValues.cols(),
+          "The checkpoint of data with ID " << dataID << " does not match the coupling data. "
+          << "A checkpoint can only be restored on the same decomposition of the coupling meshes.");
+    *pair.second->values   = values;
+    pair.second->oldValues = oldValues;
+  }
+}
+
 std::vector<int> BaseCouplingScheme::sendData(m2n::PtrM2N m2n)
 {
   TRACE();
+  ScopedAdvanceTiming timing(_advanceTimings.send);
 
   std::vector<int> sentDataIDs;
   assertion(m2n.get() != nullptr);
@@ -237,7 +384,7 @@ std::vector<int> BaseCouplingScheme::sendData(m2n::PtrM2N m2n)
   for (const DataMap::value_type &pair : _sendData) {
     //std::cout<<"\nsend data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
     int size = pair.second->values->size();
-    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+    m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision);
     sentDataIDs.push_back(pair.first);
   }
   DEBUG("Number of sent data sets = " << sentDataIDs.size());
@@ -248,6 +395,7 @@ std::vector<int> BaseCouplingScheme::receiveData(
     m2n::PtrM2N m2n)
 {
   TRACE();
+  ScopedAdvanceTiming timing(_advanceTimings.receive);
   std::vector<int> receivedDataIDs;
   assertion(m2n.get() != nullptr);
   assertion(m2n->isConnected());
@@ -255,7 +403,7 @@ std::vector<int> BaseCouplingScheme::receiveData(
   for (DataMap::value_type &pair : _receiveData) {
     int size = pair.second->values->size();
     //std::cout<<"\nreceive data id="<<pair.first<<": "<<*(pair.second->values)<<std::endl;
-    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+    m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision);
     receivedDataIDs.push_back(pair.first);
   }
   DEBUG("Number of received data sets = " << receivedDataIDs.size());
@@ -263,6 +411,88 @@ std::vector<int> BaseCouplingScheme::receiveData(
   return receivedDataIDs;
 }
 
+void BaseCouplingScheme::sendConvergenceAndData(
+    m2n::PtrM2N m2n,
+    bool        convergence)
+{
+  TRACE(convergence);
+  if (not canPiggybackConvergence(m2n, _sendData)) {
+    sendConvergenceFlags(m2n, convergence);
+    sendData(m2n);
+    return;
+  }
+
+  ScopedAdvanceTiming timing(_advanceTimings.send);
+  std::vector<double> flags = getConvergenceFlags(convergence);
+  for (const DataMap::value_type &pair : _sendData) {
+    int size = pair.second->values->size();
+    if (flags.empty()) {
+      m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision);
+    } else {
+      m2n->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision, flags);
+      flags.clear();
+    }
+  }
+}
+
+void BaseCouplingScheme::receiveConvergenceAndData(
+    m2n::PtrM2N m2n,
+    bool &      convergence)
+{
+  TRACE();
+  if (not canPiggybackConvergence(m2n, _receiveData)) {
+    {
+      ScopedAdvanceTiming timing(_advanceTimings.receive);
+      m2n->receive(convergence);
+      m2n->receive(_isCoarseModelOptimizationActive);
+    }
+    receiveData(m2n);
+    return;
+  }
+
+  ScopedAdvanceTiming timing(_advanceTimings.receive);
+  std::vector<double> flags(2);
+  bool                isFirst = true;
+  for (DataMap::value_type &pair : _receiveData) {
+    int size = pair.second->values->size();
+    if (isFirst) {
+      m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision, flags);
+      isFirst = false;
+    } else {
+      m2n->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision);
+    }
+  }
+  convergence                      = flags[0] != 0.0;
+  _isCoarseModelOptimizationActive = flags[1] != 0.0;
+  DEBUG("Received convergence = " << convergence << " with the data");
+}
+
+bool BaseCouplingScheme::canPiggybackConvergence(
+    m2n::PtrM2N    m2n,
+    const DataMap &data)
+{
+  assertion(m2n.get() != nullptr);
+  assertion(m2n->isConnected());
+  return not data.empty() && m2n->canSendHeader(data.begin()->second->mesh->getID());
+}
+
+std::vector<double> BaseCouplingScheme::getConvergenceFlags(
+    bool convergence) const
+{
+  return {convergence ? 1.0 : 0.0, _isCoarseModelOptimizationActive ? 1.0 : 0.0};
+}
+
+void BaseCouplingScheme::sendConvergenceFlags(
+    m2n::PtrM2N m2n,
+    bool        convergence)
+{
+  ScopedAdvanceTiming timing(_advanceTimings.send);
+  m2n->startBatch();
+  m2n->send(convergence);
+  m2n->send(_isCoarseModelOptimizationActive);
+  m2n->flush();
+}
+
 int BaseCouplingScheme::getVertexOffset(
     std::map<int, int> &vertexDistribution,
     int                 rank,
@@ -632,6 +862,7 @@ bool BaseCouplingScheme::measureConvergence(
     std::map<int, Eigen::VectorXd> &designSpecifications)
 {
   TRACE();
+  ScopedAdvanceTiming timing(_advanceTimings.convergenceMeasurement);
   assertion(not doesFirstStep());
   bool allConverged = true;
   bool oneSuffices  = false;
@@ -688,6 +919,7 @@ bool BaseCouplingScheme::measureConvergenceCoarseModelOptimization(
     std::map<int, Eigen::VectorXd> &designSpecifications)
 {
   TRACE();
+  ScopedAdvanceTiming timing(_advanceTimings.convergenceMeasurement);
   bool allConverged = true;
   bool oneSuffices  = false;
   assertion(_convergenceMeasures.size() > 0);
@@ -840,6 +1072,10 @@ void BaseCouplingScheme::updateTimeAndIterations(
     }
   } else {
 
+    if (_participantAdaptsDt && not manifoldmapping) {
+      adaptTimestepLength();
+    }
+
     _totalIterationsCoarseOptimization++;
     if (not manifoldmapping)
       _totalIterations++;
@@ -861,6 +1097,29 @@ void BaseCouplingScheme::timestepCompleted()
   }
 }
 
+void BaseCouplingScheme::adaptTimestepLength()
+{
+  TRACE(_iterations, _timestepLength);
+  if (math::equals(_minTimestepLength, UNDEFINED_TIMESTEP_LENGTH)) {
+    return;
+  }
+  double timestepLength = _timestepLength;
+  if (maxIterationsReached()) {
+    timestepLength *= 0.5;
+  } else if (_iterations <= _growIterations) {
+    timestepLength *= 2.0;
+  }
+  timestepLength = std::max(_minTimestepLength, std::min(_maxTimestepLength, timestepLength));
+  // Do not step beyond the end of the simulation
+  if (not math::equals(_maxTime, UNDEFINED_TIME) && math::greater(_maxTime, _time, _eps)) {
+    timestepLength = std::min(timestepLength, _maxTime - _time);
+  }
+  if (not math::equals(timestepLength, _timestepLength)) {
+    INFO("Timestep length adapted to " << timestepLength << " after " << _iterations << " iterations");
+    setTimestepLength(timestepLength);
+  }
+}
+
 bool BaseCouplingScheme::maxIterationsReached()
 {
   if (not _isCoarseModelOptimizationActive) {
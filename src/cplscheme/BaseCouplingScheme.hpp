@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <chrono>
 #include <set>
 #include "Constants.hpp"
 #include "CouplingData.hpp"
@@ -11,6 +12,15 @@
 #include "logging/Logger.hpp"
 #include "m2n/SharedPointer.hpp"
 
+namespace precice
+{
+namespace io
+{
+class BinaryWriter;
+class BinaryReader;
+}
+}
+
 namespace precice
 {
 namespace cplscheme
@@ -81,17 +91,23 @@ public:
    */
   //virtual PtrCouplingScheme addSchemeInParallel (PtrCouplingScheme scheme);
 
-  /// Adds data to be sent on data exchange and possibly be modified during coupling iterations.
+  /**
+   * @brief Adds data to be sent on data exchange and possibly be modified during coupling iterations.
+   *
+   * @param[in] singlePrecision If true, the data is transferred in single precision.
+   */
   void addDataToSend(
       mesh::PtrData data,
       mesh::PtrMesh mesh,
-      bool          initialize);
+      bool          initialize,
+      bool          singlePrecision = false);
 
-  /// Adds data to be received on data exchange.
+  /// Adds data to be received on data exchange, singlePrecision has to match the sender.
   void addDataToReceive(
       mesh::PtrData data,
       mesh::PtrMesh mesh,
-      bool          initialize);
+      bool          initialize,
+      bool          singlePrecision = false);
 
   /// Returns true, if initialize has been called.
   virtual bool isInitialized() const
@@ -212,6 +228,23 @@ public:
       com::PtrCommunication communication,
       int                   rankSender);
 
+  /**
+   * @brief Writes the state of the coupling scheme to a binary checkpoint.
+   *
+   * Every rank writes the file filenamePrefix-rankN.bin with the time and
+   * iteration counters, the values of its coupling data, and the state of
+   * the post-processing.
+   */
+  virtual void exportState(const std::string &filenamePrefix) const;
+
+  /**
+   * @brief Restores the state of the coupling scheme from a binary checkpoint.
+   *
+   * Has to be called after initialize(), with the same decomposition of the
+   * coupling meshes as the checkpoint has been written with.
+   */
+  virtual void importState(const std::string &filenamePrefix);
+
   /// Finalizes the coupling scheme.
   virtual void finalize();
 
@@ -232,6 +265,16 @@ public:
     return _isCoarseModelOptimizationActive;
   }
 
+  virtual AdvanceTimings getAdvanceTimings() const
+  {
+    return _advanceTimings;
+  }
+
+  virtual void resetAdvanceTimings()
+  {
+    _advanceTimings = AdvanceTimings();
+  }
+
   /**
    * @brief Sets order of predictor of interface values for first participant.
    *
@@ -246,6 +289,19 @@ public:
    */
   void setExtrapolationOrder(int order);
 
+  /**
+   * @brief Sets the bounds of an adaptive timestep length.
+   *
+   * With the adaptive timestepping method, the first participant doubles the timestep
+   * length after a timestep that converged within growIterations iterations, and halves
+   * it after a timestep that reached the maximum number of iterations. The second
+   * participant receives the timestep length.
+   */
+  void setAdaptiveTimestepLength(
+      double minTimestepLength,
+      double maxTimestepLength,
+      int    growIterations);
+
   typedef std::map<int, PtrCouplingData> DataMap; // move that back to protected
 
   void extrapolateData(DataMap &data);
@@ -267,6 +323,29 @@ protected:
   /// Sets whether the solver evaluates the fine or the coarse model representation
   bool _isCoarseModelOptimizationActive = false;
 
+  /// Times spent in the phases of advance() since the last reset
+  AdvanceTimings _advanceTimings;
+
+  /// Adds the wall-clock time of its lifetime to one of the advance timings.
+  class ScopedAdvanceTiming
+  {
+  public:
+    explicit ScopedAdvanceTiming(double &timing)
+        : _timing(timing),
+          _start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ~ScopedAdvanceTiming()
+    {
+      _timing += std::chrono::duration<double>(std::chrono::steady_clock::now() - _start).count();
+    }
+
+  private:
+    double &                              _timing;
+    std::chrono::steady_clock::time_point _start;
+  };
+
   /// Updates internal state of coupling scheme for next timestep.
   void timestepCompleted();
 
@@ -288,6 +367,30 @@ protected:
   /// Receives data receiveDataIDs given in mapCouplingData with communication.
   std::vector<int> receiveData(m2n::PtrM2N m2n);
 
+  /**
+   * @brief Sends the convergence flags and all send data to the other participant.
+   *
+   * The flags are piggybacked onto the first data, if canPiggybackConvergence().
+   * Otherwise, the masters exchange a separate message.
+   */
+  void sendConvergenceAndData(m2n::PtrM2N m2n, bool convergence);
+
+  /// Receives the convergence flags and all receive data, counterpart of sendConvergenceAndData().
+  void receiveConvergenceAndData(m2n::PtrM2N m2n, bool &convergence);
+
+  /**
+   * @brief Returns true, if the convergence flags can be sent along with the first of the given data.
+   *
+   * This requires that the communication of the first data reaches all ranks of both participants.
+   */
+  bool canPiggybackConvergence(m2n::PtrM2N m2n, const DataMap &data);
+
+  /// Returns convergence and _isCoarseModelOptimizationActive encoded as header of a data message.
+  std::vector<double> getConvergenceFlags(bool convergence) const;
+
+  /// Sends convergence and _isCoarseModelOptimizationActive as separate message from master to master.
+  void sendConvergenceFlags(m2n::PtrM2N m2n, bool convergence);
+
   /// Returns all data to be sent.
   const DataMap &getSendData() const
   {
@@ -479,6 +582,18 @@ protected:
 
   void advanceTXTWriters();
 
+  /// Writes the values of all coupling data of the scheme to a checkpoint.
+  virtual void exportData(io::BinaryWriter &writer) const;
+
+  /// Restores the values of all coupling data of the scheme from a checkpoint.
+  virtual void importData(io::BinaryReader &reader);
+
+  /// Writes the current and old values of the given coupling data to a checkpoint.
+  void writeCouplingData(io::BinaryWriter &writer, const DataMap &data) const;
+
+  /// Restores the current and old values of the given coupling data from a checkpoint.
+  void readCouplingData(io::BinaryReader &reader, DataMap &data);
+
   void updateTimeAndIterations(bool convergence, bool convergenceCoarseOptimization = true);
 
   int getMaxIterations() const
@@ -493,6 +608,9 @@ protected:
 
   bool maxIterationsReached();
 
+  /// Adapts the timestep length to the number of iterations of the converged timestep.
+  void adaptTimestepLength();
+
   /// Smallest number, taking validDigists into account: eps = std::pow(10.0, -1 * validDigits)
   const double _eps;
 
@@ -511,6 +629,16 @@ private:
   /// Determines, if the dt length is set received from the other participant
   bool _participantReceivesDt = false;
 
+  /// Determines, if the participant adapts the timestep length to the iteration numbers.
+  bool _participantAdaptsDt = false;
+
+  double _minTimestepLength = UNDEFINED_TIMESTEP_LENGTH;
+
+  double _maxTimestepLength = UNDEFINED_TIMESTEP_LENGTH;
+
+  /// Timesteps converging within this number of iterations let the timestep length grow.
+  int _growIterations = 0;
+
   mutable logging::Logger _log{"cplscheme::BaseCouplingScheme"};
 
   double _maxTime;
@@ -579,6 +707,12 @@ private:
   std::shared_ptr<io::TXTTableWriter> _convergenceWriter;
 
   int getVertexOffset(std::map<int, int> &vertexDistribution, int rank, int dim);
+
+  /// Returns the name of the checkpoint file of this rank.
+  std::string getCheckpointFilename(const std::string &filenamePrefix) const;
+
+  /// Returns the number of ranks of the participant, which write a checkpoint.
+  int getCheckpointRanks() const;
 };
 }
 } // namespace precice, cplscheme
@@ -1,6 +1,7 @@
 #include "CompositionalCouplingScheme.hpp"
 #include "Constants.hpp"
 #include <limits>
+#include <sstream>
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -215,6 +216,17 @@ bool CompositionalCouplingScheme:: hasTimestepLength() const
   return hasIt;
 }
 
+bool CompositionalCouplingScheme:: receivesDataOfNextWindow() const
+{
+  TRACE();
+  bool receivesIt = true;
+  for (Scheme scheme : _couplingSchemes) {
+    receivesIt &= scheme.scheme->receivesDataOfNextWindow();
+  }
+  DEBUG("return " << receivesIt);
+  return receivesIt;
+}
+
 double CompositionalCouplingScheme:: getTimestepLength() const
 {
   TRACE();
@@ -345,6 +357,26 @@ std::string CompositionalCouplingScheme:: printCouplingState() const
   return state;
 }
 
+CouplingScheme::AdvanceTimings CompositionalCouplingScheme:: getAdvanceTimings() const
+{
+  AdvanceTimings timings;
+  for (const Scheme& scheme : _couplingSchemes) {
+    AdvanceTimings schemeTimings = scheme.scheme->getAdvanceTimings();
+    timings.send                   += schemeTimings.send;
+    timings.receive                += schemeTimings.receive;
+    timings.postProcessing         += schemeTimings.postProcessing;
+    timings.convergenceMeasurement += schemeTimings.convergenceMeasurement;
+  }
+  return timings;
+}
+
+void CompositionalCouplingScheme:: resetAdvanceTimings()
+{
+  for (Scheme& scheme : _couplingSchemes) {
+    scheme.scheme->resetAdvanceTimings();
+  }
+}
+
 void CompositionalCouplingScheme:: sendState
 (
   com::PtrCommunication communication,
@@ -367,6 +399,34 @@ void CompositionalCouplingScheme:: receiveState
   }
 }
 
+void CompositionalCouplingScheme:: exportState
+(
+  const std::string& filenamePrefix ) const
+{
+  TRACE();
+  int enumerator = 0;
+  for (const Scheme& scheme : _couplingSchemes) {
+    std::ostringstream stream;
+    stream << filenamePrefix << "_" << enumerator;
+    scheme.scheme->exportState(stream.str());
+    enumerator++;
+  }
+}
+
+void CompositionalCouplingScheme:: importState
+(
+  const std::string& filenamePrefix )
+{
+  TRACE();
+  int enumerator = 0;
+  for (Scheme& scheme : _couplingSchemes) {
+    std::ostringstream stream;
+    stream << filenamePrefix << "_" << enumerator;
+    scheme.scheme->importState(stream.str());
+    enumerator++;
+  }
+}
+
 bool CompositionalCouplingScheme:: determineActiveCouplingSchemes()
 {
   TRACE();
@@ -843,34 +903,6 @@ void CompositionalCouplingScheme:: advanceActiveCouplingSchemes()
 //  return state;
 //}
 //
-//void CompositionalCouplingScheme:: exportState
-//(
-//  const std::string& filenamePrefix ) const
-//{
-//  TRACE();
-//  int enumerator = 0;
-//  for (PtrCouplingScheme couplingScheme : _couplingSchemes){
-//    std::ostringstream stream;
-//    stream << filenamePrefix << "_" << enumerator;
-//    couplingScheme->exportState(stream.str());
-//    enumerator++;
-//  }
-//}
-//
-//void CompositionalCouplingScheme:: importState
-//(
-//  const std::string& filenamePrefix )
-//{
-//  TRACE();
-//  int enumerator = 0;
-//  for (PtrCouplingScheme couplingScheme : _couplingSchemes){
-//    std::ostringstream stream;
-//    stream << filenamePrefix << "_" << enumerator;
-//    couplingScheme->importState(stream.str());
-//    enumerator++;
-//  }
-//}
-//
 //void CompositionalCouplingScheme:: sendState
 //(
 //  com::Communication::SharedPointer communication,
@@ -163,6 +163,9 @@ public:
    */
   virtual double getTimestepLength() const;
 
+  /// Returns true, if all coupling schemes in the composition receive data of the next time window.
+  virtual bool receivesDataOfNextWindow() const;
+
   /**
    * @brief Returns the remaining timestep length of the current time step.
    *
@@ -224,6 +227,12 @@ public:
   /// Returns a string representation of the current coupling state.
   virtual std::string printCouplingState() const;
 
+  /// Returns the sum of the advance timings of all coupling schemes.
+  virtual AdvanceTimings getAdvanceTimings() const;
+
+  /// Resets the advance timings of all coupling schemes.
+  virtual void resetAdvanceTimings();
+
   /**
    * @brief Send the state of the coupling scheme to another remote scheme.
    *
@@ -248,6 +257,12 @@ public:
    com::PtrCommunication communication,
    int                   rankSender );
 
+  /// Writes the checkpoints of all coupling schemes, enumerated after the prefix.
+  virtual void exportState(const std::string& filenamePrefix) const;
+
+  /// Restores the checkpoints of all coupling schemes, enumerated after the prefix.
+  virtual void importState(const std::string& filenamePrefix);
+
 private:
   mutable logging::Logger _log{"cplscheme::CompositionalCouplingScheme"};
 
@@ -15,7 +15,8 @@ const std::string& actionWriteInitialData();
 enum TimesteppingMethod
 {
   FIXED_DT,
-  FIRST_PARTICIPANT_SETS_DT
+  FIRST_PARTICIPANT_SETS_DT,
+  ADAPTIVE_DT
 };
 
 
@@ -26,6 +26,9 @@ struct CouplingData
   /// dimension of one data value (scalar=1, or vectorial=interface-dimension)
   int dimension;
 
+  /// True, if the data values are transferred in single precision between the participants.
+  bool singlePrecision = false;
+
   /**
    * @brief Default constructor, not to be used!
    *
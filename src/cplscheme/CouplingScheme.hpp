@@ -49,6 +49,22 @@ public:
   /// To be used, when the coupling timestep length is determined dynamically during the coupling.
   static const double UNDEFINED_TIMESTEP_LENGTH;
 
+  /// Wall-clock times spent in the phases of advance(), in seconds.
+  struct AdvanceTimings
+  {
+    /// Sending data and coupling state to the other participant(s)
+    double send = 0.0;
+
+    /// Receiving data and coupling state, including waiting for the other participant(s)
+    double receive = 0.0;
+
+    /// Computing new coupling iterates, e.g., the quasi-Newton update
+    double postProcessing = 0.0;
+
+    /// Measuring the convergence of the coupling iteration
+    double convergenceMeasurement = 0.0;
+  };
+
   virtual ~CouplingScheme() {}
 
   /**
@@ -139,12 +155,31 @@ public:
   virtual double getTimestepLength() const =0;
 
 
+  /**
+   * @brief Returns true, if data received at the end of a time window belongs to the next one.
+   *
+   * Otherwise, it belongs to the completed time window. Defaults to false.
+   */
+  virtual bool receivesDataOfNextWindow() const
+  {
+    return false;
+  }
+
   /// Defaults to false, i.e., no multilevel PP
   virtual bool isCoarseModelOptimizationActive()
   {
     return false;
   }
 
+  /// Returns the times accumulated since the last call of resetAdvanceTimings().
+  virtual AdvanceTimings getAdvanceTimings() const
+  {
+    return AdvanceTimings();
+  }
+
+  /// Sets all times returned by getAdvanceTimings() to zero.
+  virtual void resetAdvanceTimings() {}
+
   /**
    * @brief Returns the remaining timestep length of the current time step.
    *
@@ -214,6 +249,23 @@ public:
     com::PtrCommunication communication,
     int                   rankSender ) =0;
 
+  /**
+   * @brief Writes the state of the coupling scheme to a binary checkpoint.
+   *
+   * Every rank writes its own file, whose name starts with the given prefix.
+   * Next to the time and iteration counters, the checkpoint holds the values
+   * of the coupling data and the state of the post-processing.
+   */
+  virtual void exportState(const std::string& filenamePrefix) const =0;
+
+  /**
+   * @brief Restores the state of the coupling scheme from a binary checkpoint.
+   *
+   * Has to be called after initialize(), with the same decomposition of the
+   * coupling meshes as the checkpoint has been written with.
+   */
+  virtual void importState(const std::string& filenamePrefix) =0;
+
 };
 
 }} // namespace precice, cplscheme
@@ -1,5 +1,6 @@
 #include "MultiCouplingScheme.hpp"
 #include "impl/PostProcessing.hpp"
+#include "impl/MMPostProcessing.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/MasterSlave.hpp"
@@ -55,6 +56,17 @@ void MultiCouplingScheme::initialize
           "For parallel coupling, the number of coupling data vectors has to be at least 3, not: "
           << getPostProcessing()->getDataIDs().size());
     getPostProcessing()->initialize(_allData); // Reserve memory, initialize
+    auto manifoldMapping = std::dynamic_pointer_cast<impl::MMPostProcessing>(getPostProcessing());
+    if (manifoldMapping.get() != nullptr) {
+      // advance() finds the coarse data of fine data at an offset of the number of fine data
+      std::vector<int> fineIDs   = manifoldMapping->getDataIDs();
+      std::vector<int> coarseIDs = manifoldMapping->getCoarseDataIDs();
+      for (size_t i = 0; i < fineIDs.size(); i++) {
+        CHECK(coarseIDs.at(i) == fineIDs[i] + static_cast<int>(fineIDs.size()),
+              "The coarse data of manifold mapping have to be defined after the fine data, in the same order. "
+              << "Coarse data with ID " << coarseIDs.at(i) << " does not belong to fine data with ID " << fineIDs[i]);
+      }
+    }
   }
 
 
@@ -147,46 +159,92 @@ void MultiCouplingScheme::advance()
   setHasDataBeenExchanged(false);
   setIsCouplingTimestepComplete(false);
   bool convergence = false;
+  bool convergenceCoarseOptimization = true;
+  bool doOnlySolverEvaluation = false;
   if (math::equals(getThisTimestepRemainder(), 0.0, _eps)) {
     DEBUG("Computed full length of iteration");
 
     receiveData();
 
-    auto designSpecifications = getPostProcessing()->getDesignSpecification(_allData);
-    convergence = measureConvergence(designSpecifications);
+    std::map<int, Eigen::VectorXd> designSpecifications;
+    if (getPostProcessing().get() != nullptr) {
+      designSpecifications = getPostProcessing()->getDesignSpecification(_allData);
+    }
+
+    // in case of multilevel post processing, all participants evaluate their coarse models
+    // until the coarse model optimization converged, the fine models are evaluated afterwards
+    if (_isCoarseModelOptimizationActive) {
+      DEBUG("measure convergence of coarse model optimization.");
+      convergenceCoarseOptimization = measureConvergenceCoarseModelOptimization(designSpecifications);
+      // Stop, when maximal iteration count (given in config) is reached
+      if (maxIterationsReached()) {
+        convergenceCoarseOptimization = true;
+      }
+      convergence = false;
+      // after convergence of the coarse model optimization, the fine models are evaluated
+      // for its solution, without post-processing
+      _isCoarseModelOptimizationActive = not convergenceCoarseOptimization;
+      doOnlySolverEvaluation = convergenceCoarseOptimization;
+    }
+    else {
+      convergence = measureConvergence(designSpecifications);
+      // Stop, when maximal iteration count (given in config) is reached
+      if (maxIterationsReached()) {
+        convergence = true;
+      }
+    }
+
+    // passed by reference, modified in MM post processing. No-op for all other post-processings
+    if (getPostProcessing().get() != nullptr) {
+      getPostProcessing()->setCoarseModelOptimizationActive(&_isCoarseModelOptimizationActive);
+    }
 
-    // Stop, when maximal iteration count (given in config) is reached
-    if (maxIterationsReached()) {
-      convergence = true;
+    if (doOnlySolverEvaluation) {
+      // if the coarse model optimization converged within its first iteration, no post-processing
+      // registered the coarse solution as input of the fine models.
+      // ATTENTION: assumes that coarse data is defined after fine data in same ordering, checked in initialize().
+      if (_iterationsCoarseOptimization == 1 && getPostProcessing().get() != nullptr) {
+        auto fineIDs = getPostProcessing()->getDataIDs();
+        for (auto& fineID : fineIDs) {
+          *_allData.at(fineID)->values = _allData.at(fineID + fineIDs.size())->oldValues.col(0);
+        }
+      }
     }
-    if (convergence) {
+    else if (convergence) {
       if (getPostProcessing().get() != nullptr) {
+        ScopedAdvanceTiming timing(_advanceTimings.postProcessing);
+        _deletedColumnsPPFiltering = getPostProcessing()->getDeletedColumns();
         getPostProcessing()->iterationsConverged(_allData);
       }
       newConvergenceMeasurements();
       timestepCompleted();
     }
     else if (getPostProcessing().get() != nullptr) {
+      ScopedAdvanceTiming timing(_advanceTimings.postProcessing);
       getPostProcessing()->performPostProcessing(_allData);
     }
 
-    for (m2n::PtrM2N m2n : _communications) {
-      m2n->send(convergence);
-      assertion(not _isCoarseModelOptimizationActive);
-      m2n->send(_isCoarseModelOptimizationActive); //need to do this to match with ParallelCplScheme
+    // the flags go with the data to all partners which are reached by it
+    for (size_t i = 0; i < _communications.size(); i++) {
+      if (not canPiggybackConvergence(_communications[i], _sendDataVector[i])) {
+        sendConvergenceFlags(_communications[i], convergence);
+      }
     }
 
-    if (convergence && (getExtrapolationOrder() > 0)){
-      extrapolateData(_allData); // Also stores data
-    }
-    else { // Store data for conv. measurement, post-processing, or extrapolation
-      for (DataMap::value_type& pair : _allData) {
-        if (pair.second->oldValues.size() > 0){
-          pair.second->oldValues.col(0) = *pair.second->values;
+    // the old values of the last coarse model evaluation are kept for the post-processing
+    if (not doOnlySolverEvaluation) {
+      if (convergence && (getExtrapolationOrder() > 0)){
+        extrapolateData(_allData); // Also stores data
+      }
+      else { // Store data for conv. measurement, post-processing, or extrapolation
+        for (DataMap::value_type& pair : _allData) {
+          if (pair.second->oldValues.size() > 0){
+            pair.second->oldValues.col(0) = *pair.second->values;
+          }
         }
       }
     }
-    sendData();
+    sendData(getConvergenceFlags(convergence));
 
     if (not convergence) {
       DEBUG("No convergence achieved");
@@ -196,7 +254,7 @@ void MultiCouplingScheme::advance()
       DEBUG("Convergence achieved");
       advanceTXTWriters();
     }
-    updateTimeAndIterations(convergence);
+    updateTimeAndIterations(convergence, convergenceCoarseOptimization);
     setHasDataBeenExchanged(true);
     setComputedTimestepPart(0.0);
   } // subcycling complete
@@ -216,16 +274,28 @@ void MultiCouplingScheme::mergeData()
   }
 }
 
+void MultiCouplingScheme::exportData(io::BinaryWriter &writer) const
+{
+  writeCouplingData(writer, _allData);
+}
+
+void MultiCouplingScheme::importData(io::BinaryReader &reader)
+{
+  readCouplingData(reader, _allData);
+}
+
 void MultiCouplingScheme:: addDataToSend
 (
   mesh::PtrData data,
   mesh::PtrMesh mesh,
   bool          initialize,
-  int           index)
+  int           index,
+  bool          singlePrecision)
 {
   int id = data->getID();
   if(! utils::contained(id, _sendDataVector[index])) {
     PtrCouplingData ptrCplData (new CouplingData(& (data->values()), mesh, initialize, data->getDimensions()));
+    ptrCplData->singlePrecision = singlePrecision;
     DataMap::value_type pair = std::make_pair (id, ptrCplData);
     _sendDataVector[index].insert(pair);
   }
@@ -241,11 +311,13 @@ void MultiCouplingScheme:: addDataToReceive
   mesh::PtrData data,
   mesh::PtrMesh mesh,
   bool          initialize,
-  int           index)
+  int           index,
+  bool          singlePrecision)
 {
   int id = data->getID();
   if(! utils::contained(id, _receiveDataVector[index])) {
     PtrCouplingData ptrCplData (new CouplingData(& (data->values()), mesh, initialize, data->getDimensions()));
+    ptrCplData->singlePrecision = singlePrecision;
     DataMap::value_type pair = std::make_pair (id, ptrCplData);
     _receiveDataVector[index].insert(pair);
   }
@@ -256,18 +328,38 @@ void MultiCouplingScheme:: addDataToReceive
   }
 }
 
-void MultiCouplingScheme:: sendData()
+void MultiCouplingScheme:: setConcurrentExchange
+(
+  bool concurrentExchange )
+{
+  _concurrentExchange = concurrentExchange;
+}
+
+void MultiCouplingScheme:: sendData
+(
+  const std::vector<double>& convergenceFlags )
 {
   TRACE();
+  ScopedAdvanceTiming timing(_advanceTimings.send);
+
+  if (_concurrentExchange) {
+    sendDataConcurrently(convergenceFlags);
+    return;
+  }
 
   for(size_t i=0;i<_communications.size();i++){
     assertion(_communications[i].get() != nullptr);
     assertion(_communications[i]->isConnected());
 
+    bool withFlags = not convergenceFlags.empty() && canPiggybackConvergence(_communications[i], _sendDataVector[i]);
     for (DataMap::value_type& pair : _sendDataVector[i]) {
       int size = pair.second->values->size();
-      if (size > 0) {
-        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+      if (withFlags) {
+        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision, convergenceFlags);
+        withFlags = false;
+      }
+      else if (size > 0) {
+        _communications[i]->send(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision);
       }
     }
   }
@@ -276,6 +368,12 @@ void MultiCouplingScheme:: sendData()
 void MultiCouplingScheme:: receiveData()
 {
   TRACE();
+  ScopedAdvanceTiming timing(_advanceTimings.receive);
+
+  if (_concurrentExchange) {
+    receiveDataConcurrently();
+    return;
+  }
 
   for(size_t i=0;i<_communications.size();i++){
     assertion(_communications[i].get() != nullptr);
@@ -284,12 +382,91 @@ void MultiCouplingScheme:: receiveData()
     for (DataMap::value_type& pair : _receiveDataVector[i]) {
       int size = pair.second->values->size();
       if (size > 0) {
-        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension);
+        _communications[i]->receive(pair.second->values->data(), size, pair.second->mesh->getID(), pair.second->dimension, pair.second->singlePrecision);
       }
     }
   }
 }
 
+void MultiCouplingScheme:: sendDataConcurrently
+(
+  const std::vector<double>& convergenceFlags )
+{
+  TRACE();
+  // The data of one partner is sent in the same order as in sendData(), only the
+  // transfers to different partners overlap. The first data may carry the convergence flags.
+  std::vector<DataMap::iterator> nextData;
+  std::vector<bool> withFlags;
+  for(size_t i=0;i<_communications.size();i++){
+    assertion(_communications[i].get() != nullptr);
+    assertion(_communications[i]->isConnected());
+    nextData.push_back(_sendDataVector[i].begin());
+    withFlags.push_back(not convergenceFlags.empty() && canPiggybackConvergence(_communications[i], _sendDataVector[i]));
+  }
+
+  bool dataLeft = true;
+  while (dataLeft) {
+    for(size_t i=0;i<_communications.size();i++){
+      if (nextData[i] != _sendDataVector[i].end()) {
+        CouplingData& data = *nextData[i]->second;
+        int size = data.values->size();
+        if (withFlags[i]) {
+          _communications[i]->startSend(data.values->data(), size, data.mesh->getID(), data.dimension, data.singlePrecision, convergenceFlags);
+        }
+        else if (size > 0) {
+          _communications[i]->startSend(data.values->data(), size, data.mesh->getID(), data.dimension, data.singlePrecision);
+        }
+      }
+    }
+    dataLeft = false;
+    for(size_t i=0;i<_communications.size();i++){
+      if (nextData[i] != _sendDataVector[i].end()) {
+        CouplingData& data = *nextData[i]->second;
+        if (withFlags[i] || (data.values->size() > 0)) {
+          _communications[i]->completeSend(data.mesh->getID());
+        }
+        withFlags[i] = false;
+        ++nextData[i];
+        dataLeft |= nextData[i] != _sendDataVector[i].end();
+      }
+    }
+  }
+}
+
+void MultiCouplingScheme:: receiveDataConcurrently()
+{
+  TRACE();
+  std::vector<DataMap::iterator> nextData;
+  for(size_t i=0;i<_communications.size();i++){
+    assertion(_communications[i].get() != nullptr);
+    assertion(_communications[i]->isConnected());
+    nextData.push_back(_receiveDataVector[i].begin());
+  }
+
+  bool dataLeft = true;
+  while (dataLeft) {
+    for(size_t i=0;i<_communications.size();i++){
+      if (nextData[i] != _receiveDataVector[i].end()) {
+        CouplingData& data = *nextData[i]->second;
+        int size = data.values->size();
+        if (size > 0) {
+          _communications[i]->startReceive(data.values->data(), size, data.mesh->getID(), data.dimension, data.singlePrecision);
+        }
+      }
+    }
+    dataLeft = false;
+    for(size_t i=0;i<_communications.size();i++){
+      if (nextData[i] != _receiveDataVector[i].end()) {
+        CouplingData& data = *nextData[i]->second;
+        if (data.values->size() > 0) {
+          _communications[i]->completeReceive(data.mesh->getID());
+        }
+        ++nextData[i];
+        dataLeft |= nextData[i] != _receiveDataVector[i].end();
+      }
+    }
+  }
+}
 
 void MultiCouplingScheme::setupConvergenceMeasures()
 {
@@ -33,22 +33,45 @@ public:
     mesh::PtrData data,
     mesh::PtrMesh mesh,
     bool          initialize,
-    int           index);
+    int           index,
+    bool          singlePrecision = false);
 
   /// Adds data to be received on data exchange.
   void addDataToReceive (
     mesh::PtrData data,
     mesh::PtrMesh mesh,
     bool          initialize,
-    int           index);
+    int           index,
+    bool          singlePrecision = false);
+
+  /**
+   * @brief Exchanges data with all coupling partners concurrently.
+   *
+   * Per data field, the transfers to and from all partners are started before waiting for
+   * any of them, instead of completing the exchange with one partner before the next.
+   */
+  void setConcurrentExchange(bool concurrentExchange);
 
 protected:
   /// merges send and receive data into one map (for parallel post-processing)
   virtual void mergeData();
 
+  /// Writes the values of the coupling data of all partners to a checkpoint.
+  virtual void exportData(io::BinaryWriter &writer) const;
+
+  /// Restores the values of the coupling data of all partners from a checkpoint.
+  virtual void importData(io::BinaryReader &reader);
+
 private:
-  void sendData();
+  /// Sends the data to all partners, the convergence flags (if not empty) go with the first data.
+  void sendData(const std::vector<double>& convergenceFlags = std::vector<double>());
   void receiveData();
+
+  /// Sends the n-th data of all partners at once, for increasing n.
+  void sendDataConcurrently(const std::vector<double>& convergenceFlags);
+
+  /// Receives the n-th data of all partners at once, for increasing n.
+  void receiveDataConcurrently();
   void setupConvergenceMeasures();
   CouplingData* getData ( int dataID );
 
@@ -61,6 +84,8 @@ private:
   std::vector<DataMap> _receiveDataVector;
   std::vector<DataMap> _sendDataVector;
 
+  /// Exchange data with all coupling partners concurrently
+  bool _concurrentExchange = false;
 
 };
 
@@ -4,6 +4,8 @@
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/MasterSlave.hpp"
 #include "math/math.hpp"
+#include <cmath>
+#include <map>
 
 namespace precice {
 namespace cplscheme {
@@ -33,6 +35,16 @@ ParallelCouplingScheme::ParallelCouplingScheme
   }
 }
 
+void ParallelCouplingScheme::setSpeculation
+(
+  double limit )
+{
+  CHECK(_couplingMode == Implicit, "Speculative coupling iterations require an implicit coupling scheme!");
+  CHECK(math::greaterEquals(limit, 0.0), "The speculation limit must not be negative!");
+  _speculative      = true;
+  _speculationLimit = limit;
+}
+
 void ParallelCouplingScheme::initialize
 (
   double startTime,
@@ -207,13 +219,25 @@ void ParallelCouplingScheme::implicitAdvance()
   if (math::equals(getThisTimestepRemainder(), 0.0, _eps)) {
     DEBUG("Computed full length of iteration");
     if (doesFirstStep()) { //First participant
+      if (_speculationPending) {
+        _speculationPending = false;
+        if (not acceptSpeculation()) {
+          // Repeat the iteration with the post-processed values, the second participant
+          // waits for the data of the repeated iteration.
+          INFO("Speculative iteration rejected");
+          requireAction(constants::actionReadIterationCheckpoint());
+          setTime(getTime() - getComputedTimestepPart());
+          setHasDataBeenExchanged(true);
+          setComputedTimestepPart(0.0);
+          return;
+        }
+      }
       sendData(getM2N());
-      getM2N()->receive(convergence);
-      getM2N()->receive(_isCoarseModelOptimizationActive);
+      receiveConvergenceAndData(getM2N(), convergence);
       if (convergence) {
         timestepCompleted();
       }
-      receiveData(getM2N());
+      _speculationPending = _speculative && not convergence;
     }
     else { // second participant
       receiveData(getM2N());
@@ -259,6 +283,11 @@ void ParallelCouplingScheme::implicitAdvance()
         getPostProcessing()->setCoarseModelOptimizationActive(&_isCoarseModelOptimizationActive);
       }
 
+      // The first participant continues with the values before the post-processing
+      bool speculate = _speculative && not convergence;
+      if (speculate) {
+        sendConvergenceAndData(getM2N(), convergence);
+      }
 
       // for multi-level case, i.e., manifold mapping: after convergence of coarse problem
       // we only want to evaluate the fine model for the new input, no post-processing etc..
@@ -266,6 +295,7 @@ void ParallelCouplingScheme::implicitAdvance()
       {
         if (convergence) {
           if (getPostProcessing().get() != nullptr) {
+            ScopedAdvanceTiming timing(_advanceTimings.postProcessing);
             _deletedColumnsPPFiltering = getPostProcessing()->getDeletedColumns();
             getPostProcessing()->iterationsConverged(getAllData());
           }
@@ -273,6 +303,7 @@ void ParallelCouplingScheme::implicitAdvance()
           timestepCompleted();
         }
         else if (getPostProcessing().get() != nullptr) {
+          ScopedAdvanceTiming timing(_advanceTimings.postProcessing);
           getPostProcessing()->performPostProcessing(getAllData());
         }
 
@@ -308,10 +339,11 @@ void ParallelCouplingScheme::implicitAdvance()
        }
      }
 
-      getM2N()->send(convergence);
-      getM2N()->send(_isCoarseModelOptimizationActive);
-
-      sendData(getM2N());
+      if (speculate) {
+        sendData(getM2N());
+      } else {
+        sendConvergenceAndData(getM2N(), convergence);
+      }
     }
 
     // both participants
@@ -340,4 +372,26 @@ void ParallelCouplingScheme::mergeData()
   _allData.insert(getReceiveData().begin(), getReceiveData().end());
 }
 
+bool ParallelCouplingScheme::acceptSpeculation()
+{
+  TRACE();
+  std::map<int, Eigen::VectorXd> speculativeValues;
+  for (DataMap::value_type& pair : getReceiveData()) {
+    speculativeValues[pair.first] = *pair.second->values;
+  }
+  receiveData(getM2N());
+
+  double differenceNorm2 = 0.0;
+  double norm2 = 0.0;
+  for (DataMap::value_type& pair : getReceiveData()) {
+    const Eigen::VectorXd& values = *pair.second->values;
+    double difference = utils::MasterSlave::l2norm(values - speculativeValues[pair.first]);
+    double norm       = utils::MasterSlave::l2norm(values);
+    differenceNorm2 += difference * difference;
+    norm2           += norm * norm;
+  }
+  DEBUG("Speculation difference " << std::sqrt(differenceNorm2) << ", norm " << std::sqrt(norm2));
+  return std::sqrt(differenceNorm2) <= _speculationLimit * std::sqrt(norm2);
+}
+
 }}
@@ -34,6 +34,18 @@ public:
 
   virtual void advance();
 
+  /**
+   * @brief Lets the first participant start the next coupling iteration speculatively.
+   *
+   * If an implicit timestep has not converged, the second participant sends the values
+   * before the post-processing first and the post-processed values afterwards. The first
+   * participant continues with the values before the post-processing and checks the
+   * post-processed values on its next advance. If they differ by more than the given limit,
+   * relative to their norm, the iteration is rolled back and repeated with the
+   * post-processed values, using the iteration checkpoint actions.
+   */
+  void setSpeculation(double limit);
+
 
 protected:
   /// merges send and receive data into one map (for parallel post-processing)
@@ -56,6 +68,22 @@ private:
   virtual void explicitAdvance();
 
   virtual void implicitAdvance();
+
+  /**
+   * @brief Receives the post-processed values of a speculative iteration on the first participant.
+   *
+   * @return True, if the values used by the speculative iteration are close enough.
+   */
+  bool acceptSpeculation();
+
+  /// Start the next coupling iteration before the post-processing is done
+  bool _speculative = false;
+
+  /// Largest relative difference of a speculative iteration to the post-processed values
+  double _speculationLimit = 0.0;
+
+  /// The first participant has yet to receive the post-processed values of the last iteration
+  bool _speculationPending = false;
 };
 
 }}
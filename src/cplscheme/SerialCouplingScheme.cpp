@@ -199,14 +199,10 @@ void SerialCouplingScheme::advance()
       if (doesFirstStep()) {
         sendDt();
         sendData(getM2N());
-        getM2N()->receive(convergence);
-        getM2N()->receive(_isCoarseModelOptimizationActive);
+        receiveConvergenceAndData(getM2N(), convergence);
         if (convergence) {
           timestepCompleted();
         }
-        //if (isCouplingOngoing()) {
-        receiveData(getM2N());
-        //}
         setHasDataBeenExchanged(true);
       }
       else {
@@ -259,6 +255,7 @@ void SerialCouplingScheme::advance()
           // coupling iteration converged for current time step. Advance in time.
           if (convergence) {
             if (getPostProcessing().get() != nullptr) {
+              ScopedAdvanceTiming timing(_advanceTimings.postProcessing);
               _deletedColumnsPPFiltering = getPostProcessing()->getDeletedColumns();
               getPostProcessing()->iterationsConverged(getSendData());
             }
@@ -267,6 +264,7 @@ void SerialCouplingScheme::advance()
 
             // no convergence achieved for the coupling iteration within the current time step
           } else if (getPostProcessing().get() != nullptr) {
+            ScopedAdvanceTiming timing(_advanceTimings.postProcessing);
             getPostProcessing()->performPostProcessing(getSendData());
           }
 
@@ -314,12 +312,8 @@ void SerialCouplingScheme::advance()
           }
         }
 
-        getM2N()->send(convergence);
-
-        getM2N()->send(_isCoarseModelOptimizationActive);
+        sendConvergenceAndData(getM2N(), convergence);
 
-        sendData(getM2N());
-        
         // the second participant does not want new data in the last iteration of the last timestep
         if (isCouplingOngoing() || not convergence) {
           receiveAndSetDt();
@@ -55,6 +55,12 @@ public:
 
   virtual void advance();
 
+  /// The second participant receives the data of the first one for the time window it computes next.
+  virtual bool receivesDataOfNextWindow() const
+  {
+    return not doesFirstStep();
+  }
+
   logging::Logger _log{"cplschemes::SerialCouplingSchemes"};
 
   friend struct CplSchemeTests::SerialImplicitCouplingSchemeTests::testExtrapolateData;  // For whitebox tests
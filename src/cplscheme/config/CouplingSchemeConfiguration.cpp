@@ -1,4 +1,5 @@
 #include "CouplingSchemeConfiguration.hpp"
+#include <limits>
 #include "cplscheme/CompositionalCouplingScheme.hpp"
 #include "cplscheme/MultiCouplingScheme.hpp"
 #include "cplscheme/ParallelCouplingScheme.hpp"
@@ -30,6 +31,9 @@ namespace cplscheme
 
 using precice::impl::PtrParticipant;
 
+/// Smallest relative convergence limit that is resolved by data exchanged in single precision.
+const double SINGLE_PRECISION_LIMIT = 10.0 * std::numeric_limits<float>::epsilon();
+
 CouplingSchemeConfiguration::CouplingSchemeConfiguration(
     xml::XMLTag &                               parent,
     const mesh::PtrMeshConfiguration &          meshConfig,
@@ -66,6 +70,13 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       ATTR_SUFFICES("suffices"),
       ATTR_CONTROL("control"),
       ATTR_LEVEL("level"),
+      ATTR_PRECISION("precision"),
+      ATTR_CONCURRENT_EXCHANGE("concurrent-exchange"),
+      ATTR_MIN_VALUE("min-value"),
+      ATTR_MAX_VALUE("max-value"),
+      ATTR_GROW_ITERATIONS("grow-iterations"),
+      ATTR_SPECULATION_LIMIT("speculation-limit"),
+      ATTR_WAVEFORM_SAMPLES("waveform-samples"),
       VALUE_SERIAL_EXPLICIT("serial-explicit"),
       VALUE_PARALLEL_EXPLICIT("parallel-explicit"),
       VALUE_SERIAL_IMPLICIT("serial-implicit"),
@@ -73,6 +84,9 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
       VALUE_MULTI("multi"),
       VALUE_FIXED("fixed"),
       VALUE_FIRST_PARTICIPANT("first-participant"),
+      VALUE_ADAPTIVE("adaptive"),
+      VALUE_DOUBLE("double"),
+      VALUE_SINGLE("single"),
       _config(),
       _meshConfig(meshConfig),
       _m2nConfig(m2nConfig),
@@ -114,6 +128,14 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
     doc = "Parallel Implicit coupling scheme according to block Jacobi iterations (V-System).";
     doc += " Improved implicit iterations are achieved by using a post-processing (recommended!).";
     tag.setDocumentation(doc);
+    XMLAttribute<double> attrSpeculationLimit(ATTR_SPECULATION_LIMIT);
+    doc = "If given, the first participant starts the next coupling iteration with the values ";
+    doc += "before the post-processing, while the second participant computes the post-processing. ";
+    doc += "If the post-processed values differ by more than this limit relative to their norm, ";
+    doc += "the iteration is repeated with the post-processed values.";
+    attrSpeculationLimit.setDocumentation(doc);
+    attrSpeculationLimit.setDefaultValue(-1.0);
+    tag.addAttribute(attrSpeculationLimit);
     addTypespecifcSubtags(VALUE_PARALLEL_IMPLICIT, tag);
     tags.push_back(tag);
   }
@@ -122,6 +144,12 @@ CouplingSchemeConfiguration::CouplingSchemeConfiguration(
     doc = "Multi coupling scheme according to block Jacobi iterations.";
     doc += " Improved implicit iterations are achieved by using a post-processing (recommended!).";
     tag.setDocumentation(doc);
+    XMLAttribute<bool> attrConcurrentExchange(ATTR_CONCURRENT_EXCHANGE);
+    doc = "If true, the controller exchanges data with all other participants concurrently, ";
+    doc += "instead of completing the exchange with one participant before starting the next.";
+    attrConcurrentExchange.setDocumentation(doc);
+    attrConcurrentExchange.setDefaultValue(false);
+    tag.addAttribute(attrConcurrentExchange);
     addTypespecifcSubtags(VALUE_MULTI, tag);
     tags.push_back(tag);
   }
@@ -146,6 +174,16 @@ const PtrCouplingScheme &CouplingSchemeConfiguration::getCouplingScheme(
   return _couplingSchemes.find(participantName)->second;
 }
 
+std::vector<mesh::PtrData> CouplingSchemeConfiguration::getWaveformSamples(
+    int dataID) const
+{
+  auto samples = _waveformSamples.find(dataID);
+  if (samples == _waveformSamples.end()) {
+    return std::vector<mesh::PtrData>();
+  }
+  return samples->second;
+}
+
 void CouplingSchemeConfiguration::xmlTagCallback(
     xml::XMLTag &tag)
 {
@@ -153,6 +191,11 @@ void CouplingSchemeConfiguration::xmlTagCallback(
   if (tag.getNamespace() == TAG) {
     _config.type = tag.getName();
     _postProcConfig->clear();
+    if (_config.type == VALUE_MULTI) {
+      _config.concurrentExchange = tag.getBooleanAttributeValue(ATTR_CONCURRENT_EXCHANGE);
+    } else if (_config.type == VALUE_PARALLEL_IMPLICIT) {
+      _config.speculationLimit = tag.getDoubleAttributeValue(ATTR_SPECULATION_LIMIT);
+    }
   } else if (tag.getName() == TAG_PARTICIPANTS) {
     _config.participants.push_back(tag.getStringAttributeValue(ATTR_FIRST));
     _config.participants.push_back(tag.getStringAttributeValue(ATTR_SECOND));
@@ -180,6 +223,16 @@ void CouplingSchemeConfiguration::xmlTagCallback(
         tag.getIntAttributeValue(ATTR_VALID_DIGITS);
     _config.dtMethod = getTimesteppingMethod(
         tag.getStringAttributeValue(ATTR_METHOD));
+    if (_config.dtMethod == constants::ADAPTIVE_DT) {
+      CHECK(_config.type == VALUE_SERIAL_IMPLICIT,
+            "The adaptive timestep length method is only supported by serial implicit coupling schemes!");
+      _config.minTimestepLength = tag.getDoubleAttributeValue(ATTR_MIN_VALUE);
+      _config.maxTimestepLength = tag.getDoubleAttributeValue(ATTR_MAX_VALUE);
+      _config.growIterations    = tag.getIntAttributeValue(ATTR_GROW_ITERATIONS);
+      CHECK(_config.minTimestepLength != CouplingScheme::UNDEFINED_TIMESTEP_LENGTH
+            && _config.maxTimestepLength != CouplingScheme::UNDEFINED_TIMESTEP_LENGTH,
+            "The adaptive timestep length method requires a minimal and a maximal timestep length!");
+    }
   } else if (tag.getName() == TAG_ABS_CONV_MEASURE) {
     std::string dataName = tag.getStringAttributeValue(ATTR_DATA);
     std::string meshName = tag.getStringAttributeValue(ATTR_MESH);
@@ -218,6 +271,8 @@ void CouplingSchemeConfiguration::xmlTagCallback(
     std::string   nameParticipantFrom = tag.getStringAttributeValue(ATTR_FROM);
     std::string   nameParticipantTo   = tag.getStringAttributeValue(ATTR_TO);
     bool          initialize          = tag.getBooleanAttributeValue(ATTR_INITIALIZE);
+    bool          singlePrecision     = tag.getStringAttributeValue(ATTR_PRECISION) == VALUE_SINGLE;
+    int           waveformSamples     = tag.getIntAttributeValue(ATTR_WAVEFORM_SAMPLES);
     mesh::PtrData exchangeData;
     mesh::PtrMesh exchangeMesh;
     for (mesh::PtrMesh mesh : _meshConfig->meshes()) {
@@ -240,7 +295,14 @@ void CouplingSchemeConfiguration::xmlTagCallback(
     _meshConfig->addNeededMesh(nameParticipantFrom, nameMesh);
     _meshConfig->addNeededMesh(nameParticipantTo, nameMesh);
     _config.exchanges.push_back(std::make_tuple(exchangeData, exchangeMesh,
-                                                nameParticipantFrom, nameParticipantTo, initialize));
+                                                nameParticipantFrom, nameParticipantTo, initialize,
+                                                singlePrecision));
+    addWaveformSamples(exchangeData, exchangeMesh, waveformSamples);
+    for (const mesh::PtrData &sample : _waveformSamples[exchangeData->getID()]) {
+      _config.exchanges.push_back(std::make_tuple(sample, exchangeMesh,
+                                                  nameParticipantFrom, nameParticipantTo, initialize,
+                                                  singlePrecision));
+    }
   } else if (tag.getName() == TAG_MAX_ITERATIONS) {
     assertion(_config.type == VALUE_SERIAL_IMPLICIT || _config.type == VALUE_PARALLEL_IMPLICIT || _config.type == VALUE_MULTI);
     _config.maxIterations = tag.getIntAttributeValue(ATTR_VALUE);
@@ -414,9 +476,26 @@ void CouplingSchemeConfiguration::addTransientLimitTags(
   attrMethod.setDefaultValue(VALUE_FIXED);
   ValidatorEquals<std::string> validFixed(VALUE_FIXED);
   ValidatorEquals<std::string> validFirst(VALUE_FIRST_PARTICIPANT);
+  ValidatorEquals<std::string> validAdaptive(VALUE_ADAPTIVE);
   //  ValidatorEquals<std::string> validSec ( TagTimestepLength::VALUE_SECOND_PARTICIPANT );
-  attrMethod.setValidator(validFixed || validFirst);
+  attrMethod.setValidator(validFixed || validFirst || validAdaptive);
   tagTimestepLength.addAttribute(attrMethod);
+  XMLAttribute<double> attrMinValue(ATTR_MIN_VALUE);
+  attrMinValue.setDocumentation("Minimal timestep length of the adaptive method.");
+  attrMinValue.setDefaultValue(CouplingScheme::UNDEFINED_TIMESTEP_LENGTH);
+  tagTimestepLength.addAttribute(attrMinValue);
+  XMLAttribute<double> attrMaxValue(ATTR_MAX_VALUE);
+  attrMaxValue.setDocumentation("Maximal timestep length of the adaptive method.");
+  attrMaxValue.setDefaultValue(CouplingScheme::UNDEFINED_TIMESTEP_LENGTH);
+  tagTimestepLength.addAttribute(attrMaxValue);
+  XMLAttribute<int> attrGrowIterations(ATTR_GROW_ITERATIONS);
+  std::string doc = "With the adaptive method, the timestep length is doubled after a timestep that ";
+  doc += "converged within this number of iterations, and halved after a timestep that reached the ";
+  doc += "maximal number of iterations. The first participant adapts the timestep length, the second ";
+  doc += "one receives it. Starts with the given timestep length value.";
+  attrGrowIterations.setDocumentation(doc);
+  attrGrowIterations.setDefaultValue(2);
+  tagTimestepLength.addAttribute(attrGrowIterations);
   tag.addSubtag(tagTimestepLength);
 }
 
@@ -461,6 +540,24 @@ void CouplingSchemeConfiguration::addTagExchange(
   XMLAttribute<bool> attrInitialize(ATTR_INITIALIZE);
   attrInitialize.setDefaultValue(false);
   tagExchange.addAttribute(attrInitialize);
+  XMLAttribute<std::string> attrPrecision(ATTR_PRECISION);
+  attrPrecision.setDocumentation(
+      "Floating point precision used to transfer the data between the participants. "
+      "\"single\" halves the transferred volume, but rounds the values to a relative accuracy of about 1e-7. "
+      "It only takes effect for point-to-point communication, i.e. for participants running with a master.");
+  ValidatorEquals<std::string> validDouble(VALUE_DOUBLE);
+  ValidatorEquals<std::string> validSingle(VALUE_SINGLE);
+  attrPrecision.setValidator(validDouble || validSingle);
+  attrPrecision.setDefaultValue(VALUE_DOUBLE);
+  tagExchange.addAttribute(attrPrecision);
+  XMLAttribute<int> attrWaveformSamples(ATTR_WAVEFORM_SAMPLES);
+  attrWaveformSamples.setDocumentation(
+      "Number of samples of the data per time window. With more than one sample, the written values are "
+      "additionally sampled at equidistant times within the time window and exchanged. Read data with "
+      "waveform order 1 is then interpolated piecewise linearly across the samples, such that subcycling "
+      "solvers read the intermediate values of their partner.");
+  attrWaveformSamples.setDefaultValue(1);
+  tagExchange.addAttribute(attrWaveformSamples);
   tag.addSubtag(tagExchange);
 }
 
@@ -586,6 +683,9 @@ void CouplingSchemeConfiguration::addRelativeConvergenceMeasure(
       new impl::RelativeConvergenceMeasure(limit));
   int dataID = getData(dataName, meshName)->getID();
   _config.convMeasures.push_back(std::make_tuple(dataID, suffices, meshName, level, measure));
+  if (_config.relativeLimits.count(dataID) == 0 || limit < _config.relativeLimits[dataID]) {
+    _config.relativeLimits[dataID] = limit;
+  }
 }
 
 void CouplingSchemeConfiguration::addResidualRelativeConvergenceMeasure(
@@ -600,6 +700,9 @@ void CouplingSchemeConfiguration::addResidualRelativeConvergenceMeasure(
       new impl::ResidualRelativeConvergenceMeasure(limit));
   int dataID = getData(dataName, meshName)->getID();
   _config.convMeasures.push_back(std::make_tuple(dataID, suffices, meshName, level, measure));
+  if (_config.relativeLimits.count(dataID) == 0 || limit < _config.relativeLimits[dataID]) {
+    _config.relativeLimits[dataID] = limit;
+  }
 }
 
 void CouplingSchemeConfiguration::addMinIterationConvergenceMeasure(
@@ -677,6 +780,9 @@ PtrCouplingScheme CouplingSchemeConfiguration::createSerialImplicitCouplingSchem
       _config.validDigits, _config.participants[0], _config.participants[1],
       accessor, m2n, _config.dtMethod, BaseCouplingScheme::Implicit, _config.maxIterations);
   scheme->setExtrapolationOrder(_config.extrapolationOrder);
+  if (_config.dtMethod == constants::ADAPTIVE_DT) {
+    scheme->setAdaptiveTimestepLength(_config.minTimestepLength, _config.maxTimestepLength, _config.growIterations);
+  }
 
   addDataToBeExchanged(*scheme, accessor);
 
@@ -690,6 +796,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createSerialImplicitCouplingSchem
     impl::PtrConvergenceMeasure measure    = get<4>(elem);
     _meshConfig->addNeededMesh(_config.participants[1], neededMesh);
     checkIfDataIsExchanged(dataID);
+    checkPrecisionOfExchange(dataID);
     //bool isCoarse = checkIfDataIsCoarse(dataID);
     scheme->addConvergenceMeasure(dataID, suffices, level, measure);
   }
@@ -731,6 +838,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createParallelImplicitCouplingSch
     impl::PtrConvergenceMeasure measure    = get<4>(elem);
     _meshConfig->addNeededMesh(_config.participants[1], neededMesh);
     checkIfDataIsExchanged(dataID);
+    checkPrecisionOfExchange(dataID);
     //bool isCoarse = checkIfDataIsCoarse(dataID);
     scheme->addConvergenceMeasure(dataID, suffices, level, measure);
   }
@@ -745,6 +853,13 @@ PtrCouplingScheme CouplingSchemeConfiguration::createParallelImplicitCouplingSch
     }
     scheme->setIterationPostProcessing(_postProcConfig->getPostProcessing());
   }
+
+  if (_config.speculationLimit >= 0.0) {
+    CHECK(_postProcConfig->getPostProcessing().get() == nullptr
+          || not _postProcConfig->getPostProcessing()->isMultilevelBasedApproach(),
+          "Speculative coupling iterations cannot be combined with a manifold mapping post-processing!");
+    scheme->setSpeculation(_config.speculationLimit);
+  }
   return PtrCouplingScheme(scheme);
 }
 
@@ -769,6 +884,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createMultiCouplingScheme(
     scheme->setExtrapolationOrder(_config.extrapolationOrder);
 
     MultiCouplingScheme *castedScheme = dynamic_cast<MultiCouplingScheme *>(scheme);
+    castedScheme->setConcurrentExchange(_config.concurrentExchange);
     addMultiDataToBeExchanged(*castedScheme, accessor);
   } else {
     m2n::PtrM2N m2n = _m2nConfig->getM2N(
@@ -792,6 +908,7 @@ PtrCouplingScheme CouplingSchemeConfiguration::createMultiCouplingScheme(
     impl::PtrConvergenceMeasure measure    = get<4>(elem);
     _meshConfig->addNeededMesh(_config.controller, neededMesh);
     checkIfDataIsExchanged(dataID);
+    checkPrecisionOfExchange(dataID);
     // bool isCoarse = checkIfDataIsCoarse(dataID);
     scheme->addConvergenceMeasure(dataID, suffices, level, measure);
   }
@@ -819,6 +936,8 @@ CouplingSchemeConfiguration::getTimesteppingMethod(
     return constants::FIXED_DT;
   } else if (method == VALUE_FIRST_PARTICIPANT) {
     return constants::FIRST_PARTICIPANT_SETS_DT;
+  } else if (method == VALUE_ADAPTIVE) {
+    return constants::ADAPTIVE_DT;
   }
   //  else if ( method == TagTimestepLength::VALUE_SECOND_PARTICIPANT ){
   //    return constants::SECOND_PARTICIPANT_SETS_DT;
@@ -849,11 +968,12 @@ void CouplingSchemeConfiguration::addDataToBeExchanged(
       throw std::string("Participant \"" + to + "\" is not configured for coupling scheme");
     }
 
-    bool initialize = get<4>(tuple);
+    bool initialize      = get<4>(tuple);
+    bool singlePrecision = get<5>(tuple);
     if (from == accessor) {
-      scheme.addDataToSend(data, mesh, initialize);
+      scheme.addDataToSend(data, mesh, initialize, singlePrecision);
     } else if (to == accessor) {
-      scheme.addDataToReceive(data, mesh, initialize);
+      scheme.addDataToReceive(data, mesh, initialize, singlePrecision);
     } else {
       assertion(_config.type == VALUE_MULTI);
     }
@@ -880,7 +1000,8 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
       throw std::string("Participant \"" + to + "\" is not configured for coupling scheme");
     }
 
-    bool initialize = get<4>(tuple);
+    bool initialize      = get<4>(tuple);
+    bool singlePrecision = get<5>(tuple);
     if (from == accessor) {
       size_t index = 0;
       for (const std::string &participant : _config.participants) {
@@ -891,7 +1012,7 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
         index++;
       }
       assertion(index < _config.participants.size(), index, _config.participants.size());
-      scheme.addDataToSend(data, mesh, initialize, index);
+      scheme.addDataToSend(data, mesh, initialize, index, singlePrecision);
     } else {
       size_t index = 0;
       for (const std::string &participant : _config.participants) {
@@ -902,7 +1023,7 @@ void CouplingSchemeConfiguration::addMultiDataToBeExchanged(
         index++;
       }
       assertion(index < _config.participants.size(), index, _config.participants.size());
-      scheme.addDataToReceive(data, mesh, initialize, index);
+      scheme.addDataToReceive(data, mesh, initialize, index, singlePrecision);
     }
   }
 }
@@ -922,6 +1043,46 @@ void CouplingSchemeConfiguration::checkIfDataIsExchanged(
             << " and/or the iteration post-processing");
 }
 
+void CouplingSchemeConfiguration::checkPrecisionOfExchange(
+    int dataID) const
+{
+  auto limit = _config.relativeLimits.find(dataID);
+  if (limit == _config.relativeLimits.end()) {
+    return;
+  }
+  for (const Config::Exchange &tuple : _config.exchanges) {
+    mesh::PtrData data = std::get<0>(tuple);
+    if (data->getID() == dataID && std::get<5>(tuple)) {
+      CHECK(limit->second >= SINGLE_PRECISION_LIMIT,
+            "Data \"" << data->getName() << "\" is exchanged in single precision, which cannot resolve "
+                      << "its relative convergence limit of " << limit->second << ". Use a limit of at least "
+                      << SINGLE_PRECISION_LIMIT << " or exchange the data in double precision");
+    }
+  }
+}
+
+void CouplingSchemeConfiguration::addWaveformSamples(
+    const mesh::PtrData &data,
+    const mesh::PtrMesh &mesh,
+    int                  sampleCount)
+{
+  TRACE(data->getName(), sampleCount);
+  CHECK(sampleCount >= 1, "Data \"" << data->getName() << "\" is exchanged with " << sampleCount
+                                    << " waveform samples, but at least one is required");
+  std::vector<mesh::PtrData> &samples = _waveformSamples[data->getID()];
+  if (not samples.empty() || sampleCount == 1) {
+    CHECK((int) samples.size() + 1 == sampleCount,
+          "Data \"" << data->getName() << "\" is exchanged several times with different numbers of waveform samples");
+    return;
+  }
+  // The values at the end of the time window are the last sample
+  for (int i = 1; i < sampleCount; i++) {
+    std::ostringstream name;
+    name << data->getName() << "-Sample" << i;
+    samples.push_back(mesh->createData(name.str(), data->getDimensions()));
+  }
+}
+
 bool CouplingSchemeConfiguration::checkIfDataIsCoarse(
     int id) const
 {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -67,6 +68,14 @@ public:
   /// Returns the configured coupling scheme.
   const PtrCouplingScheme &getCouplingScheme(const std::string &participantName) const;
 
+  /**
+   * @brief Returns the data holding the waveform samples exchanged along with the given data.
+   *
+   * The samples are taken at equidistant times within the time window, the values at the end
+   * of the window are not contained. Empty, if the data is exchanged with one sample only.
+   */
+  std::vector<mesh::PtrData> getWaveformSamples(int dataID) const;
+
   /// Returns the name of one dataset exchanged in the coupling scheme.
   const std::string &getDataToExchange(int index) const;
 
@@ -116,6 +125,13 @@ private:
   const std::string ATTR_SUFFICES;
   const std::string ATTR_CONTROL;
   const std::string ATTR_LEVEL;
+  const std::string ATTR_PRECISION;
+  const std::string ATTR_CONCURRENT_EXCHANGE;
+  const std::string ATTR_MIN_VALUE;
+  const std::string ATTR_MAX_VALUE;
+  const std::string ATTR_GROW_ITERATIONS;
+  const std::string ATTR_SPECULATION_LIMIT;
+  const std::string ATTR_WAVEFORM_SAMPLES;
 
   const std::string VALUE_SERIAL_EXPLICIT;
   const std::string VALUE_PARALLEL_EXPLICIT;
@@ -124,6 +140,9 @@ private:
   const std::string VALUE_MULTI;
   const std::string VALUE_FIXED;
   const std::string VALUE_FIRST_PARTICIPANT;
+  const std::string VALUE_ADAPTIVE;
+  const std::string VALUE_DOUBLE;
+  const std::string VALUE_SINGLE;
 
   struct Config {
     std::string                   type;
@@ -136,13 +155,20 @@ private:
     double                        timestepLength = CouplingScheme::UNDEFINED_TIMESTEP_LENGTH;
     int                           validDigits = 16;
     constants::TimesteppingMethod dtMethod = constants::FIXED_DT;
-    /// Tuples of exchange data, mesh, and participant name.
-    typedef std::tuple<mesh::PtrData, mesh::PtrMesh, std::string, std::string, bool> Exchange;
-    std::vector<Exchange>                                                            exchanges;
+    double                        minTimestepLength = CouplingScheme::UNDEFINED_TIMESTEP_LENGTH;
+    double                        maxTimestepLength = CouplingScheme::UNDEFINED_TIMESTEP_LENGTH;
+    int                           growIterations = 2;
+    /// Tuples of exchange data, mesh, participant names, initialize and single precision flag.
+    typedef std::tuple<mesh::PtrData, mesh::PtrMesh, std::string, std::string, bool, bool> Exchange;
+    std::vector<Exchange>                                                                  exchanges;
     /// Tuples of data ID, mesh ID, and convergence measure.
     std::vector<std::tuple<int, bool, std::string, int, impl::PtrConvergenceMeasure>> convMeasures;
+    /// Smallest (residual) relative convergence limit per data ID.
+    std::map<int, double> relativeLimits;
     int                                                                               maxIterations = -1;
     int                                                                               extrapolationOrder = 0;
+    bool                                                                              concurrentExchange = false;
+    double                                                                            speculationLimit = -1.0;
 
   } _config;
 
@@ -158,6 +184,9 @@ private:
   /// If a participant has more than one coupling scheme, a composition is created.
   std::map<std::string, CompositionalCouplingScheme *> _couplingSchemeCompositions;
 
+  /// Map from exchanged data ID to the data holding its waveform samples.
+  std::map<int, std::vector<mesh::PtrData>> _waveformSamples;
+
   void addTypespecifcSubtags(const std::string &type, xml::XMLTag &tag);
 
   void addTransientLimitTags(xml::XMLTag &tag);
@@ -168,6 +197,9 @@ private:
 
   void addTagExchange(xml::XMLTag &tag);
 
+  /// Creates the data holding the waveform samples of exchanged data on its mesh, if not done yet.
+  void addWaveformSamples(const mesh::PtrData &data, const mesh::PtrMesh &mesh, int sampleCount);
+
   void addTagAbsoluteConvergenceMeasure(xml::XMLTag &tag);
 
   void addTagRelativeConvergenceMeasure(xml::XMLTag &tag);
@@ -254,6 +286,10 @@ private:
   void checkIfDataIsExchanged(
       int dataID) const;
 
+  /// Checks that data exchanged in single precision does not use too tight relative convergence limits.
+  void checkPrecisionOfExchange(
+      int dataID) const;
+
   bool checkIfDataIsCoarse(int id) const;
 
   friend struct CplSchemeTests::ParallelImplicitCouplingSchemeTests::testParseConfigurationWithRelaxation;  // For whitebox tests
@@ -49,6 +49,8 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       ATTR_RSLS_REUSEDTSTEPS("reused-timesteps-at-restart"),
       ATTR_RSSVD_TRUNCATIONEPS("truncation-threshold"),
       ATTR_PRECOND_NONCONST_TIMESTEPS("freeze-after"),
+      ATTR_COMPRESSION_RANK("compression-rank"),
+      ATTR_THREADS("threads"),
       VALUE_CONSTANT("constant"),
       VALUE_AITKEN("aitken"),
       VALUE_HIERARCHICAL_AITKEN("hierarchical-aitken"),
@@ -68,6 +70,7 @@ PostProcessingConfiguration::PostProcessingConfiguration(
       VALUE_SVD_RESTART("RS-SVD"),
       VALUE_SLIDE_RESTART("RS-SLIDE"),
       VALUE_NO_RESTART("no-restart"),
+      VALUE_LOWRANK_NO_RESTART("no-restart-low-rank"),
       _meshConfig(meshConfig),
       _postProcessing(),
       _coarseModelOptimizationConfig(),
@@ -103,13 +106,19 @@ void PostProcessingConfiguration::connectTags(xml::XMLTag &parent)
     addTypeSpecificSubtags(tag);
     tags.push_back(tag);
   }
+  XMLAttribute<int> attrThreads(ATTR_THREADS);
+  attrThreads.setDocumentation("Number of threads per rank for the local matrix products of the quasi-Newton update. "
+                               "Useful if a solver leaves cores of a node idle.");
+  attrThreads.setDefaultValue(1);
   {
     XMLTag tag(*this, VALUE_IQNILS, occ, TAG);
+    tag.addAttribute(attrThreads);
     addTypeSpecificSubtags(tag);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_MVQN, occ, TAG);
+    tag.addAttribute(attrThreads);
 
     XMLAttribute<bool> alwaybuildJacobian(ATTR_BUILDJACOBIAN);
     alwaybuildJacobian.setDocumentation("If set to true, the IMVJ will set up the Jacobian matrix"
@@ -161,6 +170,11 @@ void PostProcessingConfiguration::xmlTagCallback(
 
     if (_config.type == VALUE_MVQN)
       _config.alwaysBuildJacobian = callingTag.getBooleanAttributeValue(ATTR_BUILDJACOBIAN);
+
+    if (_config.type == VALUE_IQNILS || _config.type == VALUE_MVQN) {
+      _config.threads = callingTag.getIntAttributeValue(ATTR_THREADS);
+      CHECK(_config.threads > 0, "The number of threads of the post-processing has to be larger than zero!");
+    }
   }
 
   if (callingTag.getName() == TAG_RELAX) {
@@ -199,6 +213,8 @@ void PostProcessingConfiguration::xmlTagCallback(
     _config.maxIterationsUsed = callingTag.getIntAttributeValue(ATTR_VALUE);
   } else if (callingTag.getName() == TAG_TIMESTEPS_REUSED) {
     _config.timestepsReused = callingTag.getIntAttributeValue(ATTR_VALUE);
+    if (_config.type == VALUE_IQNILS)
+      _config.compressionRank = callingTag.getIntAttributeValue(ATTR_COMPRESSION_RANK);
   } else if (callingTag.getName() == TAG_FILTER) {
     auto f = callingTag.getStringAttributeValue(ATTR_TYPE);
     if (f == VALUE_QR1FILTER) {
@@ -237,6 +253,9 @@ void PostProcessingConfiguration::xmlTagCallback(
       _config.imvjRestartType         = impl::MVQNPostProcessing::RS_SVD;
     } else if (f == VALUE_SLIDE_RESTART) {
       _config.imvjRestartType = impl::MVQNPostProcessing::RS_SLIDE;
+    } else if (f == VALUE_LOWRANK_NO_RESTART) {
+      _config.imvjRSSVD_truncationEps = callingTag.getDoubleAttributeValue(ATTR_RSSVD_TRUNCATIONEPS);
+      _config.imvjRestartType         = impl::MVQNPostProcessing::NO_RESTART_LOWRANK;
     } else {
       _config.imvjChunkSize = 0;
       assertion(false);
@@ -296,31 +315,34 @@ void PostProcessingConfiguration::xmlEndTagCallback(
           new impl::HierarchicalAitkenPostProcessing(
               _config.relaxationFactor, _config.dataIDs));
     } else if (callingTag.getName() == VALUE_IQNILS) {
-      _postProcessing = impl::PtrPostProcessing(
-          new impl::IQNILSPostProcessing(
-              _config.relaxationFactor,
-              _config.forceInitialRelaxation,
-              _config.maxIterationsUsed,
-              _config.timestepsReused,
-              _config.filter, _config.singularityLimit,
-              _config.dataIDs,
-              _preconditioner));
+      impl::IQNILSPostProcessing *iqnils = new impl::IQNILSPostProcessing(
+          _config.relaxationFactor,
+          _config.forceInitialRelaxation,
+          _config.maxIterationsUsed,
+          _config.timestepsReused,
+          _config.filter, _config.singularityLimit,
+          _config.dataIDs,
+          _preconditioner);
+      iqnils->setHistoryCompression(_config.compressionRank);
+      iqnils->setThreads(_config.threads);
+      _postProcessing = impl::PtrPostProcessing(iqnils);
     } else if (callingTag.getName() == VALUE_MVQN) {
 #ifndef PRECICE_NO_MPI
-      _postProcessing = impl::PtrPostProcessing(
-          new impl::MVQNPostProcessing(
-              _config.relaxationFactor,
-              _config.forceInitialRelaxation,
-              _config.maxIterationsUsed,
-              _config.timestepsReused,
-              _config.filter, _config.singularityLimit,
-              _config.dataIDs,
-              _preconditioner,
-              _config.alwaysBuildJacobian,
-              _config.imvjRestartType,
-              _config.imvjChunkSize,
-              _config.imvjRSLS_reustedTimesteps,
-              _config.imvjRSSVD_truncationEps));
+      impl::MVQNPostProcessing *mvqn = new impl::MVQNPostProcessing(
+          _config.relaxationFactor,
+          _config.forceInitialRelaxation,
+          _config.maxIterationsUsed,
+          _config.timestepsReused,
+          _config.filter, _config.singularityLimit,
+          _config.dataIDs,
+          _preconditioner,
+          _config.alwaysBuildJacobian,
+          _config.imvjRestartType,
+          _config.imvjChunkSize,
+          _config.imvjRSLS_reustedTimesteps,
+          _config.imvjRSSVD_truncationEps);
+      mvqn->setThreads(_config.threads);
+      _postProcessing = impl::PtrPostProcessing(mvqn);
 #else
       ERROR("Post processing IQN-IMVJ only works if preCICE is compiled with MPI");
 #endif
@@ -419,6 +441,12 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
 
     XMLTag tagTimestepsReused(*this, TAG_TIMESTEPS_REUSED, XMLTag::OCCUR_ONCE);
     tagTimestepsReused.addAttribute(attrIntValue);
+    XMLAttribute<int> attrCompressionRank(ATTR_COMPRESSION_RANK);
+    attrCompressionRank.setDocumentation("If larger than zero, the columns of every reused timestep are compressed to "
+                                         "at most this number of columns by a truncated SVD after the timestep converged. "
+                                         "This reduces the memory needed to reuse many timesteps.");
+    attrCompressionRank.setDefaultValue(0);
+    tagTimestepsReused.addAttribute(attrCompressionRank);
     tag.addSubtag(tagTimestepsReused);
 
     XMLTag                    tagData(*this, TAG_DATA, XMLTag::OCCUR_ONCE_OR_MORE);
@@ -489,7 +517,8 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     ValidatorEquals<std::string> validRS_LS(VALUE_LS_RESTART);
     ValidatorEquals<std::string> validRS_SVD(VALUE_SVD_RESTART);
     ValidatorEquals<std::string> validRS_SLIDE(VALUE_SLIDE_RESTART);
-    attrRestartName.setValidator(validNO_RS || validRS_ZERO || validRS_LS || validRS_SVD || validRS_SLIDE);
+    ValidatorEquals<std::string> validNO_RS_LOWRANK(VALUE_LOWRANK_NO_RESTART);
+    attrRestartName.setValidator(validNO_RS || validRS_ZERO || validRS_LS || validRS_SVD || validRS_SLIDE || validNO_RS_LOWRANK);
     attrRestartName.setDefaultValue(VALUE_SVD_RESTART);
     tagIMVJRESTART.addAttribute(attrRestartName);
     tagIMVJRESTART.setDocumentation("Type of IMVJ restart mode that is used\n"
@@ -497,7 +526,9 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
                                     "  RS-ZERO:    IMVJ runs in restart mode. After M time steps all Jacobain information is dropped, restart with no information\n"
                                     "  RS-LS:      IMVJ runs in restart mode. After M time steps a IQN-LS like approximation for the initial guess of the Jacobian is computed.\n"
                                     "  RS-SVD:     IMVJ runs in restart mode. After M time steps a truncated SVD of the Jacobian is updated.\n"
-                                    "  RS-SLIDE:   IMVJ runs in sliding window restart mode.\n");
+                                    "  RS-SLIDE:   IMVJ runs in sliding window restart mode.\n"
+                                    "  no-restart-low-rank: IMVJ keeps all Jacobian information as in no-restart mode, but never builds the Jacobian.\n"
+                                    "              It is stored as a sum of low-rank factors, which are merged into a truncated SVD whenever their rank grows too large.\n");
     XMLAttribute<int> attrChunkSize(ATTR_IMVJCHUNKSIZE);
     attrChunkSize.setDocumentation("Specifies the number of time steps M after which the IMVJ restarts, if run in restart-mode. Defaul value is M=8.");
     attrChunkSize.setDefaultValue(8);
@@ -505,7 +536,7 @@ void PostProcessingConfiguration::addTypeSpecificSubtags(
     attrReusedTimeStepsAtRestart.setDocumentation("If IMVJ restart-mode=RS-LS, the number of reused time steps at restart can be specified.");
     attrReusedTimeStepsAtRestart.setDefaultValue(8);
     XMLAttribute<double> attrRSSVD_truncationEps(ATTR_RSSVD_TRUNCATIONEPS);
-    attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD, the truncation threshold for the updated SVD can be set.");
+    attrRSSVD_truncationEps.setDocumentation("If IMVJ restart-mode=RS-SVD or no-restart-low-rank, the truncation threshold for the updated SVD can be set.");
     attrRSSVD_truncationEps.setDefaultValue(1e-4);
     tagIMVJRESTART.addAttribute(attrChunkSize);
     tagIMVJRESTART.addAttribute(attrReusedTimeStepsAtRestart);
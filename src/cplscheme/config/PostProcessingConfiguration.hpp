@@ -74,6 +74,8 @@ private:
   const std::string ATTR_RSLS_REUSEDTSTEPS;
   const std::string ATTR_RSSVD_TRUNCATIONEPS;
   const std::string ATTR_PRECOND_NONCONST_TIMESTEPS;
+  const std::string ATTR_COMPRESSION_RANK;
+  const std::string ATTR_THREADS;
 
   const std::string VALUE_CONSTANT;
   const std::string VALUE_AITKEN;
@@ -94,6 +96,7 @@ private:
   const std::string VALUE_SVD_RESTART;
   const std::string VALUE_SLIDE_RESTART;
   const std::string VALUE_NO_RESTART;
+  const std::string VALUE_LOWRANK_NO_RESTART;
 
   const mesh::PtrMeshConfiguration _meshConfig;
 
@@ -117,6 +120,8 @@ private:
     bool                  forceInitialRelaxation = false;
     int                   maxIterationsUsed = 0;
     int                   timestepsReused = 0;
+    int                   compressionRank = 0;
+    int                   threads = 1;
     int                   filter = impl::PostProcessing::NOFILTER;
     int                   imvjRestartType = 0;
     int                   imvjChunkSize = 0;
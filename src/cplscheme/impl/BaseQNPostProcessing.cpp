@@ -1,8 +1,12 @@
 #include "BaseQNPostProcessing.hpp"
+#include <Eigen/Eigenvalues>
+#include <algorithm>
 #include <sstream>
 #include "QRFactorization.hpp"
 #include "com/Communication.hpp"
 #include "cplscheme/CouplingData.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -301,7 +305,8 @@ void BaseQNPostProcessing::performPostProcessing(
 {
   TRACE(_dataIDs.size(), cplData.size());
   
-  utils::Event e("cpl.computeQuasiNewtonUpdate", precice::syncMode);
+  static const utils::EventName computeUpdateEventName("cpl.computeQuasiNewtonUpdate");
+  utils::Event e(computeUpdateEventName, precice::syncMode);
 
   assertion(_oldResiduals.size() == _oldXTilde.size(), _oldResiduals.size(), _oldXTilde.size());
   assertion(_values.size() == _oldXTilde.size(), _values.size(), _oldXTilde.size());
@@ -381,8 +386,12 @@ void BaseQNPostProcessing::performPostProcessing(
      */
 
     _preconditioner->update(false, _values, _residuals);
-    // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V)
-    _preconditioner->apply(_matrixV);
+    // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V, the QR1 filter
+    // works on the updated QR-dec only)
+    bool scaleV = _preconditioner->requireNewQR() || _filter == PostProcessing::QR2FILTER;
+    if (scaleV) {
+      _preconditioner->apply(_matrixV);
+    }
 
     if (_preconditioner->requireNewQR()) {
       if (not(_filter == PostProcessing::QR2FILTER)) { //for QR2 filter, there is no need to do this twice
@@ -395,7 +404,9 @@ void BaseQNPostProcessing::performPostProcessing(
     applyFilter();
 
     // revert scaling of V, in computeQNUpdate all data objects are unscaled.
-    _preconditioner->revert(_matrixV);
+    if (scaleV) {
+      _preconditioner->revert(_matrixV);
+    }
 
     /**
      * compute quasi-Newton update
@@ -606,10 +617,67 @@ void BaseQNPostProcessing::iterationsConverged(
     _matrixCols.pop_back();
   }
 
+  // columns of older timesteps are compressed already
+  if (_compressionRank > 0 && _timestepsReused > 0 && not _matrixCols.empty()
+      && _matrixCols.front() > _compressionRank) {
+    compressTimestepColumns();
+  }
+
   _matrixCols.push_front(0);
   _firstIteration = true;
 }
 
+/** ---------------------------------------------------------------------------------------------
+ *         compressTimestepColumns()
+ *
+ * @brief: replaces the columns of the last converged timestep in V, W by the linear combinations
+ *         V*Y, W*Y, where Y holds the leading right singular vectors of the scaled block P*V.
+ *         Y is computed from the small Gram matrix (P*V)^T*(P*V), which is reduced over all procs.
+ *  ---------------------------------------------------------------------------------------------
+ */
+void BaseQNPostProcessing::compressTimestepColumns()
+{
+  TRACE(_matrixCols.front(), _compressionRank);
+
+  int             cols    = _matrixCols.front();
+  Eigen::MatrixXd scaledV = _matrixV.leftCols(cols);
+  _preconditioner->apply(scaledV);
+  Eigen::MatrixXd gram = scaledV.transpose() * scaledV;
+  if (utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode) {
+    Eigen::MatrixXd localGram = gram;
+    utils::MasterSlave::allreduceSum(localGram.data(), gram.data(), localGram.size());
+  }
+
+  // eigenvalues are sorted increasingly, the squared singular values of P*V
+  Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> solver(gram);
+  const Eigen::VectorXd &eigenvalues = solver.eigenvalues();
+  double                 threshold   = _singularityLimit * _singularityLimit * eigenvalues(cols - 1);
+  int                    rank        = 0;
+  while (rank < _compressionRank && eigenvalues(cols - 1 - rank) > threshold
+         && eigenvalues(cols - 1 - rank) > 0.0) {
+    rank++;
+  }
+  rank = std::max(rank, 1);
+  Eigen::MatrixXd transformation = solver.eigenvectors().rightCols(rank).rowwise().reverse();
+  DEBUG("Compressing " << cols << " cols of the last timestep to " << rank << " cols");
+
+  transformMatrixColumns(transformation);
+  _matrixCols.front() = rank;
+
+  _preconditioner->apply(_matrixV);
+  _qrV.reset(_matrixV, getLSSystemRows());
+  _preconditioner->revert(_matrixV);
+  _resetLS = true; // need to recompute _Wtil, Q, R (only for IMVJ efficient update)
+}
+
+void BaseQNPostProcessing::transformMatrixColumns(
+    const Eigen::MatrixXd &transformation)
+{
+  TRACE(transformation.rows(), transformation.cols());
+  utils::transformLeftColumns(_matrixV, transformation);
+  utils::transformLeftColumns(_matrixW, transformation);
+}
+
 /** ---------------------------------------------------------------------------------------------
  *         removeMatrixColumn()
  *
@@ -646,13 +714,69 @@ void BaseQNPostProcessing::removeMatrixColumn(
 }
 
 void BaseQNPostProcessing::exportState(
-    io::TXTWriter &writer)
+    io::BinaryWriter &writer)
 {
+  TRACE();
+  writer.write(_firstIteration);
+  writer.write(_firstTimeStep);
+  writer.write(_resetLS);
+  writer.write(_values);
+  writer.write(_oldValues);
+  writer.write(_oldXTilde);
+  writer.write(_oldResiduals);
+  writer.write(_matrixV);
+  writer.write(_matrixW);
+  writer.write(_matrixCols);
+  writer.write(_matrixVBackup);
+  writer.write(_matrixWBackup);
+  writer.write(_matrixColsBackup);
+  writer.write(its);
+  writer.write(tSteps);
+  _qrV.exportState(writer);
+  _preconditioner->exportState(writer);
 }
 
 void BaseQNPostProcessing::importState(
-    io::TXTReader &reader)
+    io::BinaryReader &reader)
+{
+  TRACE();
+  assertion(_values.size() == _oldXTilde.size(), _values.size(), _oldXTilde.size());
+  long entries = _values.size();
+  reader.read(_firstIteration);
+  reader.read(_firstTimeStep);
+  reader.read(_resetLS);
+  reader.read(_values);
+  reader.read(_oldValues);
+  reader.read(_oldXTilde);
+  reader.read(_oldResiduals);
+  reader.read(_matrixV);
+  reader.read(_matrixW);
+  CHECK(_values.size() == entries && _oldXTilde.size() == entries && _matrixV.rows() == entries,
+        "The quasi-Newton checkpoint holds " << _values.size() << " local entries, the coupling data "
+        << entries << ". A checkpoint can only be restored on the same decomposition of the coupling meshes.");
+  reader.read(_matrixCols);
+  reader.read(_matrixVBackup);
+  reader.read(_matrixWBackup);
+  reader.read(_matrixColsBackup);
+  reader.read(its);
+  reader.read(tSteps);
+  _qrV.importState(reader);
+  _preconditioner->importState(reader);
+  assertion(_qrV.cols() == _matrixV.cols(), _qrV.cols(), _matrixV.cols());
+}
+
+void BaseQNPostProcessing::setHistoryCompression(
+    int rank)
+{
+  CHECK(rank >= 0, "The compression rank of the QN post-processing must not be negative!");
+  _compressionRank = rank;
+}
+
+void BaseQNPostProcessing::setThreads(
+    int threads)
 {
+  _threadedOps.setThreads(threads);
+  _qrV.setThreads(threads);
 }
 
 int BaseQNPostProcessing::getDeletedColumns()
@@ -7,6 +7,7 @@
 #include "PostProcessing.hpp"
 #include "Preconditioner.hpp"
 #include "QRFactorization.hpp"
+#include "ThreadedMatrixOperations.hpp"
 #include "logging/Logger.hpp"
 
 /* ****************************************************************************
@@ -127,16 +128,33 @@ public:
   virtual std::map<int, Eigen::VectorXd> getDesignSpecification(DataMap &cplData);
 
   /**
-    * @brief Exports the current state of the post-processing to a file.
+    * @brief Exports the current state of the post-processing to a checkpoint.
+    *
+    * Writes the V, W matrices of the reused timesteps, the QR factors of V and the
+    * preconditioner weights of this rank. Derived classes append their own state.
+    */
+  virtual void exportState(io::BinaryWriter &writer);
+
+  /**
+    * @brief Imports the state of the post-processing from a checkpoint.
+    *
+    * Has to be called after initialize(), the checkpoint has to be written with
+    * the same decomposition of the coupling data.
     */
-  virtual void exportState(io::TXTWriter &writer);
+  virtual void importState(io::BinaryReader &reader);
 
   /**
-    * @brief Imports the last exported state of the post-processing from file.
+    * @brief Limits the number of columns kept for every reused timestep.
     *
-    * Is empty at the moment!!!
+    * After convergence, the columns of the timestep are replaced by the leading
+    * right singular directions of the scaled matrix V, i.e., by linear
+    * combinations of the columns of V and W. Has only an effect if timesteps
+    * are reused.
     */
-  virtual void importState(io::TXTReader &reader);
+  void setHistoryCompression(int rank);
+
+  /// Sets the number of threads per rank for the local products of the QN update.
+  virtual void setThreads(int threads);
 
   // delete this:
   virtual int getDeletedColumns();
@@ -205,6 +223,9 @@ protected:
   /// @brief Stores the current QR decomposition ov _matrixV, can be updated via deletion/insertion of columns
   QRFactorization _qrV;
 
+  /// @brief Computes the local products of the QN update with several threads per rank
+  ThreadedMatrixOperations _threadedOps;
+
   /** @brief filter method that is used to maintain good conditioning of the least-squares system
     *        Either of two types: QR1FILTER or QR2Filter
     */
@@ -218,6 +239,9 @@ protected:
     */
   double _singularityLimit;
 
+  /// Maximal number of columns kept for every reused timestep, no compression if 0.
+  int _compressionRank = 0;
+
   /** @brief Indices (of columns in W, V matrices) of 1st iterations of timesteps.
     *
     * When old timesteps are reused (_timestepsReused > 0), the indices of the
@@ -275,6 +299,9 @@ protected:
   /// Removes one iteration from V,W matrices and adapts _matrixCols.
   virtual void removeMatrixColumn(int columnIndex);
 
+  /// Replaces the first transformation.rows() columns of V, W by their linear combinations.
+  virtual void transformMatrixColumns(const Eigen::MatrixXd &transformation);
+
   /// Wwrites info to the _infostream (also in parallel)
   void writeInfo(std::string s, bool allProcs = false);
 
@@ -306,6 +333,9 @@ private:
   Eigen::MatrixXd _matrixWBackup;
   std::deque<int> _matrixColsBackup;
 
+  /// Compresses the columns of the last converged timestep to at most _compressionRank columns.
+  void compressTimestepColumns();
+
   /// Additional debugging info, is not important for computation:
   int _nbDelCols = 0;
 };
@@ -3,8 +3,8 @@
 #include "QRFactorization.hpp"
 #include "com/Communication.hpp"
 #include "cplscheme/CouplingData.hpp"
-#include "io/TXTReader.hpp"
-#include "io/TXTWriter.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -52,6 +52,32 @@ void IQNILSPostProcessing::initialize(
   }
 }
 
+void IQNILSPostProcessing::exportState(
+    io::BinaryWriter &writer)
+{
+  BaseQNPostProcessing::exportState(writer);
+  for (auto &pair : _secondaryOldXTildes) {
+    writer.write(pair.second);
+    writer.write(_secondaryMatricesW[pair.first]);
+    writer.write(_secondaryMatricesWBackup[pair.first]);
+  }
+}
+
+void IQNILSPostProcessing::importState(
+    io::BinaryReader &reader)
+{
+  BaseQNPostProcessing::importState(reader);
+  for (auto &pair : _secondaryOldXTildes) {
+    long entries = pair.second.size();
+    reader.read(pair.second);
+    reader.read(_secondaryMatricesW[pair.first]);
+    reader.read(_secondaryMatricesWBackup[pair.first]);
+    CHECK(pair.second.size() == entries,
+          "The checkpoint of the secondary data with ID " << pair.first << " does not match the coupling data. "
+          << "A checkpoint can only be restored on the same decomposition of the coupling meshes.");
+  }
+}
+
 void IQNILSPostProcessing::updateDifferenceMatrices(
   DataMap &cplData)
 {
@@ -137,7 +163,7 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
 
   // for master-slave mode and procs with no vertices,
   // qrV.cols() = getLSSystemCols() and _qrV.rows() = 0
-  auto Q = _qrV.matrixQ();
+  auto &Q = _qrV.matrixQ();
   auto R = _qrV.matrixR();
 
   if (!_hasNodesOnInterface) {
@@ -150,10 +176,9 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
   Eigen::VectorXd _global_b;
 
   // need to scale the residual to compensate for the scaling in c = R^-1 * Q^T * P^-1 * residual'
-  // it is also possible to apply the inverse scaling weights from the right to the vector c
-  _preconditioner->apply(_residuals);
-  _local_b = Q.transpose() * _residuals;
-  _preconditioner->revert(_residuals);
+  // it is also possible to apply the inverse scaling weights from the right to the vector c.
+  // The scaling is folded into the product, the residual itself stays unscaled.
+  _threadedOps.multiplyTransposed(Q, _preconditioner->getWeights().cwiseProduct(_residuals), _local_b);
   _local_b *= -1.0; // = -Qr
 
   assertion(c.size() == 0, c.size());
@@ -191,7 +216,7 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
   
   DEBUG("   Apply Newton factors");
   // compute x updates from W and coefficients c, i.e, xUpdate = c*W
-  xUpdate = _matrixW * c;
+  _threadedOps.multiply(_matrixW, c, xUpdate);
 
   //DEBUG("c = " << c);
 
@@ -211,7 +236,7 @@ void IQNILSPostProcessing::computeQNUpdate(PostProcessing::DataMap &cplData, Eig
     PtrCouplingData data   = cplData[id];
     auto &          values = *(data->values);
     assertion(_secondaryMatricesW[id].cols() == c.size(), _secondaryMatricesW[id].cols(), c.size());
-    values = _secondaryMatricesW[id] * c;
+    _threadedOps.multiply(_secondaryMatricesW[id], c, values);
     assertion(values.size() == data->oldValues.col(0).size(), values.size(), data->oldValues.col(0).size());
     values += data->oldValues.col(0);
     assertion(values.size() == _secondaryResiduals[id].size(), values.size(), _secondaryResiduals[id].size());
@@ -273,6 +298,16 @@ void IQNILSPostProcessing::removeMatrixColumn(
 
   BaseQNPostProcessing::removeMatrixColumn(columnIndex);
 }
+
+void IQNILSPostProcessing::transformMatrixColumns(
+    const Eigen::MatrixXd &transformation)
+{
+  for (int id : _secondaryDataIDs) {
+    utils::transformLeftColumns(_secondaryMatricesW[id], transformation);
+  }
+
+  BaseQNPostProcessing::transformMatrixColumns(transformation);
+}
 }
 }
 } // namespace precice, cplscheme, impl
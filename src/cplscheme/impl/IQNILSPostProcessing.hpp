@@ -48,6 +48,12 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /// Exports the state of the base class and the W matrices of the secondary data.
+  virtual void exportState(io::BinaryWriter &writer);
+
+  /// Imports the state of the base class and the W matrices of the secondary data.
+  virtual void importState(io::BinaryReader &reader);
+
 private:
   /// Secondary data solver output from last iteration.
   std::map<int, Eigen::VectorXd> _secondaryOldXTildes;
@@ -69,6 +75,9 @@ private:
 
   /// Removes one iteration from V,W matrices and adapts _matrixCols.
   virtual void removeMatrixColumn(int columnIndex);
+
+  /// Replaces the first columns of V, W and the secondary W matrices by their linear combinations.
+  virtual void transformMatrixColumns(const Eigen::MatrixXd &transformation);
 };
 }
 }
@@ -784,12 +784,12 @@ void MMPostProcessing::removeMatrixColumn(
 }
 
 void MMPostProcessing::exportState(
-    io::TXTWriter &writer)
+    io::BinaryWriter &writer)
 {
 }
 
 void MMPostProcessing::importState(
-    io::TXTReader &reader)
+    io::BinaryReader &reader)
 {
 }
 
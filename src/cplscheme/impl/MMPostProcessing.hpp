@@ -89,14 +89,14 @@ public:
   }
 
   /// Exports the current state of the post-processing to a file.
-  virtual void exportState(io::TXTWriter &writer);
+  virtual void exportState(io::BinaryWriter &writer);
 
   /**
    * @brief Imports the last exported state of the post-processing from file.
    *
    * Is empty at the moment!!!
    */
-  virtual void importState(io::TXTReader &reader);
+  virtual void importState(io::BinaryReader &reader);
 
   // delete this:
   virtual int getDeletedColumns();
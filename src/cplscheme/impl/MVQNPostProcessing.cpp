@@ -6,6 +6,8 @@
 #include "com/MPIPortsCommunication.hpp"
 #include "com/SocketCommunication.hpp"
 #include "cplscheme/CouplingData.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -183,6 +185,56 @@ void MVQNPostProcessing::initialize(
                       << std::endl;
 }
 
+// ==================================================================================
+void MVQNPostProcessing::exportState(
+    io::BinaryWriter &writer)
+{
+  TRACE();
+  BaseQNPostProcessing::exportState(writer);
+  writer.write(_oldInvJacobian);
+  writer.write(_Wtil);
+  writer.write(static_cast<int>(_WtilChunk.size()));
+  for (size_t i = 0; i < _WtilChunk.size(); i++) {
+    writer.write(_WtilChunk[i]);
+    writer.write(_pseudoInverseChunk[i]);
+  }
+  writer.write(_matrixV_RSLS);
+  writer.write(_matrixW_RSLS);
+  writer.write(_matrixCols_RSLS);
+  _svdJ.exportState(writer);
+  writer.write(_nbRestarts);
+  writer.write(_avgRank);
+}
+
+// ==================================================================================
+void MVQNPostProcessing::importState(
+    io::BinaryReader &reader)
+{
+  TRACE();
+  BaseQNPostProcessing::importState(reader);
+  long rows = _oldInvJacobian.rows();
+  long cols = _oldInvJacobian.cols();
+  reader.read(_oldInvJacobian);
+  CHECK(_oldInvJacobian.rows() == rows && _oldInvJacobian.cols() == cols,
+        "The Jacobian of the checkpoint does not match the coupling data. "
+        << "A checkpoint can only be restored on the same decomposition of the coupling meshes.");
+  reader.read(_Wtil);
+  int chunks = 0;
+  reader.read(chunks);
+  _WtilChunk.resize(chunks);
+  _pseudoInverseChunk.resize(chunks);
+  for (int i = 0; i < chunks; i++) {
+    reader.read(_WtilChunk[i]);
+    reader.read(_pseudoInverseChunk[i]);
+  }
+  reader.read(_matrixV_RSLS);
+  reader.read(_matrixW_RSLS);
+  reader.read(_matrixCols_RSLS);
+  _svdJ.importState(reader);
+  reader.read(_nbRestarts);
+  reader.read(_avgRank);
+}
+
 // ==================================================================================
 void MVQNPostProcessing::computeUnderrelaxationSecondaryData(
     DataMap &cplData)
@@ -314,14 +366,12 @@ void MVQNPostProcessing::pseudoInverse(
    *   computation of pseudo inverse matrix Z = (V^TV)^-1 * V^T as solution
    *   to the equation R*z = Q^T(i) for all columns i,  via back substitution.
    */
-  auto Q = _qrV.matrixQ();
-  auto R = _qrV.matrixR();
+  auto &Q = _qrV.matrixQ();
+  auto &R = _qrV.matrixR();
 
   assertion(pseudoInverse.rows() == _qrV.cols(), pseudoInverse.rows(), _qrV.cols());
   assertion(pseudoInverse.cols() == _qrV.rows(), pseudoInverse.cols(), _qrV.rows());
 
-  Eigen::VectorXd yVec(pseudoInverse.rows());
-
   // assertions for the case of processors with no vertices
   if (!_hasNodesOnInterface) {
     assertion(_qrV.cols() == getLSSystemCols(), _qrV.cols(), getLSSystemCols());
@@ -329,12 +379,11 @@ void MVQNPostProcessing::pseudoInverse(
     assertion(Q.size() == 0, Q.size());
   }
 
-  // backsubstitution
-  for (int i = 0; i < Q.rows(); i++) {
-    Eigen::VectorXd Qrow = Q.row(i);
-    yVec                 = R.triangularView<Eigen::Upper>().solve<Eigen::OnTheLeft>(Qrow);
-    pseudoInverse.col(i) = yVec;
-  } // ----------------
+  // backsubstitution, the rows of Q are split among the threads
+  _threadedOps.forRowBlocks(Q.rows(), Q.cols() * Q.cols(), [&](int block, int begin, int size) {
+    pseudoInverse.middleCols(begin, size) =
+        R.triangularView<Eigen::Upper>().solve<Eigen::OnTheLeft>(Q.middleRows(begin, size).transpose());
+  }); // ----------------
 
   // scale pseudo inverse back Z := Z' * P,
   // Z' is scaled pseudo inverse i.e, Z' = R^-1 * Q^T * P^-1
@@ -366,7 +415,9 @@ void MVQNPostProcessing::buildWtil()
       // multiply: ZV := Z^q * V of size (m x m) with m=#cols, stored on each proc.
       _parMatrixOps->multiply(_pseudoInverseChunk[i], _matrixV, ZV, colsLSSystemBackThen, getLSSystemRows(), _qrV.cols());
       // multiply: Wtil^q * ZV  dimensions: (n x m) * (m x m), fully local and embarrassingly parallel
-      _Wtil += _WtilChunk[i] * ZV;
+      Eigen::MatrixXd WtilZV;
+      _threadedOps.multiply(_WtilChunk[i], ZV, WtilZV);
+      _Wtil += WtilZV;
     }
 
     // imvj without restart is used, i.e., recompute Wtil: Wtil = W - J_prev * V
@@ -489,7 +540,7 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
    */
   Eigen::VectorXd xUptmp(_residuals.size());
   xUpdate = Eigen::VectorXd::Zero(_residuals.size());
-  xUptmp  = _Wtil * r_til; // local product, result is naturally distributed.
+  _threadedOps.multiply(_Wtil, r_til, xUptmp); // local product, result is naturally distributed.
 
   /**
    *  (5) xUp = J_prev * (-res) + Wtil*Z*(-res)
@@ -505,7 +556,9 @@ void MVQNPostProcessing::computeNewtonUpdateEfficient(
       // multiply: r_til := Z^q * (-res) of size (m x 1) with m=#cols of LS at that time, result stored on each proc.
       _parMatrixOps->multiply(_pseudoInverseChunk[i], negativeResiduals, r_til, colsLSSystemBackThen, getLSSystemRows(), 1);
       // multiply: Wtil^q * r_til  dimensions: (n x m) * (m x 1), fully local and embarrassingly parallel
-      xUpdate += _WtilChunk[i] * r_til;
+      Eigen::VectorXd WtilRtil;
+      _threadedOps.multiply(_WtilChunk[i], r_til, WtilRtil);
+      xUpdate += WtilRtil;
     }
 
     // imvj without restart is used, i.e., compute directly J_prev * (-res)
@@ -561,6 +614,20 @@ void MVQNPostProcessing::computeNewtonUpdate(PostProcessing::DataMap &cplData, E
   _parMatrixOps->multiply(_invJacobian, negativeResiduals, xUpdate, _dimOffsets, getLSSystemRows(), getLSSystemRows(), 1, false); // --------
 }
 
+// ==================================================================================
+bool MVQNPostProcessing::lowRankMergeRequired()
+{
+  // the first element holds the truncated SVD of J, if already initialized
+  int svdRank = _svdJ.isSVDinitialized() ? _svdJ.rank() : 0;
+  int q       = _svdJ.isSVDinitialized() ? 1 : 0;
+
+  int pendingRank = 0;
+  for (; q < (int) _WtilChunk.size(); q++) {
+    pendingRank += _WtilChunk[q].cols();
+  }
+  return pendingRank >= std::max(svdRank, _maxIterationsUsed);
+}
+
 // ==================================================================================
 void MVQNPostProcessing::restartIMVJ()
 {
@@ -569,7 +636,8 @@ void MVQNPostProcessing::restartIMVJ()
   //int used_storage = 0;
   //int theoreticalJ_storage = 2*getLSSystemRows()*_residuals.size() + 3*_residuals.size()*getLSSystemCols() + _residuals.size()*_residuals.size();
   //               ------------ RESTART SVD ------------
-  if (_imvjRestartType == MVQNPostProcessing::RS_SVD) {
+  // the low-rank mode merges its factors exactly like RS-SVD, but is triggered by the rank, not the chunk size
+  if (_imvjRestartType == MVQNPostProcessing::RS_SVD || _imvjRestartType == MVQNPostProcessing::NO_RESTART_LOWRANK) {
 
     // we need to compute the updated SVD of the scaled Jacobian matrix
     // |= APPLY PRECONDITIONING  J_prev = Wtil^q, Z^q  ===|
@@ -624,10 +692,11 @@ void MVQNPostProcessing::restartIMVJ()
     _preconditioner->apply(_pseudoInverseChunk.front(), true);
     // |===================                             ==|
 
-    DEBUG("MVJ-RESTART, mode=SVD. Rank of truncated SVD of Jacobian " << rankAfter << ", new modes: " << rankAfter - rankBefore << ", truncated modes: " << waste << " avg rank: " << _avgRank / _nbRestarts);
+    std::string mode = (_imvjRestartType == MVQNPostProcessing::RS_SVD) ? "SVD" : "low-rank";
+    DEBUG("MVJ-RESTART, mode=" << mode << ". Rank of truncated SVD of Jacobian " << rankAfter << ", new modes: " << rankAfter - rankBefore << ", truncated modes: " << waste << " avg rank: " << _avgRank / _nbRestarts);
     //double percentage = 100.0*used_storage/(double)theoreticalJ_storage;
     if (utils::MasterSlave::_masterMode || (not utils::MasterSlave::_masterMode && not utils::MasterSlave::_slaveMode))
-      _infostringstream << " - MVJ-RESTART " << _nbRestarts << ", mode= SVD -\n  new modes: " << rankAfter - rankBefore << "\n  rank svd: " << rankAfter << "\n  avg rank: " << _avgRank / _nbRestarts << "\n  truncated modes: " << waste << "\n"
+      _infostringstream << " - MVJ-RESTART " << _nbRestarts << ", mode= " << mode << " -\n  new modes: " << rankAfter - rankBefore << "\n  rank svd: " << rankAfter << "\n  avg rank: " << _avgRank / _nbRestarts << "\n  truncated modes: " << waste << "\n"
                         << std::endl;
 
     //        ------------ RESTART LEAST SQUARES ------------
@@ -786,7 +855,10 @@ void MVQNPostProcessing::specializedIterationsConverged(
 
     // |= REBUILD QR-dec if needed     ============|
     // apply scaling to V, V' := P * V (only needed to reset the QR-dec of V)
-    _preconditioner->apply(_matrixV);
+    bool scaleV = _preconditioner->requireNewQR() || _filter == PostProcessing::QR2FILTER;
+    if (scaleV) {
+      _preconditioner->apply(_matrixV);
+    }
 
     if (_preconditioner->requireNewQR()) {
       if (not(_filter == PostProcessing::QR2FILTER)) { //for QR2 filter, there is no need to do this twice
@@ -797,7 +869,9 @@ void MVQNPostProcessing::specializedIterationsConverged(
     // apply the configured filter to the LS system
     // as it changed in BaseQNPostProcessing::iterationsConverged()
     BaseQNPostProcessing::applyFilter();
-    _preconditioner->revert(_matrixV);
+    if (scaleV) {
+      _preconditioner->revert(_matrixV);
+    }
     // |===================          ============|
 
     //              ------- RESTART/ JACOBIAN ASSEMBLY -------
@@ -816,9 +890,12 @@ void MVQNPostProcessing::specializedIterationsConverged(
       _pseudoInverseChunk.push_back(Z);
 
       /**
-       *  Restart the IMVJ according to restart type
+       *  Restart the IMVJ according to restart type, or compress the low-rank
+       *  representation of the Jacobian if its rank has grown too large
        */
-      if ((int) _WtilChunk.size() >= _chunkSize + 1) {
+      bool restart = (_imvjRestartType == NO_RESTART_LOWRANK) ? lowRankMergeRequired()
+                                                                : (int) _WtilChunk.size() >= _chunkSize + 1;
+      if (restart) {
 
         // < RESTART >
         _nbRestarts++;
@@ -38,6 +38,7 @@ public:
   static const int RS_LS      = 2;
   static const int RS_SVD     = 3;
   static const int RS_SLIDE   = 4;
+  static const int NO_RESTART_LOWRANK = 5;
 
   /**
    * @brief Constructor.
@@ -75,6 +76,12 @@ public:
     */
   virtual void specializedIterationsConverged(DataMap &cplData);
 
+  /// Exports the state of the base class and the Jacobian, or its chunks in restart mode.
+  virtual void exportState(io::BinaryWriter &writer);
+
+  /// Imports the state of the base class and the Jacobian, or its chunks in restart mode.
+  virtual void importState(io::BinaryReader &reader);
+
 private:
   /// @brief stores the approximation of the inverse Jacobian of the system at current time step.
   Eigen::MatrixXd _invJacobian;
@@ -123,6 +130,9 @@ private:
     *  - RS-ZERO:    imvj is run in restart-mode. After M time steps all stored matrices are dropped
     *  - RS-LS:      imvj in restart-mode. After M time steps restart with LS approximation for initial Jacobian
     *  - RS-SVD:     imvj in restart mode. After M time steps, update of an truncated SVD of the Jacobian.
+    *  - NO_RESTART_LOWRANK: imvj keeps all information as in normal mode, but never builds the Jacobian.
+    *                 It is stored as a sum of low-rank factors Wtil^q*Z^q, which are merged into a
+    *                 truncated SVD as soon as their accumulated rank exceeds the rank of the SVD.
     */
   int _imvjRestartType;
 
@@ -190,11 +200,20 @@ private:
     */
   void buildWtil();
 
+  /** @brief: returns true if the low-rank factors Wtil^q, Z^q need to be merged into the truncated SVD.
+    *
+    *  The merge is triggered as soon as the accumulated rank of the factors that are not yet
+    *  merged exceeds the rank of the truncated SVD (but at least the max number of used columns).
+    *  Hence, the storage of the low-rank representation is bounded by twice the rank of the SVD.
+    */
+  bool lowRankMergeRequired();
+
   /** @brief: restarts the imvj method, i.e., drops all stored matrices Wtil and Z and computes a
     *  initial guess of the Jacobian based on the given restart strategy:
     *  RS-LS:   Perform a IQN-LS least squares initial guess with _RSLSreusedTimesteps
     *  RS-SVD:  Update a truncated SVD decomposition of the SVD with rank-1 modifications from Wtil*Z
     *  RS-Zero: Start with zero information, initial guess J = 0.
+    *  NO_RESTART_LOWRANK: Merge all Wtil*Z factors into the truncated SVD, as in RS-SVD.
     */
   void restartIMVJ();
 
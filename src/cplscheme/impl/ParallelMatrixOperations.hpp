@@ -140,8 +140,15 @@ private:
     //int nextProc = (utils::MasterSlave::_rank + 1) % utils::MasterSlave::_size;
     int prevProc = (utils::MasterSlave::_rank - 1 < 0) ? utils::MasterSlave::_size - 1 : utils::MasterSlave::_rank - 1;
     int rows_rcv = (prevProc > 0) ? offsets[prevProc + 1] - offsets[prevProc] : offsets[1];
-    //Eigen::MatrixXd leftMatrix_rcv = Eigen::MatrixXd::Zero(rows_rcv, q);
+
+    /*
+     * Double buffering: leftMatrix_cur holds the block of the current cycle, which is multiplied
+     * locally and handed over to the next proc, while the block of the next cycle is received
+     * into leftMatrix_rcv. Both communication operations are posted before the local product is
+     * computed, such that the network latency is hidden behind the local GEMM.
+     */
     Eigen::MatrixXd leftMatrix_rcv(rows_rcv, q);
+    Eigen::MatrixXd leftMatrix_cur;
 
     com::PtrRequest requestSend;
     com::PtrRequest requestRcv;
@@ -156,34 +163,28 @@ private:
 
     // compute diagonal blocks where all data is local and no communication is needed
     // compute block matrices of J_inv of size (n_til x n_til), n_til = local n
-    Eigen::MatrixXd diagBlock(leftMatrix.rows(), leftMatrix.rows());
-    diagBlock.noalias() = leftMatrix * rightMatrix;
-
-    // set block at corresponding row-index on proc
     int off = offsets[utils::MasterSlave::_rank];
-    assertion(result.cols() == diagBlock.cols(), result.cols(), diagBlock.cols());
-    result.block(off, 0, diagBlock.rows(), diagBlock.cols()) = diagBlock;
+    assertion(result.cols() == rightMatrix.cols(), result.cols(), rightMatrix.cols());
+    result.block(off, 0, leftMatrix.rows(), rightMatrix.cols()).noalias() = leftMatrix * rightMatrix;
 
     /**
-		 * cyclic send-receive operation
-		 */
+     * cyclic send-receive operation
+     */
     for (int cycle = 1; cycle < utils::MasterSlave::_size; cycle++) {
 
-      // wait until W_til from previous processor is fully received
-      if (requestSend != NULL)
+      // wait until W_til from previous processor is fully received and the last block is handed over
+      if (requestSend != NULL) {
         requestSend->wait();
-      if (requestRcv != NULL)
+        requestSend = nullptr;
+      }
+      if (requestRcv != NULL) {
         requestRcv->wait();
-
-      // leftMatrix (leftMatrix_rcv) is available - needed for local multiplication and hand over to next proc
-      Eigen::MatrixXd leftMatrix_copy(leftMatrix_rcv);
-
-      // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
-      if (cycle < utils::MasterSlave::_size - 1) {
-        if (leftMatrix_copy.size() > 0)
-          requestSend = _cyclicCommRight->aSend(leftMatrix_copy.data(), leftMatrix_copy.size(), 0);
+        requestRcv = nullptr;
       }
 
+      // the received block becomes the current block, the buffer of the old block is free for the next receive
+      leftMatrix_cur.swap(leftMatrix_rcv);
+
       // compute proc that owned leftMatrix_rcv (Wtil_rcv) at the very beginning for each cylce
       int sourceProc_nextCycle = (utils::MasterSlave::_rank - (cycle + 1) < 0) ? utils::MasterSlave::_size + (utils::MasterSlave::_rank - (cycle + 1)) : utils::MasterSlave::_rank - (cycle + 1);
 
@@ -191,28 +192,31 @@ private:
 
       int rows_rcv_nextCycle = (sourceProc_nextCycle > 0) ? offsets[sourceProc_nextCycle + 1] - offsets[sourceProc_nextCycle] : offsets[1];
       rows_rcv               = (sourceProc > 0) ? offsets[sourceProc + 1] - offsets[sourceProc] : offsets[1];
-      leftMatrix_rcv         = Eigen::MatrixXd::Zero(rows_rcv_nextCycle, q);
+      assertion(leftMatrix_cur.rows() == rows_rcv, leftMatrix_cur.rows(), rows_rcv);
 
-      // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
       if (cycle < utils::MasterSlave::_size - 1) {
+        // initiate async send to hand over leftMatrix (W_til) to the next proc (this data will be needed in the next cycle)    dim: n_local x cols
+        if (leftMatrix_cur.size() > 0)
+          requestSend = _cyclicCommRight->aSend(leftMatrix_cur.data(), leftMatrix_cur.size(), 0);
+
+        // initiate asynchronous receive operation for leftMatrix (W_til) from previous processor --> W_til (this data is needed in the next cycle)
+        leftMatrix_rcv.resize(rows_rcv_nextCycle, q);
         if (leftMatrix_rcv.size() > 0) // only receive data, if data has been sent
           requestRcv = _cyclicCommLeft->aReceive(leftMatrix_rcv.data(), leftMatrix_rcv.size(), 0);
       }
 
-      if (requestSend != NULL)
-        requestSend->wait();
-      // compute block with new local data
-      Eigen::MatrixXd block(rows_rcv, rightMatrix.cols());
-      block.noalias() = leftMatrix_copy * rightMatrix;
-
-      // set block at corresponding index in J_inv
+      // compute block with new local data, while the communication for the next cycle is in flight
+      // and set it at corresponding index in J_inv
       // the row-offset of the current block is determined by the proc that sends the part of the W_til matrix
       // note: the direction and ordering of the cyclic sending operation is chosen s.t. the computed block is
       //       local on the current processor (in J_inv).
       off = offsets[sourceProc];
-      assertion(result.cols() == block.cols(), result.cols(), block.cols());
-      result.block(off, 0, block.rows(), block.cols()) = block;
+      result.block(off, 0, rows_rcv, rightMatrix.cols()).noalias() = leftMatrix_cur * rightMatrix;
     }
+
+    // the send buffer needs to stay valid until the last send operation has completed
+    if (requestSend != NULL)
+      requestSend->wait();
   }
 
   // @brief multiplies matrices based on a dot-product computation with a rectangular result matrix
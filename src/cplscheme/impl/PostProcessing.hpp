@@ -10,8 +10,8 @@ namespace precice
 {
 namespace io
 {
-class TXTWriter;
-class TXTReader;
+class BinaryWriter;
+class BinaryReader;
 }
 }
 
@@ -67,9 +67,11 @@ public:
    */
   virtual void setCoarseModelOptimizationActive(bool *coarseOptimizationActive){};
 
-  virtual void exportState(io::TXTWriter &writer) {}
+  /// Writes the state of the post-processing, which is kept between timesteps, to a checkpoint.
+  virtual void exportState(io::BinaryWriter &writer) {}
 
-  virtual void importState(io::TXTReader &reader) {}
+  /// Restores the state of the post-processing from a checkpoint of the same decomposition.
+  virtual void importState(io::BinaryReader &reader) {}
 
   /**
    * @brief performs one optimization step of the optimization problem
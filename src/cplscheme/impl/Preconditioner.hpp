@@ -1,8 +1,12 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cmath>
 #include <vector>
 #include "../SharedPointer.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
+#include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice
@@ -20,6 +24,8 @@ namespace impl
  * apply() applies the weighting, i.e. transforms from physical values to balanced values.
  * revert() reverts the weighting, i.e. transforms from balanced values back to physical values.
  * update() updates the preconditioner, after every FSI iteration (though some variants might only be updated after a complete timestep)
+ *
+ * The weights are stored per entry, such that apply() and revert() are single vectorized passes over the data.
  */
 class Preconditioner
 {
@@ -47,8 +53,8 @@ public:
       N += elem;
     }
     // cannot do this already in the constructor as the size is unknown at that point
-    _weights.resize(N, 1.0);
-    _invWeights.resize(N, 1.0);
+    _weights    = Eigen::VectorXd::Ones(N);
+    _invWeights = Eigen::VectorXd::Ones(N);
   }
 
   /**
@@ -59,19 +65,11 @@ public:
   {
     TRACE();
     if (transpose) {
-      assertion(M.cols() == (int) _weights.size(), M.cols(), _weights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _weights[i];
-        }
-      }
+      assertion(M.cols() == _weights.size(), M.cols(), _weights.size());
+      M.array().rowwise() *= _weights.transpose().array();
     } else {
-      assertion(M.rows() == (int) _weights.size(), M.rows(), (int) _weights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _weights[j];
-        }
-      }
+      assertion(M.rows() == _weights.size(), M.rows(), _weights.size());
+      M.array().colwise() *= _weights.array();
     }
   }
 
@@ -82,21 +80,12 @@ public:
   void revert(Eigen::MatrixXd &M, bool transpose)
   {
     TRACE();
-    //assertion(_needsGlobalWeights);
     if (transpose) {
-      assertion(M.cols() == (int) _invWeights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _invWeights[i];
-        }
-      }
+      assertion(M.cols() == _invWeights.size(), M.cols(), _invWeights.size());
+      M.array().rowwise() *= _invWeights.transpose().array();
     } else {
-      assertion(M.rows() == (int) _invWeights.size(), M.rows(), (int) _invWeights.size());
-      for (int i = 0; i < M.cols(); i++) {
-        for (int j = 0; j < M.rows(); j++) {
-          M(j, i) *= _invWeights[j];
-        }
-      }
+      assertion(M.rows() == _invWeights.size(), M.rows(), _invWeights.size());
+      M.array().colwise() *= _invWeights.array();
     }
   }
 
@@ -104,55 +93,32 @@ public:
   void apply(Eigen::MatrixXd &M)
   {
     TRACE();
-    assertion(M.rows() == (int) _weights.size(), M.rows(), (int) _weights.size());
-
-    // scale matrix M
-    for (int i = 0; i < M.cols(); i++) {
-      for (int j = 0; j < M.rows(); j++) {
-        M(j, i) *= _weights[j];
-      }
-    }
+    assertion(M.rows() == _weights.size(), M.rows(), _weights.size());
+    M.array().colwise() *= _weights.array();
   }
 
   /// To transform physical values to balanced values. Vector version
   void apply(Eigen::VectorXd &v)
   {
     TRACE();
-
-    assertion(v.size() == (int) _weights.size());
-
-    // scale residual
-    for (int j = 0; j < v.size(); j++) {
-      v[j] *= _weights[j];
-    }
+    assertion(v.size() == _weights.size(), v.size(), _weights.size());
+    v.array() *= _weights.array();
   }
 
   /// To transform balanced values back to physical values. Matrix version
   void revert(Eigen::MatrixXd &M)
   {
     TRACE();
-
-    assertion(M.rows() == (int) _weights.size());
-
-    // scale matrix M
-    for (int i = 0; i < M.cols(); i++) {
-      for (int j = 0; j < M.rows(); j++) {
-        M(j, i) *= _invWeights[j];
-      }
-    }
+    assertion(M.rows() == _invWeights.size(), M.rows(), _invWeights.size());
+    M.array().colwise() *= _invWeights.array();
   }
 
   /// To transform balanced values back to physical values. Vector version
   void revert(Eigen::VectorXd &v)
   {
     TRACE();
-
-    assertion(v.size() == (int) _weights.size());
-
-    // scale residual
-    for (int j = 0; j < v.size(); j++) {
-      v[j] *= _invWeights[j];
-    }
+    assertion(v.size() == _invWeights.size(), v.size(), _invWeights.size());
+    v.array() *= _invWeights.array();
   }
 
   /**
@@ -192,7 +158,8 @@ public:
     _requireNewQR = false;
   }
 
-  std::vector<double> &getWeights()
+  /// Per-entry weights, to fold the scaling into other operations, e.g., Q^T * (weights .* r)
+  const Eigen::VectorXd &getWeights()
   {
     return _weights;
   }
@@ -202,12 +169,37 @@ public:
     return _freezed;
   }
 
+  /// Writes the weights and the number of non-const timesteps to a checkpoint.
+  void exportState(io::BinaryWriter &writer)
+  {
+    writer.write(_weights);
+    writer.write(_invWeights);
+    writer.write(_nbNonConstTimesteps);
+    writer.write(_requireNewQR);
+    writer.write(_freezed);
+  }
+
+  /// Restores the weights from a checkpoint, which has to match the sub-vector sizes.
+  void importState(io::BinaryReader &reader)
+  {
+    TRACE();
+    long size = _weights.size();
+    reader.read(_weights);
+    reader.read(_invWeights);
+    CHECK(_weights.size() == size && _invWeights.size() == size,
+          "The preconditioner weights of the checkpoint do not match the coupling data. "
+              << "A checkpoint can only be restored on the same decomposition of the coupling meshes.");
+    reader.read(_nbNonConstTimesteps);
+    reader.read(_requireNewQR);
+    reader.read(_freezed);
+  }
+
 protected:
   /// Weights used to scale the matrix V and the residual
-  std::vector<double> _weights;
+  Eigen::VectorXd _weights;
 
   /// Inverse weights (for efficiency reasons)
-  std::vector<double> _invWeights;
+  Eigen::VectorXd _invWeights;
 
   /// Sizes of each sub-vector, i.e. each coupling data
   std::vector<size_t> _subVectorSizes;
@@ -233,6 +225,37 @@ protected:
    */
   virtual void _update_(bool timestepComplete, const Eigen::VectorXd &oldValues, const Eigen::VectorXd &res) = 0;
 
+  /// Sets the weights of all entries of sub-vector k to 1/factors[k]
+  void setSubVectorFactors(const std::vector<double> &factors)
+  {
+    assertion(factors.size() == _subVectorSizes.size(), factors.size(), _subVectorSizes.size());
+    int offset = 0;
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      _weights.segment(offset, _subVectorSizes[k]).setConstant(1.0 / factors[k]);
+      _invWeights.segment(offset, _subVectorSizes[k]).setConstant(factors[k]);
+      offset += _subVectorSizes[k];
+    }
+  }
+
+  /// Computes the global l2-norms of all sub-vectors of v with a single reduction
+  std::vector<double> subVectorNorms(const Eigen::VectorXd &v)
+  {
+    std::vector<double> localSquares(_subVectorSizes.size(), 0.0);
+    int                 offset = 0;
+    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
+      localSquares[k] = v.segment(offset, _subVectorSizes[k]).squaredNorm();
+      offset += _subVectorSizes[k];
+    }
+    std::vector<double> norms = localSquares;
+    if (utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode) {
+      utils::MasterSlave::allreduceSum(localSquares.data(), norms.data(), localSquares.size());
+    }
+    for (double &norm : norms) {
+      norm = std::sqrt(norm);
+    }
+    return norms;
+  }
+
 private:
   logging::Logger _log{"cplscheme::Preconditioner"};
 };
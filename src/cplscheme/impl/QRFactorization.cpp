@@ -1,6 +1,8 @@
 #include "QRFactorization.hpp"
 #include "com/Communication.hpp"
 #include "cplscheme/impl/BaseQNPostProcessing.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
 
 #include <algorithm> // std::sort
 #include <cmath>
@@ -332,18 +334,17 @@ int QRFactorization::orthogonalize(
   while (!termination) {
 
     // take a gram-schmidt iteration
-    u = Eigen::VectorXd::Zero(_rows);
-    for (int j = 0; j < colNum; j++) {
-
-      // dot-product <_Q(:,j), v >
-      Eigen::VectorXd Qc = _Q.col(j);
-
-      // dot product <_Q(:,j), v> =: r_ij
-      double r_ij = utils::MasterSlave::dot(Qc, v);
-      // save r_ij in s(j) = column of R
-      s(j) = r_ij;
+    // dot products r_ij = <_Q(:,j), v> for all columns, saved in s = column of R, reduced at once
+    // the first column is inserted into an empty _Q, then s and u are zero
+    if (colNum > 0) {
+      Eigen::VectorXd localS;
+      _threadedOps.multiplyTransposed(_Q.leftCols(colNum), v, localS);
+      s = localS;
+      if (utils::MasterSlave::_masterMode || utils::MasterSlave::_slaveMode) {
+        utils::MasterSlave::allreduceSum(localS.data(), s.data(), colNum);
+      }
       // u is the sum of projections r_ij * _Q(:,j) =  _Q(:,j) * <_Q(:,j), v>
-      u += _Q.col(j) * r_ij;
+      _threadedOps.multiply(_Q.leftCols(colNum), s, u);
     }
     // add the furier coefficients over all orthogonalize iterations
     for (int j = 0; j < colNum; j++) {
@@ -772,6 +773,31 @@ void QRFactorization::setfstream(std::fstream *stream)
   _fstream_set = true;
 }
 
+void QRFactorization::setThreads(int threads)
+{
+  _threadedOps.setThreads(threads);
+}
+
+void QRFactorization::exportState(io::BinaryWriter &writer)
+{
+  writer.write(_Q);
+  writer.write(_R);
+  writer.write(_rows);
+  writer.write(_cols);
+}
+
+void QRFactorization::importState(io::BinaryReader &reader)
+{
+  reader.read(_Q);
+  reader.read(_R);
+  reader.read(_rows);
+  reader.read(_cols);
+  assertion(_R.rows() == _cols, _R.rows(), _cols);
+  assertion(_R.cols() == _cols, _R.cols(), _cols);
+  assertion(_Q.cols() == _cols, _Q.cols(), _cols);
+  assertion(_Q.rows() == _rows, _Q.rows(), _rows);
+}
+
 void QRFactorization::setFilter(int filter)
 {
   _filter = filter;
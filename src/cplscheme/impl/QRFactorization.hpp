@@ -2,9 +2,19 @@
 
 #include <Eigen/Core>
 #include <fstream>
+#include "ThreadedMatrixOperations.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
 
+namespace precice
+{
+namespace io
+{
+class BinaryWriter;
+class BinaryReader;
+}
+}
+
 namespace precice
 {
 namespace cplscheme
@@ -159,6 +169,15 @@ public:
   // @brief sets the filtering technique to maintain good conditioning of the least squares system
   void setFilter(int filter);
 
+  // @brief sets the number of threads for the local products with Q
+  void setThreads(int threads);
+
+  // @brief writes the local rows of Q and R to a checkpoint
+  void exportState(io::BinaryWriter &writer);
+
+  // @brief restores Q and R from a checkpoint, the global rows are kept
+  void importState(io::BinaryReader &reader);
+
 private:
   struct givensRot {
     int    i, j;
@@ -221,6 +240,8 @@ private:
   bool          _fstream_set;
 
   int _globalRows;
+
+  ThreadedMatrixOperations _threadedOps;
 };
 }
 }
@@ -1,5 +1,4 @@
 #include "ResidualSumPreconditioner.hpp"
-#include "utils/MasterSlave.hpp"
 
 namespace precice
 {
@@ -27,20 +26,11 @@ void ResidualSumPreconditioner::_update_(bool timestepComplete,
                                          const Eigen::VectorXd &res)
 {
   if (not timestepComplete) {
-    std::vector<double> norms(_subVectorSizes.size(), 0.0);
+    std::vector<double> norms = subVectorNorms(res);
 
     double sum = 0.0;
-
-    int offset = 0;
-    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      Eigen::VectorXd part = Eigen::VectorXd::Zero(_subVectorSizes[k]);
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        part(i) = res(i + offset);
-      }
-      norms[k] = utils::MasterSlave::dot(part, part);
-      sum += norms[k];
-      offset += _subVectorSizes[k];
-      norms[k] = std::sqrt(norms[k]);
+    for (double norm : norms) {
+      sum += norm * norm;
     }
     sum = std::sqrt(sum);
     assertion(sum > 0);
@@ -49,15 +39,7 @@ void ResidualSumPreconditioner::_update_(bool timestepComplete,
       _residualSum[k] += norms[k] / sum;
       assertion(_residualSum[k] > 0);
     }
-
-    offset = 0;
-    for (size_t k = 0; k < _subVectorSizes.size(); k++) {
-      for (size_t i = 0; i < _subVectorSizes[k]; i++) {
-        _weights[i + offset]    = 1 / _residualSum[k];
-        _invWeights[i + offset] = _residualSum[k];
-      }
-      offset += _subVectorSizes[k];
-    }
+    setSubVectorFactors(_residualSum);
 
     _requireNewQR = true;
   } else {
@@ -299,6 +299,34 @@ int SVDFactorization::rank()
 {
   return _cols;
 }
+
+void SVDFactorization::exportState(io::BinaryWriter &writer)
+{
+  writer.write(_psi);
+  writer.write(_phi);
+  writer.write(_sigma);
+  writer.write(_rows);
+  writer.write(_cols);
+  writer.write(_preconditionerApplied);
+  writer.write(_initialSVD);
+  writer.write(_applyFilterQR);
+  writer.write(_epsQR2);
+}
+
+void SVDFactorization::importState(io::BinaryReader &reader)
+{
+  reader.read(_psi);
+  reader.read(_phi);
+  reader.read(_sigma);
+  reader.read(_rows);
+  reader.read(_cols);
+  reader.read(_preconditionerApplied);
+  reader.read(_initialSVD);
+  reader.read(_applyFilterQR);
+  reader.read(_epsQR2);
+  assertion(_psi.rows() == _rows, _psi.rows(), _rows);
+  assertion(_sigma.size() == _cols, _sigma.size(), _cols);
+}
 }
 }
 } // namespace precice, cplscheme, impl
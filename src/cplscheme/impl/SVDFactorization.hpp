@@ -158,7 +158,7 @@ public:
 
     int waste = 0;
     for (int i = 0; i < (int) _sigma.size(); i++) {
-      if (_sigma(i) < (int) _sigma(0) * _truncationEps) {
+      if (_sigma(i) < _sigma(0) * _truncationEps) {
         _cols = i;
         waste = _sigma.size() - i;
         break;
@@ -236,6 +236,12 @@ public:
   /// Optional file-stream for logging output
   void setfstream(std::fstream *stream);
 
+  /// @brief: writes the local rows of the truncated SVD factorization to a checkpoint
+  void exportState(io::BinaryWriter &writer);
+
+  /// @brief: restores the truncated SVD factorization from a checkpoint
+  void importState(io::BinaryReader &reader);
+
 private:
   /** @brief: computes the QR decomposition of a matrix A of type A = PSI^T*A \in R^(rank x n)
    *
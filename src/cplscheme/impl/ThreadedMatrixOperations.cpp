@@ -0,0 +1,104 @@
+#include "ThreadedMatrixOperations.hpp"
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "utils/assertion.hpp"
+
+namespace precice
+{
+namespace cplscheme
+{
+namespace impl
+{
+
+ThreadedMatrixOperations::ThreadedMatrixOperations(
+    int threads)
+    : _threads(threads)
+{
+  CHECK(threads > 0, "The number of threads for the post-processing has to be larger than zero!");
+  Eigen::initParallel();
+}
+
+void ThreadedMatrixOperations::setThreads(
+    int threads)
+{
+  CHECK(threads > 0, "The number of threads for the post-processing has to be larger than zero!");
+  _threads = threads;
+}
+
+void ThreadedMatrixOperations::multiply(
+    const Eigen::Ref<const Eigen::MatrixXd> &A,
+    const Eigen::Ref<const Eigen::VectorXd> &x,
+    Eigen::VectorXd &                        result) const
+{
+  assertion(A.cols() == x.size(), A.cols(), x.size());
+  result.resize(A.rows());
+  forRowBlocks(A.rows(), A.cols(), [&](int block, int begin, int size) {
+    result.segment(begin, size).noalias() = A.middleRows(begin, size) * x;
+  });
+}
+
+void ThreadedMatrixOperations::multiply(
+    const Eigen::Ref<const Eigen::MatrixXd> &A,
+    const Eigen::Ref<const Eigen::MatrixXd> &B,
+    Eigen::MatrixXd &                        result) const
+{
+  assertion(A.cols() == B.rows(), A.cols(), B.rows());
+  result.resize(A.rows(), B.cols());
+  forRowBlocks(A.rows(), A.cols() * B.cols(), [&](int block, int begin, int size) {
+    result.middleRows(begin, size).noalias() = A.middleRows(begin, size) * B;
+  });
+}
+
+void ThreadedMatrixOperations::multiplyTransposed(
+    const Eigen::Ref<const Eigen::MatrixXd> &A,
+    const Eigen::Ref<const Eigen::VectorXd> &x,
+    Eigen::VectorXd &                        result) const
+{
+  assertion(A.rows() == x.size(), A.rows(), x.size());
+  std::vector<Eigen::VectorXd> partialResults(getBlocks(A.rows(), A.cols()));
+  forRowBlocks(A.rows(), A.cols(), [&](int block, int begin, int size) {
+    partialResults[block].noalias() = A.middleRows(begin, size).transpose() * x.segment(begin, size);
+  });
+  result = partialResults[0];
+  for (size_t block = 1; block < partialResults.size(); block++) {
+    result += partialResults[block];
+  }
+}
+
+void ThreadedMatrixOperations::forRowBlocks(
+    int                                         rows,
+    int                                         cols,
+    const std::function<void(int, int, int)> &f) const
+{
+  int blocks = getBlocks(rows, cols);
+  if (blocks == 1) {
+    f(0, 0, rows);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  int                      begin = rows / blocks + (rows % blocks > 0 ? 1 : 0);
+  for (int block = 1; block < blocks; block++) {
+    int size = rows / blocks + (block < rows % blocks ? 1 : 0);
+    threads.emplace_back(f, block, begin, size);
+    begin += size;
+  }
+  assertion(begin == rows, begin, rows);
+  f(0, 0, rows / blocks + (rows % blocks > 0 ? 1 : 0));
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+}
+
+int ThreadedMatrixOperations::getBlocks(
+    int rows, int cols) const
+{
+  // starting a thread does not pay off for small products
+  long entries = static_cast<long>(rows) * std::max(cols, 1);
+  long blocks  = std::min<long>(_threads, entries / MIN_ENTRIES_PER_THREAD);
+  return static_cast<int>(std::max(1L, std::min<long>(blocks, rows)));
+}
+}
+}
+} // namespace precice, cplscheme, impl
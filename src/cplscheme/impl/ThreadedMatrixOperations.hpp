@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <functional>
+#include "logging/Logger.hpp"
+
+namespace precice
+{
+namespace cplscheme
+{
+namespace impl
+{
+
+/**
+ * @brief Dense products of the rank-local parts of the quasi-Newton matrices.
+ *
+ * The rows of the (tall) local matrices are split into blocks, which are
+ * processed by several threads of the rank. Products which are too small
+ * to amortize starting the threads are computed serially.
+ */
+class ThreadedMatrixOperations
+{
+public:
+  explicit ThreadedMatrixOperations(int threads = 1);
+
+  /// Sets the number of threads used per rank.
+  void setThreads(int threads);
+
+  int getThreads() const
+  {
+    return _threads;
+  }
+
+  /// Computes result = A * x.
+  void multiply(
+      const Eigen::Ref<const Eigen::MatrixXd> &A,
+      const Eigen::Ref<const Eigen::VectorXd> &x,
+      Eigen::VectorXd &                        result) const;
+
+  /// Computes result = A * B.
+  void multiply(
+      const Eigen::Ref<const Eigen::MatrixXd> &A,
+      const Eigen::Ref<const Eigen::MatrixXd> &B,
+      Eigen::MatrixXd &                        result) const;
+
+  /// Computes result = A^T * x, the partial products of the row blocks are summed up.
+  void multiplyTransposed(
+      const Eigen::Ref<const Eigen::MatrixXd> &A,
+      const Eigen::Ref<const Eigen::VectorXd> &x,
+      Eigen::VectorXd &                        result) const;
+
+  /**
+   * @brief Calls f(block, begin, size) for every row block of a rows x cols matrix.
+   *
+   * The blocks are processed concurrently, f may only write to data of its block.
+   */
+  void forRowBlocks(
+      int                                           rows,
+      int                                           cols,
+      const std::function<void(int, int, int)> &f) const;
+
+private:
+  logging::Logger _log{"cplscheme::impl::ThreadedMatrixOperations"};
+
+  /// Minimal number of matrix entries processed by one thread.
+  static const long MIN_ENTRIES_PER_THREAD = 32768;
+
+  int _threads;
+
+  /// Returns the number of row blocks for a rows x cols matrix.
+  int getBlocks(int rows, int cols) const;
+};
+}
+}
+} // namespace precice, cplscheme, impl
@@ -0,0 +1,100 @@
+#include <Eigen/Core>
+#include "LinearFixedPointProblem.hpp"
+#include "cplscheme/SharedPointer.hpp"
+#include "cplscheme/impl/ConstantPreconditioner.hpp"
+#include "cplscheme/impl/IQNILSPostProcessing.hpp"
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::cplscheme;
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+BOOST_AUTO_TEST_SUITE(IQNILSPostProcessingTests)
+
+/// Linear fixed-point problem of size 100 with a moderate coupling of the unknowns
+const tests::LinearFixedPointProblem problem(100, 0.5, 0.1);
+
+BOOST_AUTO_TEST_CASE(testCompressedHistory)
+{
+  double           initialRelaxation = 0.1;
+  int              maxIterationsUsed = 80;
+  int              timestepsReused   = 8;
+  int              filter            = impl::BaseQNPostProcessing::QR1FILTER;
+  double           singularityLimit  = 1e-12;
+  std::vector<int> dataIDs{0};
+  const int        timesteps = 12;
+
+  impl::PtrPreconditioner fullConditioner(new impl::ConstantPreconditioner({1.0}));
+  impl::IQNILSPostProcessing fullIQNILS(initialRelaxation, false, maxIterationsUsed, timestepsReused,
+                                        filter, singularityLimit, dataIDs, fullConditioner);
+  Eigen::VectorXd fullValues;
+  int             fullIterations = problem.solve(fullIQNILS, timesteps, fullValues);
+
+  impl::PtrPreconditioner compressedConditioner(new impl::ConstantPreconditioner({1.0}));
+  impl::IQNILSPostProcessing compressedIQNILS(initialRelaxation, false, maxIterationsUsed, timestepsReused,
+                                              filter, singularityLimit, dataIDs, compressedConditioner);
+  compressedIQNILS.setHistoryCompression(3);
+  Eigen::VectorXd compressedValues;
+  int             compressedIterations = problem.solve(compressedIQNILS, timesteps, compressedValues);
+
+  // without reused timesteps as reference
+  impl::PtrPreconditioner plainConditioner(new impl::ConstantPreconditioner({1.0}));
+  impl::IQNILSPostProcessing plainIQNILS(initialRelaxation, false, maxIterationsUsed, 0,
+                                         filter, singularityLimit, dataIDs, plainConditioner);
+  Eigen::VectorXd plainValues;
+  int             plainIterations = problem.solve(plainIQNILS, timesteps, plainValues);
+
+  BOOST_TEST_MESSAGE("Iterations: " << fullIterations << " reused, " << compressedIterations
+                                    << " reused and compressed, " << plainIterations << " not reused");
+  BOOST_TEST(testing::equals(fullValues, compressedValues, 1e-8));
+  BOOST_TEST(fullIterations <= compressedIterations);
+  BOOST_TEST(compressedIterations < plainIterations);
+}
+
+BOOST_AUTO_TEST_CASE(testCheckpointRestart, *testing::OnMaster())
+{
+  double           initialRelaxation = 0.1;
+  int              maxIterationsUsed = 80;
+  int              timestepsReused   = 8;
+  int              filter            = impl::BaseQNPostProcessing::QR1FILTER;
+  double           singularityLimit  = 1e-12;
+  std::vector<int> dataIDs{0};
+  const int        restartTimestep = 6;
+  const int        timesteps       = 12;
+
+  // uninterrupted reference run
+  impl::PtrPreconditioner refConditioner(new impl::ConstantPreconditioner({1.0}));
+  impl::IQNILSPostProcessing refIQNILS(initialRelaxation, false, maxIterationsUsed, timestepsReused,
+                                       filter, singularityLimit, dataIDs, refConditioner);
+  Eigen::VectorXd refValues = Eigen::VectorXd::Zero(100);
+  impl::PostProcessing::DataMap refData = problem.createData(refValues);
+  refIQNILS.initialize(refData);
+  problem.solveTimesteps(refIQNILS, refData, 0, restartTimestep, refValues);
+  Eigen::VectorXd checkpointValues = refValues;
+  {
+    io::BinaryWriter writer("cplscheme-IQNILSCheckpointTest.bin");
+    refIQNILS.exportState(writer);
+  }
+  int refIterations = problem.solveTimesteps(refIQNILS, refData, restartTimestep, timesteps, refValues);
+
+  // restarted run, the solver restores its own state
+  impl::PtrPreconditioner restartConditioner(new impl::ConstantPreconditioner({1.0}));
+  impl::IQNILSPostProcessing restartIQNILS(initialRelaxation, false, maxIterationsUsed, timestepsReused,
+                                           filter, singularityLimit, dataIDs, restartConditioner);
+  Eigen::VectorXd restartValues = checkpointValues;
+  impl::PostProcessing::DataMap restartData = problem.createData(restartValues);
+  restartIQNILS.initialize(restartData);
+  {
+    io::BinaryReader reader("cplscheme-IQNILSCheckpointTest.bin");
+    restartIQNILS.importState(reader);
+  }
+  int restartIterations = problem.solveTimesteps(restartIQNILS, restartData, restartTimestep, timesteps, restartValues);
+
+  BOOST_TEST(restartIterations == refIterations);
+  BOOST_TEST(testing::equals(refValues, restartValues, 1e-10));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // IQNILSPostProcessingTests
+BOOST_AUTO_TEST_SUITE_END() // CplSchemeTests
@@ -0,0 +1,76 @@
+#include "LinearFixedPointProblem.hpp"
+#include <cmath>
+#include "cplscheme/CouplingData.hpp"
+#include "mesh/Mesh.hpp"
+
+namespace precice {
+namespace cplscheme {
+namespace tests {
+
+LinearFixedPointProblem:: LinearFixedPointProblem
+(
+  int    size,
+  double coupling,
+  double decay )
+:
+  _A(size, size)
+{
+  for (int i = 0; i < size; i++) {
+    for (int j = 0; j < size; j++) {
+      _A(i, j) = coupling / (1.0 + std::abs(i - j)) / (1.0 + decay * std::abs(i - j));
+    }
+  }
+}
+
+LinearFixedPointProblem::DataMap LinearFixedPointProblem:: createData
+(
+  Eigen::VectorXd &values ) const
+{
+  mesh::PtrMesh dummyMesh(new mesh::Mesh("DummyMesh", 3, false));
+  DataMap       data;
+  data.insert(std::make_pair(0, PtrCouplingData(new CouplingData(&values, dummyMesh, false, 1))));
+  return data;
+}
+
+int LinearFixedPointProblem:: solveTimesteps
+(
+  impl::PostProcessing &pp,
+  DataMap &             data,
+  int                   first,
+  int                   last,
+  Eigen::VectorXd &     values ) const
+{
+  const int n = _A.rows();
+  int totalIterations = 0;
+  for (int t = first; t < last; t++) {
+    Eigen::VectorXd b(n);
+    for (int i = 0; i < n; i++) {
+      b(i) = std::sin(0.3 * i + 0.5 * t);
+    }
+    for (int it = 0; it < 100; it++) {
+      totalIterations++;
+      data.at(0)->oldValues.col(0) = values;
+      values                       = _A * values + b;
+      if ((values - data.at(0)->oldValues.col(0)).norm() < 1e-10) {
+        pp.iterationsConverged(data);
+        break;
+      }
+      pp.performPostProcessing(data);
+    }
+  }
+  return totalIterations;
+}
+
+int LinearFixedPointProblem:: solve
+(
+  impl::PostProcessing &pp,
+  int                   timesteps,
+  Eigen::VectorXd &     values ) const
+{
+  values       = Eigen::VectorXd::Zero(_A.rows());
+  DataMap data = createData(values);
+  pp.initialize(data);
+  return solveTimesteps(pp, data, 0, timesteps, values);
+}
+
+}}} // namespace precice, cplscheme, tests
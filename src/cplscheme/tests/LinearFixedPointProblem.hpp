@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Eigen/Core>
+#include "cplscheme/impl/PostProcessing.hpp"
+
+namespace precice {
+namespace cplscheme {
+namespace tests {
+
+/**
+ * @brief Linear fixed-point problem x = A*x + b(t) to test the convergence of post-processings.
+ *
+ * The entries of A decay with the distance to the diagonal,
+ * A(i,j) = coupling / (1 + |i-j|) / (1 + decay*|i-j|), and b(i) = sin(0.3*i + 0.5*t).
+ */
+class LinearFixedPointProblem
+{
+public:
+  using DataMap = impl::PostProcessing::DataMap;
+
+  LinearFixedPointProblem(
+    int    size,
+    double coupling,
+    double decay = 0.0);
+
+  /// Wraps values of the size of the problem as coupling data with ID 0.
+  DataMap createData(Eigen::VectorXd &values) const;
+
+  /**
+   * @brief Solves the problem for the time steps [first, last), starting from the given values.
+   *
+   * Returns the number of coupling iterations, the last solution is stored in values.
+   */
+  int solveTimesteps(
+    impl::PostProcessing &pp,
+    DataMap &             data,
+    int                   first,
+    int                   last,
+    Eigen::VectorXd &     values) const;
+
+  /// Initializes the post-processing and solves the problem for a number of time steps, starting from zero.
+  int solve(
+    impl::PostProcessing &pp,
+    int                   timesteps,
+    Eigen::VectorXd &     values) const;
+
+private:
+  Eigen::MatrixXd _A;
+};
+
+}}} // namespace precice, cplscheme, tests
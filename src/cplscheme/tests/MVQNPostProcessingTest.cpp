@@ -0,0 +1,80 @@
+#ifndef PRECICE_NO_MPI
+
+#include <Eigen/Core>
+#include "LinearFixedPointProblem.hpp"
+#include "cplscheme/SharedPointer.hpp"
+#include "cplscheme/impl/ConstantPreconditioner.hpp"
+#include "cplscheme/impl/MVQNPostProcessing.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::cplscheme;
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+BOOST_AUTO_TEST_SUITE(MVQNPostProcessingTests)
+
+/// Linear fixed-point problem of size 12 with a weak coupling of the unknowns
+const tests::LinearFixedPointProblem problem(12, 0.15);
+
+/**
+ * @brief Runs the IMVJ for every restart mode against the dense Jacobian of NO_RESTART
+ *
+ * As long as no restart is triggered, the chunks Wtil^q*Z^q of the restart modes and the low-rank
+ * representation hold the same information as the dense Jacobian and must give identical iterates.
+ * With restarts, every mode still has to converge in every time step.
+ */
+BOOST_AUTO_TEST_CASE(testRestartModes)
+{
+  double           initialRelaxation = 0.1;
+  int              maxIterationsUsed = 4;
+  int              timestepsReused   = 0;
+  int              filter            = impl::BaseQNPostProcessing::QR2FILTER;
+  double           singularityLimit  = 1e-12;
+  int              timesteps         = 6;
+  std::vector<int> dataIDs{0};
+
+  // dense Jacobian as reference
+  impl::PtrPreconditioner denseConditioner(new impl::ConstantPreconditioner({1.0}));
+  impl::MVQNPostProcessing denseMVQN(initialRelaxation, false, maxIterationsUsed, timestepsReused,
+                                     filter, singularityLimit, dataIDs, denseConditioner, false,
+                                     impl::MVQNPostProcessing::NO_RESTART, 0, 0, 0.0);
+  Eigen::VectorXd denseValues;
+  int             denseIterations = problem.solve(denseMVQN, timesteps, denseValues);
+
+  std::vector<int> restartModes{impl::MVQNPostProcessing::RS_ZERO,
+                                impl::MVQNPostProcessing::RS_LS,
+                                impl::MVQNPostProcessing::RS_SVD,
+                                impl::MVQNPostProcessing::RS_SLIDE,
+                                impl::MVQNPostProcessing::NO_RESTART_LOWRANK};
+  for (int restartMode : restartModes) {
+    BOOST_TEST_CONTEXT("IMVJ restart mode " << restartMode)
+    {
+      // chunk size beyond the number of time steps, no restart is triggered
+      impl::PtrPreconditioner noRestartConditioner(new impl::ConstantPreconditioner({1.0}));
+      impl::MVQNPostProcessing noRestartMVQN(initialRelaxation, false, maxIterationsUsed, timestepsReused,
+                                             filter, singularityLimit, dataIDs, noRestartConditioner, false,
+                                             restartMode, timesteps + 2, 1, 0.0);
+      Eigen::VectorXd noRestartValues;
+      int             noRestartIterations = problem.solve(noRestartMVQN, timesteps, noRestartValues);
+
+      BOOST_TEST(noRestartIterations == denseIterations);
+      BOOST_TEST(testing::equals(noRestartValues, denseValues, 1e-8));
+
+      // restart every second time step
+      impl::PtrPreconditioner restartConditioner(new impl::ConstantPreconditioner({1.0}));
+      impl::MVQNPostProcessing restartMVQN(initialRelaxation, false, maxIterationsUsed, timestepsReused,
+                                           filter, singularityLimit, dataIDs, restartConditioner, false,
+                                           restartMode, 2, 1, 0.0);
+      Eigen::VectorXd restartValues;
+      int             restartIterations = problem.solve(restartMVQN, timesteps, restartValues);
+
+      BOOST_TEST(restartIterations < timesteps * 20);
+      BOOST_TEST(testing::equals(restartValues, denseValues, 1e-8));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // MVQNPostProcessingTests
+BOOST_AUTO_TEST_SUITE_END() // CplSchemeTests
+
+#endif // PRECICE_NO_MPI
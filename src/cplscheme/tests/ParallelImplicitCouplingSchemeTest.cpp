@@ -8,6 +8,7 @@
 #include "cplscheme/impl/MVQNPostProcessing.hpp"
 #include "cplscheme/impl/BaseQNPostProcessing.hpp"
 #include "cplscheme/impl/ConstantPreconditioner.hpp"
+#include "cplscheme/impl/ConstantRelaxationPostProcessing.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "cplscheme/impl/SharedPointer.hpp"
 #include "cplscheme/Constants.hpp"
@@ -379,6 +380,74 @@ BOOST_FIXTURE_TEST_CASE(testInitializeData, testing::M2NFixture,
   cplScheme.finalize();
   utils::Parallel::clearGroups();
 }
+
+/// The second participant under-relaxes, hence every speculative iteration is rejected.
+BOOST_FIXTURE_TEST_CASE(testSpeculativeIterations, testing::M2NFixture,
+                        * testing::MinRanks(2)
+                        * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2) // only run test on ranks {0,1}, for other ranks return
+    return;
+
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  const auto dataID0 = mesh->createData("Data0", 1)->getID();
+  const auto dataID1 = mesh->createData("Data1", 1)->getID();
+  mesh->createVertex(Eigen::Vector3d::Zero());
+  mesh->allocateDataValues();
+
+  double timestepLength = 0.1;
+  int maxTimesteps = 3;
+  int minIterations = 3;
+  std::string nameParticipant0("Participant0");
+  std::string nameParticipant1("Participant1");
+  bool isFirst = utils::Parallel::getProcessRank() == 0;
+  std::string nameLocalParticipant = isFirst ? nameParticipant0 : nameParticipant1;
+
+  ParallelCouplingScheme cplScheme(
+      1.0, maxTimesteps, timestepLength, 16, nameParticipant0, nameParticipant1,
+      nameLocalParticipant, m2n, constants::FIXED_DT, BaseCouplingScheme::Implicit, 100);
+  cplScheme.addDataToSend(mesh->data(isFirst ? dataID0 : dataID1), mesh, false);
+  cplScheme.addDataToReceive(mesh->data(isFirst ? dataID1 : dataID0), mesh, false);
+  cplscheme::impl::PtrConvergenceMeasure minIterationConvMeasure (
+      new cplscheme::impl::MinIterationConvergenceMeasure(minIterations) );
+  cplScheme.addConvergenceMeasure(dataID1, false, false, minIterationConvMeasure);
+  if (not isFirst) {
+    std::vector<int> dataIDs;
+    cplScheme.setIterationPostProcessing(cplscheme::impl::PtrPostProcessing(
+        new cplscheme::impl::ConstantRelaxationPostProcessing(0.5, dataIDs)));
+  }
+  cplScheme.setSpeculation(0.0);
+
+  std::string writeIterationCheckpoint(constants::actionWriteIterationCheckpoint());
+  std::string readIterationCheckpoint(constants::actionReadIterationCheckpoint());
+
+  cplScheme.initialize(0.0, 1);
+  int advances = 0;
+  while (cplScheme.isCouplingOngoing()){
+    if (cplScheme.isActionRequired(writeIterationCheckpoint)){
+      cplScheme.performedAction(writeIterationCheckpoint);
+    }
+    if (cplScheme.isActionRequired(readIterationCheckpoint)){
+      cplScheme.performedAction(readIterationCheckpoint);
+    }
+    // the values change in every timestep, such that the relaxed values never match the speculative ones
+    mesh->data(isFirst ? dataID0 : dataID1)->values() = Eigen::VectorXd::Constant(1, 2.0 * cplScheme.getTimesteps());
+    cplScheme.addComputedTime(timestepLength);
+    cplScheme.advance();
+    advances++;
+  }
+  cplScheme.finalize();
+
+  if (isFirst) {
+    // Two rejected speculative iterations per timestep are repeated
+    BOOST_TEST(advances == maxTimesteps * (minIterations + minIterations - 1));
+  }
+  else {
+    BOOST_TEST(advances == maxTimesteps * minIterations);
+  }
+  BOOST_TEST(cplScheme.getTimesteps() - 1 == maxTimesteps);
+  utils::Parallel::clearGroups();
+}
 # endif // not PRECICE_NO_MPI
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -246,6 +246,38 @@ BOOST_AUTO_TEST_CASE(testMultilpleMeshes)
   BOOST_TEST(testing::equals(_data, backup));
 }
 
+BOOST_AUTO_TEST_CASE(testMatrixScaling)
+{
+  std::vector<size_t> svs;
+  svs.push_back(3);
+  svs.push_back(5);
+
+  std::vector<double> factors;
+  factors.push_back(2.0);
+  factors.push_back(0.5);
+
+  impl::ConstantPreconditioner precond(factors);
+  precond.initialize(svs);
+
+  Eigen::VectorXd weights(8);
+  weights << 0.5, 0.5, 0.5, 2.0, 2.0, 2.0, 2.0, 2.0;
+  BOOST_TEST(testing::equals(precond.getWeights(), weights));
+
+  Eigen::MatrixXd M = Eigen::MatrixXd::Random(8, 3);
+  Eigen::MatrixXd backup = M;
+  precond.apply(M);
+  BOOST_TEST(testing::equals(M, weights.asDiagonal() * backup));
+  precond.revert(M);
+  BOOST_TEST(testing::equals(M, backup));
+
+  // scaling from the right
+  Eigen::MatrixXd MT = backup.transpose();
+  precond.apply(MT, true);
+  BOOST_TEST(testing::equals(MT, backup.transpose() * weights.asDiagonal()));
+  precond.revert(MT, true);
+  BOOST_TEST(testing::equals(MT, backup.transpose()));
+}
+
 #ifndef PRECICE_NO_MPI
 BOOST_AUTO_TEST_CASE(testParallelMatrixScaling,
                      *testing::OnSize(4) * boost::unit_test::fixture<testing::MasterComFixture>())
@@ -860,6 +860,80 @@ BOOST_FIXTURE_TEST_CASE(testInitializeData, testing::M2NFixture,
   cplScheme.finalize();
 }
 
+/// Runs a serial implicit coupling with adaptive timestep length, returns the lengths of the timesteps.
+std::vector<double> runAdaptiveCoupling(
+    m2n::PtrM2N m2n,
+    int         minIterations,
+    int         maxIterations)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 3, false));
+  mesh->createData("data0", 1);
+  mesh->createData("data1", 1);
+  mesh->createVertex(Eigen::Vector3d::Zero());
+  mesh->allocateDataValues();
+
+  std::string nameParticipant0("Participant0");
+  std::string nameParticipant1("Participant1");
+  bool isFirst = utils::Parallel::getProcessRank() == 0;
+  cplscheme::SerialCouplingScheme cplScheme(
+      CouplingScheme::UNDEFINED_TIME, 4, 0.1, 16, nameParticipant0, nameParticipant1,
+      isFirst ? nameParticipant0 : nameParticipant1, m2n, constants::ADAPTIVE_DT,
+      BaseCouplingScheme::Implicit, maxIterations);
+  cplScheme.setAdaptiveTimestepLength(0.05, 0.3, 2);
+  cplScheme.addDataToSend(mesh->data()[isFirst ? 0 : 1], mesh, false);
+  cplScheme.addDataToReceive(mesh->data()[isFirst ? 1 : 0], mesh, false);
+  cplscheme::impl::PtrConvergenceMeasure minIterationConvMeasure(
+      new cplscheme::impl::MinIterationConvergenceMeasure(minIterations));
+  cplScheme.addConvergenceMeasure(mesh->data()[1]->getID(), false, false, minIterationConvMeasure);
+
+  std::string writeIterationCheckpoint(constants::actionWriteIterationCheckpoint());
+  std::string readIterationCheckpoint(constants::actionReadIterationCheckpoint());
+  std::vector<double> timestepLengths;
+  cplScheme.initialize(0.0, 1);
+  while (cplScheme.isCouplingOngoing()){
+    if (cplScheme.isActionRequired(writeIterationCheckpoint)){
+      cplScheme.performedAction(writeIterationCheckpoint);
+    }
+    double timestepLength = cplScheme.getTimestepLength();
+    cplScheme.addComputedTime(timestepLength);
+    cplScheme.advance();
+    if (cplScheme.isActionRequired(readIterationCheckpoint)){
+      cplScheme.performedAction(readIterationCheckpoint);
+    }
+    if (cplScheme.isCouplingTimestepComplete()){
+      timestepLengths.push_back(timestepLength);
+    }
+  }
+  cplScheme.finalize();
+  return timestepLengths;
+}
+
+BOOST_FIXTURE_TEST_CASE(testAdaptiveTimestepLengthGrows, testing::M2NFixture,
+                      * testing::MinRanks(2)
+                      * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2) // only run test on ranks {0,1}, for other ranks return
+    return;
+
+  // Every timestep converges in one iteration, the length doubles up to the maximum
+  std::vector<double> timestepLengths = runAdaptiveCoupling(m2n, 1, 10);
+  std::vector<double> expected        = {0.1, 0.2, 0.3, 0.3};
+  BOOST_TEST(timestepLengths == expected, boost::test_tools::per_element());
+}
+
+BOOST_FIXTURE_TEST_CASE(testAdaptiveTimestepLengthShrinks, testing::M2NFixture,
+                      * testing::MinRanks(2)
+                      * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2) // only run test on ranks {0,1}, for other ranks return
+    return;
+
+  // Every timestep reaches the maximal number of iterations, the length halves down to the minimum
+  std::vector<double> timestepLengths = runAdaptiveCoupling(m2n, 3, 2);
+  std::vector<double> expected        = {0.1, 0.05, 0.05, 0.05};
+  BOOST_TEST(timestepLengths == expected, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 
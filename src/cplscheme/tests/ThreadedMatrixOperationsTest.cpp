@@ -0,0 +1,61 @@
+#include <Eigen/Core>
+#include "cplscheme/impl/ThreadedMatrixOperations.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::cplscheme;
+
+BOOST_AUTO_TEST_SUITE(CplSchemeTests)
+BOOST_AUTO_TEST_SUITE(ThreadedMatrixOperationsTests)
+
+BOOST_AUTO_TEST_CASE(testProducts)
+{
+  // large enough to be split into four row blocks of unequal size
+  const int       rows = 40003;
+  const int       cols = 7;
+  Eigen::MatrixXd A    = Eigen::MatrixXd::Random(rows, cols);
+  Eigen::MatrixXd B    = Eigen::MatrixXd::Random(cols, 3);
+  Eigen::VectorXd x    = Eigen::VectorXd::Random(cols);
+  Eigen::VectorXd y    = Eigen::VectorXd::Random(rows);
+
+  impl::ThreadedMatrixOperations ops(4);
+
+  Eigen::VectorXd Ax;
+  ops.multiply(A, x, Ax);
+  BOOST_TEST(testing::equals(Ax, A * x));
+
+  Eigen::MatrixXd AB;
+  ops.multiply(A, B, AB);
+  BOOST_TEST(testing::equals(AB, A * B));
+
+  Eigen::VectorXd ATy;
+  ops.multiplyTransposed(A, y, ATy);
+  BOOST_TEST(testing::equals(ATy, A.transpose() * y, 1e-10));
+
+  // blocks of columns are passed without copy
+  ops.multiply(A.leftCols(3), x.head(3), Ax);
+  BOOST_TEST(testing::equals(Ax, A.leftCols(3) * x.head(3)));
+
+  // every row is visited exactly once
+  Eigen::VectorXi visits = Eigen::VectorXi::Zero(rows);
+  ops.forRowBlocks(rows, cols, [&](int block, int begin, int size) {
+    visits.segment(begin, size).array() += 1;
+  });
+  BOOST_TEST((visits.array() == 1).all());
+}
+
+BOOST_AUTO_TEST_CASE(testEmptyProducts)
+{
+  impl::ThreadedMatrixOperations ops(4);
+  Eigen::MatrixXd                A(0, 3);
+  Eigen::VectorXd                y(0);
+
+  // procs without vertices at the interface contribute zeros
+  Eigen::VectorXd ATy;
+  ops.multiplyTransposed(A, y, ATy);
+  BOOST_TEST(ATy.size() == 3);
+  BOOST_TEST(ATy.isZero());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ThreadedMatrixOperationsTests
+BOOST_AUTO_TEST_SUITE_END() // CplSchemeTests
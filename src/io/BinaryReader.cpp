@@ -0,0 +1,95 @@
+#include "BinaryReader.hpp"
+
+namespace precice {
+namespace io {
+
+BinaryReader:: BinaryReader
+(
+  const std::string& filename )
+:
+  _filename(filename),
+  _file()
+{
+  _file.open(filename.c_str(), std::ios::in | std::ios::binary);
+  if (not _file){
+    ERROR("Could not open file \"" << filename << "\" for binary reading!");
+  }
+}
+
+BinaryReader:: ~BinaryReader()
+{
+  if (_file){
+    _file.close();
+  }
+}
+
+void BinaryReader:: read
+(
+  double& value )
+{
+  readRaw(&value, sizeof(value));
+}
+
+void BinaryReader:: read
+(
+  int& value )
+{
+  readRaw(&value, sizeof(value));
+}
+
+void BinaryReader:: read
+(
+  bool& value )
+{
+  char byte = 0;
+  readRaw(&byte, sizeof(byte));
+  value = (byte != 0);
+}
+
+void BinaryReader:: read
+(
+  Eigen::MatrixXd& matrix )
+{
+  int rows = readSize();
+  int cols = readSize();
+  matrix.resize(rows, cols);
+  readRaw(matrix.data(), sizeof(double) * matrix.size());
+}
+
+void BinaryReader:: read
+(
+  Eigen::VectorXd& vector )
+{
+  vector.resize(readSize());
+  readRaw(vector.data(), sizeof(double) * vector.size());
+}
+
+void BinaryReader:: read
+(
+  std::deque<int>& values )
+{
+  values.resize(readSize());
+  for (int& value : values){
+    read(value);
+  }
+}
+
+void BinaryReader:: readRaw
+(
+  void*  data,
+  size_t bytes )
+{
+  _file.read(static_cast<char*>(data), bytes);
+  CHECK(_file.good(), "Binary file \"" << _filename << "\" ended unexpectedly, "
+        << "it has not been written by the same configuration!");
+}
+
+int BinaryReader:: readSize()
+{
+  int size = -1;
+  read(size);
+  CHECK(size >= 0, "Binary file \"" << _filename << "\" is corrupted!");
+  return size;
+}
+
+}} // namespace precice, io
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "logging/Logger.hpp"
+#include <Eigen/Core>
+#include <deque>
+#include <fstream>
+#include <string>
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief File reader for checkpoints written by BinaryWriter.
+ *
+ * The values have to be read in the same order and with the same types as
+ * they have been written.
+ */
+class BinaryReader
+{
+public:
+
+  /// Constructor, opens file.
+  explicit BinaryReader(const std::string& filename);
+
+  /// Destructor, closes file.
+  ~BinaryReader();
+
+  void read(double& value);
+
+  void read(int& value);
+
+  void read(bool& value);
+
+  /// Reads the dimensions and the entries of the matrix, the matrix is resized.
+  void read(Eigen::MatrixXd& matrix);
+
+  /// Reads the size and the entries of the vector, the vector is resized.
+  void read(Eigen::VectorXd& vector);
+
+  /// Reads the size and the entries of the deque, the deque is resized.
+  void read(std::deque<int>& values);
+
+private:
+
+  logging::Logger _log{"io::BinaryReader"};
+
+  /// @brief Name of the file, for error messages.
+  std::string _filename;
+
+  /// @brief Filestream.
+  std::ifstream _file;
+
+  void readRaw(void* data, size_t bytes);
+
+  /// Reads a size or dimension and checks it for consistency.
+  int readSize();
+};
+
+}} // namespace precice, io
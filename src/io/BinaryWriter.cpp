@@ -0,0 +1,83 @@
+#include "BinaryWriter.hpp"
+
+namespace precice {
+namespace io {
+
+BinaryWriter:: BinaryWriter
+(
+  const std::string& filename )
+:
+  _file()
+{
+  _file.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (not _file){
+    ERROR("Could not open file \"" << filename << "\" for binary writing!");
+  }
+}
+
+BinaryWriter:: ~BinaryWriter()
+{
+  if (_file){
+    _file.close();
+  }
+}
+
+void BinaryWriter:: write
+(
+  double value )
+{
+  writeRaw(&value, sizeof(value));
+}
+
+void BinaryWriter:: write
+(
+  int value )
+{
+  writeRaw(&value, sizeof(value));
+}
+
+void BinaryWriter:: write
+(
+  bool value )
+{
+  char byte = value ? 1 : 0;
+  writeRaw(&byte, sizeof(byte));
+}
+
+void BinaryWriter:: write
+(
+  const Eigen::MatrixXd& matrix )
+{
+  write(static_cast<int>(matrix.rows()));
+  write(static_cast<int>(matrix.cols()));
+  writeRaw(matrix.data(), sizeof(double) * matrix.size());
+}
+
+void BinaryWriter:: write
+(
+  const Eigen::VectorXd& vector )
+{
+  write(static_cast<int>(vector.size()));
+  writeRaw(vector.data(), sizeof(double) * vector.size());
+}
+
+void BinaryWriter:: write
+(
+  const std::deque<int>& values )
+{
+  write(static_cast<int>(values.size()));
+  for (int value : values){
+    write(value);
+  }
+}
+
+void BinaryWriter:: writeRaw
+(
+  const void* data,
+  size_t      bytes )
+{
+  _file.write(static_cast<const char*>(data), bytes);
+  CHECK(_file.good(), "Writing to binary file failed!");
+}
+
+}} // namespace precice, io
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "logging/Logger.hpp"
+#include <Eigen/Core>
+#include <deque>
+#include <fstream>
+#include <string>
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief File writer for checkpoints of the coupling state in a raw binary format.
+ *
+ * Matrices and vectors are written with their dimensions, followed by the
+ * entries in column-major order. The format is not portable between machines
+ * and is only meant to be read by BinaryReader on the same decomposition.
+ */
+class BinaryWriter
+{
+public:
+
+  /// Constructor, opens file.
+  explicit BinaryWriter(const std::string& filename);
+
+  /// Destructor, closes file.
+  ~BinaryWriter();
+
+  void write(double value);
+
+  void write(int value);
+
+  void write(bool value);
+
+  /// Writes the dimensions and the entries of the matrix.
+  void write(const Eigen::MatrixXd& matrix);
+
+  /// Writes the size and the entries of the vector.
+  void write(const Eigen::VectorXd& vector);
+
+  /// Writes the size and the entries of the deque.
+  void write(const std::deque<int>& values);
+
+private:
+
+  logging::Logger _log{"io::BinaryWriter"};
+
+  /// @brief Filestream.
+  std::ofstream _file;
+
+  void writeRaw(const void* data, size_t bytes);
+};
+
+}} // namespace precice, io
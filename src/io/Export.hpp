@@ -43,6 +43,15 @@ public:
     const std::string& name,
     const std::string& location,
     mesh::Mesh&        mesh ) =0;
+
+  /// Blocks until all exports done so far are written. Only relevant for asynchronous exporters.
+  virtual void drain() {}
+
+  /// Writes all pending exports and reports errors of writing them. Called once exporting is done.
+  virtual void close() {}
+
+  /// Sets the simulation time of the following exports, used by exporters writing time series.
+  virtual void setTime(double) {}
 };
 
 }} // namespace precice, io
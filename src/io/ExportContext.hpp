@@ -2,6 +2,7 @@
 #define PRECICE_IO_EXPORTCONTEXT_HPP_
 
 #include "io/SharedPointer.hpp"
+#include "io/VTKXMLDataWriter.hpp"
 #include <string>
 
 namespace precice {
@@ -30,6 +31,21 @@ struct ExportContext
   // @brief If true, normals are plotted.
   bool plotNormals;
 
+  // @brief Encoding of the data arrays.
+  VTKXMLDataWriter::Format format;
+
+  // @brief If true, binary data arrays are compressed.
+  bool compress;
+
+  // @brief If true, files are written by a background thread.
+  bool asynchronous;
+
+  // @brief Number of ranks writing the data of all ranks, 0 if every rank writes its own file.
+  int aggregators;
+
+  // @brief If true, a collection file is written for every series of exports.
+  bool timeSeries;
+
   /**
    * @brief Constructor.
    */
@@ -40,7 +56,12 @@ struct ExportContext
     triggerSolverPlot(false),
     everyIteration(false),
     type(),
-    plotNormals(false)
+    plotNormals(false),
+    format(VTKXMLDataWriter::ASCII),
+    compress(false),
+    asynchronous(false),
+    aggregators(0),
+    timeSeries(false)
   {}
 };
 
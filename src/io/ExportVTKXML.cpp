@@ -8,22 +8,108 @@
 #include <Eigen/Core>
 #include <string>
 #include <fstream>
+#include <vector>
 #include <boost/filesystem.hpp>
 #include "utils/Helpers.hpp"
+#include "utils/MasterSlave.hpp"
+#include "com/Communication.hpp"
+#include "com/SocketCommunication.hpp"
+#include <algorithm>
+#include <iomanip>
+#include <limits>
 
 namespace precice {
 namespace io {
 
+namespace {
+
+/// Group of the rank, if size ranks are split into contiguous groups.
+int groupOfRank(int rank, int groups, int size)
+{
+  return rank * groups / size;
+}
+
+/// First rank of the group, if size ranks are split into contiguous groups.
+int firstRankOfGroup(int group, int groups, int size)
+{
+  return (group * size + groups - 1) / groups;
+}
+
+} // namespace
+
+struct ExportVTKXML::Snapshot
+{
+  /// Values of one data of the mesh, vector data is always 3D.
+  struct DataArray
+  {
+    std::string         name;
+    int                 numberOfComponents;
+    std::vector<double> values;
+  };
+
+  std::string name;
+
+  std::string location;
+
+  /// Simulation time of the export
+  double time;
+
+  /// True, if written by master and slaves, false for serial participants.
+  bool parallel;
+
+  bool isMaster;
+
+  int rank;
+
+  /// Ranks with a non-empty sub file, only used by the master.
+  std::vector<int> pieceRanks;
+
+  /// List of names of all scalar data on mesh
+  std::vector<std::string> scalarDataNames;
+
+  /// List of names of all vector data on mesh
+  std::vector<std::string> vectorDataNames;
+
+  /// Vertex coordinates, also 3D for 2D meshes
+  std::vector<double> positions;
+
+  std::vector<int> connectivity;
+
+  std::vector<int> offsets;
+
+  std::vector<uint8_t> types;
+
+  std::vector<DataArray> data;
+};
+
 ExportVTKXML:: ExportVTKXML
 (
-  bool writeNormals )
+  bool                     writeNormals,
+  VTKXMLDataWriter::Format format,
+  bool                     compress,
+  bool                     asynchronous,
+  int                      aggregators,
+  bool                     timeSeries )
 :
   Export(),
   _writeNormals(writeNormals),
-  _meshDimensions(-1)
+  _format(format),
+  _compress(compress),
+  _asynchronous(asynchronous),
+  _aggregators(aggregators),
+  _timeSeries(timeSeries)
 {
 }
 
+ExportVTKXML:: ~ExportVTKXML()
+{
+  // Exiting is not allowed here, as the destructor may run during stack unwinding
+  stopWriterThread();
+  if (not _writeError.empty()) {
+    WARN("Asynchronous export failed and the exporter was not closed: " << _writeError);
+  }
+}
+
 int ExportVTKXML:: getType() const
 {
   return constants::exportVTKXML();
@@ -36,94 +122,412 @@ void ExportVTKXML:: doExport
   mesh::Mesh&        mesh)
 {
   TRACE(name, location, mesh.getName());
-  assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
-  processDataNamesAndDimensions(mesh);
-  if (utils::MasterSlave::_masterMode) {
-    writeMasterFile(name, location, mesh);
+  std::unique_ptr<Snapshot> snapshot = takeSnapshot(name, location, mesh);
+  if (_aggregators > 0 && snapshot->parallel) {
+    aggregateSnapshot(*snapshot);
+  }
+  if (not _asynchronous) {
+    try {
+      write(*snapshot);
+    }
+    catch (const std::string& error) {
+      ERROR(error);
+    }
+    return;
   }
-  if(mesh.vertices().size()>0){ //only procs at the coupling interface should write output (for performance reasons)
-    writeSubFile(name, location, mesh);
+
+  if (not _writerThread.joinable()) {
+    _writerThread = std::thread(&ExportVTKXML::writePendingSnapshots, this);
   }
+  std::unique_lock<std::mutex> lock(_mutex);
+  _pendingChanged.wait(lock, [this] { return _pendingSnapshots.size() < MAX_PENDING_SNAPSHOTS; });
+  checkWriteError();
+  _pendingSnapshots.push_back(std::move(snapshot));
+  lock.unlock();
+  _pendingChanged.notify_all();
+}
+
+void ExportVTKXML:: drain()
+{
+  TRACE();
+  std::unique_lock<std::mutex> lock(_mutex);
+  _pendingChanged.wait(lock, [this] { return _pendingSnapshots.empty(); });
+  checkWriteError();
 }
 
-void ExportVTKXML::processDataNamesAndDimensions
+void ExportVTKXML:: setTime
 (
-  mesh::Mesh& mesh)
+  double time )
+{
+  _time = time;
+}
+
+void ExportVTKXML:: close()
+{
+  TRACE();
+  stopWriterThread();
+  checkWriteError();
+  // Reported once only
+  _writeError.clear();
+}
+
+void ExportVTKXML:: stopWriterThread()
+{
+  if (_writerThread.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stopWriting = true;
+    }
+    _pendingChanged.notify_all();
+    _writerThread.join();
+    _stopWriting = false;
+  }
+}
+
+void ExportVTKXML:: checkWriteError()
 {
-  _meshDimensions = mesh.getDimensions();
-  _vectorDataNames.clear();
-  _scalarDataNames.clear();
+  if (not _writeError.empty()) {
+    ERROR(_writeError);
+  }
+}
+
+void ExportVTKXML:: writePendingSnapshots()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _pendingChanged.wait(lock, [this] { return _stopWriting || not _pendingSnapshots.empty(); });
+    if (_pendingSnapshots.empty()) {
+      return; // stopped and nothing left to write
+    }
+    // The snapshot stays in the queue while written, to bound the number of snapshots
+    const Snapshot& snapshot = *_pendingSnapshots.front();
+    lock.unlock();
+    // Failures are reported by the main thread, ERROR must not exit from here
+    std::string error;
+    try {
+      write(snapshot);
+    }
+    catch (const std::string& writeError) {
+      error = writeError;
+    }
+    lock.lock();
+    if (_writeError.empty()) {
+      _writeError = error;
+    }
+    _pendingSnapshots.pop_front();
+    _pendingChanged.notify_all();
+  }
+}
+
+std::unique_ptr<ExportVTKXML::Snapshot> ExportVTKXML:: takeSnapshot
+(
+  const std::string& name,
+  const std::string& location,
+  mesh::Mesh&        mesh) const
+{
+  std::unique_ptr<Snapshot> snapshot(new Snapshot);
+  snapshot->name     = name;
+  snapshot->location = location;
+  snapshot->time     = _time;
+  snapshot->parallel = utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode;
+  snapshot->isMaster = utils::MasterSlave::_masterMode;
+  snapshot->rank     = utils::MasterSlave::_rank;
+  if (snapshot->isMaster) {
+    for (int i = 0; i < utils::MasterSlave::_size; i++) {
+      if(mesh.getVertexDistribution()[i].size()>0){ //only non-empty subfiles
+        snapshot->pieceRanks.push_back(i);
+      }
+    }
+  }
+
   if (_writeNormals) {
-    _vectorDataNames.push_back("VertexNormals ");
+    snapshot->vectorDataNames.push_back("VertexNormals ");
   }
   for (mesh::PtrData data : mesh.data()) {
     int dataDimensions = data->getDimensions();
     assertion(dataDimensions>=1);
     std::string dataName = data->getName();
     if ( dataDimensions == 1) {
-      _scalarDataNames.push_back(dataName);
+      snapshot->scalarDataNames.push_back(dataName);
     } else {
-      _vectorDataNames.push_back(dataName);
+      snapshot->vectorDataNames.push_back(dataName);
+    }
+  }
+
+  size_t numPoints = mesh.vertices().size();
+  snapshot->positions.assign(3 * numPoints, 0.0); // also for 2D scenario, vtk needs 3D data
+  double* position = snapshot->positions.data();
+  for (mesh::Vertex& vertex : mesh.vertices()) {
+    const Eigen::VectorXd& coords = vertex.getCoords();
+    for (int i = 0; i < coords.size(); i++) {
+      position[i] = coords(i);
+    }
+    position += 3;
+  }
+
+  std::vector<int>&     connectivity = snapshot->connectivity;
+  std::vector<int>&     offsets      = snapshot->offsets;
+  std::vector<uint8_t>& types        = snapshot->types;
+  if (mesh.getDimensions() == 2) { // write edges as cells
+    connectivity.reserve(2 * mesh.edges().size());
+    for (mesh::Edge & edge : mesh.edges()) {
+      connectivity.push_back(edge.vertex(0).getID());
+      connectivity.push_back(edge.vertex(1).getID());
+      offsets.push_back(connectivity.size());
+    }
+    types.assign(mesh.edges().size(), 3);
+  } else { // write triangles and quads as cells
+    connectivity.reserve(3 * mesh.triangles().size() + 4 * mesh.quads().size());
+    for (mesh::Triangle& triangle : mesh.triangles()) {
+      for (int i = 0; i < 3; i++) {
+        connectivity.push_back(triangle.vertex(i).getID());
+      }
+      offsets.push_back(connectivity.size());
+    }
+    for (mesh::Quad& quad : mesh.quads()) {
+      for (int i = 0; i < 4; i++) {
+        connectivity.push_back(quad.vertex(i).getID());
+      }
+      offsets.push_back(connectivity.size());
+    }
+    types.assign(mesh.triangles().size(), 5);
+    types.insert(types.end(), mesh.quads().size(), 9);
+  }
+
+  for (mesh::PtrData data : mesh.data()) { // Plot vertex data
+    const Eigen::VectorXd& values = data->values();
+    int dataDimensions = data->getDimensions();
+    Snapshot::DataArray array;
+    array.name = data->getName();
+    if (dataDimensions == 2) { //2D data needs to be 3D for vtk
+      array.numberOfComponents = 3;
+      array.values.assign(3 * numPoints, 0.0);
+      for (size_t count = 0; count < numPoints; count++) {
+        array.values[3 * count]     = values(2 * count);
+        array.values[3 * count + 1] = values(2 * count + 1);
+      }
+    }
+    else {
+      array.numberOfComponents = dataDimensions;
+      array.values.assign(values.data(), values.data() + numPoints * dataDimensions);
+    }
+    snapshot->data.push_back(std::move(array));
+  }
+  return snapshot;
+}
+
+void ExportVTKXML:: aggregateSnapshot
+(
+  Snapshot& snapshot )
+{
+  TRACE(snapshot.name);
+  const int size        = utils::MasterSlave::_size;
+  const int rank        = utils::MasterSlave::_rank;
+  const int aggregators = std::min(_aggregators, size);
+
+  if (aggregators == 1) {
+    assertion(utils::MasterSlave::_communication.get() != nullptr);
+    com::Communication& com = *utils::MasterSlave::_communication;
+    if (utils::MasterSlave::_slaveMode) {
+      sendSnapshot(snapshot, com);
+      return;
+    }
+    assertion(utils::MasterSlave::_masterMode);
+    for (int rankSlave = 1; rankSlave < size; rankSlave++) {
+      receiveSnapshot(snapshot, com, rankSlave);
+    }
+    // The master writes a single file, as in serial
+    snapshot.parallel = false;
+    snapshot.isMaster = false;
+    snapshot.pieceRanks.clear();
+    return;
+  }
+
+  const int group     = groupOfRank(rank, aggregators, size);
+  const int firstRank = firstRankOfGroup(group, aggregators, size);
+  const int groupSize = firstRankOfGroup(group + 1, aggregators, size) - firstRank;
+  if (_aggregatorCom.get() == nullptr) {
+    connectAggregator(snapshot, group, firstRank, groupSize);
+  }
+  if (rank != firstRank) {
+    sendSnapshot(snapshot, *_aggregatorCom);
+    return;
+  }
+  for (int member = 0; member < groupSize - 1; member++) {
+    receiveSnapshot(snapshot, *_aggregatorCom, member);
+  }
+  if (snapshot.isMaster) {
+    // The master file references the sub files of the aggregators of all non-empty groups
+    std::vector<int> pieceRanks;
+    for (int pieceRank : snapshot.pieceRanks) {
+      int aggregator = firstRankOfGroup(groupOfRank(pieceRank, aggregators, size), aggregators, size);
+      if (pieceRanks.empty() || pieceRanks.back() != aggregator) {
+        pieceRanks.push_back(aggregator);
+      }
+    }
+    snapshot.pieceRanks = pieceRanks;
+  }
+}
+
+void ExportVTKXML:: connectAggregator
+(
+  const Snapshot& snapshot,
+  int             group,
+  int             firstRank,
+  int             groupSize )
+{
+  TRACE(group, firstRank, groupSize);
+  // The series of the first export contains the names of mesh and participant
+  std::string series        = snapshot.name.substr(0, snapshot.name.rfind('.'));
+  std::string acceptorName  = "ExportVTKXML-" + series + "-Aggregator" + std::to_string(group);
+  std::string requesterName = "ExportVTKXML-" + series + "-Group" + std::to_string(group);
+  _aggregatorCom = com::PtrCommunication(new com::SocketCommunication());
+  if (utils::MasterSlave::_rank == firstRank) {
+    if (groupSize > 1) {
+      _aggregatorCom->acceptConnection(acceptorName, requesterName, 0);
+    }
+  }
+  else {
+    _aggregatorCom->requestConnection(acceptorName, requesterName,
+                                      utils::MasterSlave::_rank - firstRank - 1, groupSize - 1);
+  }
+}
+
+void ExportVTKXML:: sendSnapshot
+(
+  Snapshot&           snapshot,
+  com::Communication& com )
+{
+  int numPoints = snapshot.positions.size() / 3;
+  com.send(numPoints, 0);
+  if (numPoints > 0) {
+    std::vector<int> types(snapshot.types.begin(), snapshot.types.end());
+    com.send(snapshot.positions, 0);
+    com.send(snapshot.connectivity, 0);
+    com.send(snapshot.offsets, 0);
+    com.send(types, 0);
+    for (const Snapshot::DataArray& array : snapshot.data) {
+      com.send(array.values, 0);
+    }
+  }
+  // Nothing left to write
+  snapshot.positions.clear();
+  snapshot.data.clear();
+}
+
+void ExportVTKXML:: receiveSnapshot
+(
+  Snapshot&           snapshot,
+  com::Communication& com,
+  int                 rankSender )
+{
+  int numPoints = 0;
+  com.receive(numPoints, rankSender);
+  if (numPoints == 0) {
+    return;
+  }
+  // Cells of the sender refer to its local vertex IDs, and offsets to its local connectivity
+  int pointOffset        = snapshot.positions.size() / 3;
+  int connectivityOffset = snapshot.connectivity.size();
+  std::vector<double> positions;
+  std::vector<int>    connectivity;
+  std::vector<int>    offsets;
+  std::vector<int>    types;
+  com.receive(positions, rankSender);
+  com.receive(connectivity, rankSender);
+  com.receive(offsets, rankSender);
+  com.receive(types, rankSender);
+  assertion(positions.size() == 3 * (size_t) numPoints, positions.size(), numPoints);
+  snapshot.positions.insert(snapshot.positions.end(), positions.begin(), positions.end());
+  for (int vertexID : connectivity) {
+    snapshot.connectivity.push_back(vertexID + pointOffset);
+  }
+  for (int offset : offsets) {
+    snapshot.offsets.push_back(offset + connectivityOffset);
+  }
+  snapshot.types.insert(snapshot.types.end(), types.begin(), types.end());
+  for (Snapshot::DataArray& array : snapshot.data) {
+    std::vector<double> values;
+    com.receive(values, rankSender);
+    array.values.insert(array.values.end(), values.begin(), values.end());
+  }
+}
+
+void ExportVTKXML:: write
+(
+  const Snapshot& snapshot)
+{
+  // No tracing here, this may run in the background thread
+  if (snapshot.isMaster) {
+    writeMasterFile(snapshot);
+    if (_timeSeries) {
+      writeTimeSeries(snapshot, snapshot.name + "_master.pvtu");
+    }
+  }
+  if (not snapshot.positions.empty()) {
+    writeSubFile(snapshot);
+    if (_timeSeries && not snapshot.parallel) {
+      writeTimeSeries(snapshot, snapshot.name + ".vtu");
     }
   }
 }
 
 void ExportVTKXML::writeMasterFile
 (
-  const std::string& name,
-  const std::string& location,
-  mesh::Mesh&        mesh)
+  const Snapshot& snapshot)
 {
   namespace fs = boost::filesystem;
-  fs::path outfile(location);
-  outfile = outfile / fs::path(name + "_master.pvtu");
+  fs::path outfile(snapshot.location);
+  outfile = outfile / fs::path(snapshot.name + "_master.pvtu");
   std::ofstream outMasterFile(outfile.string(), std::ios::trunc);
 
-  CHECK(outMasterFile, "Could not open master file \"" << outfile.c_str() << "\" for VTKXML export!");
+  if (not outMasterFile) {
+    throw std::string("Could not open master file \"" + outfile.string() + "\" for VTKXML export!");
+  }
+
+  VTKXMLDataWriter writer(outMasterFile, _format, _compress);
+  const std::string floatType = writer.getFloatType();
 
-  outMasterFile << "<?xml version=\"1.0\"?>" << std::endl;
-  outMasterFile << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  outMasterFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">")  << std::endl;
-  outMasterFile << "   <PUnstructuredGrid GhostLevel=\"0\">" << std::endl;
+  outMasterFile << "<?xml version=\"1.0\"?>\n";
+  outMasterFile << "<VTKFile type=\"PUnstructuredGrid\" " << writer.getFileAttributes() << ">\n";
+  outMasterFile << "   <PUnstructuredGrid GhostLevel=\"0\">\n";
 
-  outMasterFile << "      <PPoints>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\"/>" << std::endl;
-  outMasterFile << "      </PPoints>" << std::endl;
+  outMasterFile << "      <PPoints>\n";
+  outMasterFile << "         <PDataArray type=\"" << floatType << "\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\"/>\n";
+  outMasterFile << "      </PPoints>\n";
 
-  outMasterFile << "      <PCells>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"offsets\"      NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "         <PDataArray type=\"UInt8\" Name=\"types\"        NumberOfComponents=\"1\"/>" << std::endl;
-  outMasterFile << "      </PCells>" << std::endl;
+  outMasterFile << "      <PCells>\n";
+  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\"/>\n";
+  outMasterFile << "         <PDataArray type=\"Int32\" Name=\"offsets\"      NumberOfComponents=\"1\"/>\n";
+  outMasterFile << "         <PDataArray type=\"UInt8\" Name=\"types\"        NumberOfComponents=\"1\"/>\n";
+  outMasterFile << "      </PCells>\n";
 
   // write scalar data names
   outMasterFile << "      <PPointData Scalars=\"";
-  for (size_t i = 0; i < _scalarDataNames.size(); ++i) {
-    outMasterFile << _scalarDataNames[i] << " ";
+  for (const std::string& dataName : snapshot.scalarDataNames) {
+    outMasterFile << dataName << " ";
   }
   // write vector data names
   outMasterFile << "\" Vectors=\"";
-  for (size_t i = 0; i < _vectorDataNames.size(); ++i) {
-    outMasterFile << _vectorDataNames[i] << " ";
+  for (const std::string& dataName : snapshot.vectorDataNames) {
+    outMasterFile << dataName << " ";
   }
-  outMasterFile << "\">" << std::endl;
+  outMasterFile << "\">\n";
 
-  for (size_t i = 0; i < _scalarDataNames.size(); ++i) {
-    outMasterFile << "         <PDataArray type=\"Float32\" Name=\""<< _scalarDataNames[i] << "\" NumberOfComponents=\"" << 1 << "\"/>" << std::endl;
+  for (const std::string& dataName : snapshot.scalarDataNames) {
+    outMasterFile << "         <PDataArray type=\"" << floatType << "\" Name=\""<< dataName << "\" NumberOfComponents=\"" << 1 << "\"/>\n";
   }
 
-  for (size_t i = 0; i < _vectorDataNames.size(); ++i) {
-    outMasterFile << "         <PDataArray type=\"Float32\" Name=\""<< _vectorDataNames[i] << "\" NumberOfComponents=\"" << 3 << "\"/>" << std::endl;
+  for (const std::string& dataName : snapshot.vectorDataNames) {
+    outMasterFile << "         <PDataArray type=\"" << floatType << "\" Name=\""<< dataName << "\" NumberOfComponents=\"" << 3 << "\"/>\n";
   }
-  outMasterFile << "      </PPointData>" << std::endl;
+  outMasterFile << "      </PPointData>\n";
 
-  for (int i = 0; i < utils::MasterSlave::_size; i++) {
-    if(mesh.getVertexDistribution()[i].size()>0){ //only non-empty subfiles
-      outMasterFile << "      <Piece Source=\"" << name << "_r" << i << ".vtu\"/>" << std::endl;
-    }
+  for (int rank : snapshot.pieceRanks) {
+    outMasterFile << "      <Piece Source=\"" << snapshot.name << "_r" << rank << ".vtu\"/>\n";
   }
 
-  outMasterFile << "   </PUnstructuredGrid>" << std::endl;
+  outMasterFile << "   </PUnstructuredGrid>\n";
   outMasterFile << "</VTKFile>" << std::endl;
 
   outMasterFile.close();
@@ -131,213 +535,105 @@ void ExportVTKXML::writeMasterFile
 
 void ExportVTKXML::writeSubFile
 (
-  const std::string& name,
-  const std::string& location,
-  mesh::Mesh&        mesh)
+  const Snapshot& snapshot)
 {
-  int numPoints = mesh.vertices().size(); // number of vertices
-  int numCells; // number of cells
-  if (_meshDimensions == 2) {
-    numCells = mesh.edges().size();
-  } else {
-    numCells = mesh.triangles().size() + mesh.quads().size();
+  size_t numPoints = snapshot.positions.size() / 3;
+  size_t numCells  = snapshot.types.size();
+
+  std::string filename = snapshot.name + ".vtu";
+  if (snapshot.parallel) {
+    filename = snapshot.name + "_r" + std::to_string(snapshot.rank) + ".vtu";
   }
 
   namespace fs = boost::filesystem;
-  fs::path outfile(location);
-  outfile = outfile / fs::path(name + "_r" + std::to_string(utils::MasterSlave::_rank) + ".vtu");
-  std::ofstream outSubFile(outfile.string(), std::ios::trunc);
+  fs::path outfile(snapshot.location);
+  outfile = outfile / fs::path(filename);
+  std::ofstream outSubFile(outfile.string(), std::ios::trunc | std::ios::binary);
+
+  if (not outSubFile) {
+    throw std::string("Could not open slave file \"" + outfile.string() + "\" for VTKXML export!");
+  }
 
-  CHECK(outSubFile, "Could not open slave file \"" << outfile.c_str() << "\" for VTKXML export!");
+  VTKXMLDataWriter writer(outSubFile, _format, _compress);
 
-  outSubFile << "<?xml version=\"1.0\"?>" << std::endl;
-  outSubFile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"";
-  outSubFile << (utils::isMachineBigEndian() ? "BigEndian\">" : "LittleEndian\">")  << std::endl;
+  outSubFile << "<?xml version=\"1.0\"?>\n";
+  outSubFile << "<VTKFile type=\"UnstructuredGrid\" " << writer.getFileAttributes() << ">\n";
 
-  outSubFile << "   <UnstructuredGrid>" << std::endl;
-  outSubFile << "      <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\"> " << std::endl;
-  outSubFile << "         <Points> " << std::endl;
-  outSubFile << "            <DataArray type=\"Float32\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\" format=\"ascii\"> " << std::endl;
-  for (mesh::Vertex& vertex : mesh.vertices()) {
-    writeVertex(vertex.getCoords(), outSubFile);
-  }
-  outSubFile << "            </DataArray>" << std::endl;
-  outSubFile << "         </Points> " << std::endl << std::endl;
+  outSubFile << "   <UnstructuredGrid>\n";
+  outSubFile << "      <Piece NumberOfPoints=\"" << numPoints << "\" NumberOfCells=\"" << numCells << "\"> \n";
+  outSubFile << "         <Points> \n";
+  writer.writeDataArray("Position", 3, snapshot.positions.data(), snapshot.positions.size());
+  outSubFile << "         </Points> \n\n";
 
   // Write Mesh
-  exportMesh(outSubFile, mesh);
+  outSubFile << "         <Cells>\n";
+  writer.writeDataArray("connectivity", 1, snapshot.connectivity.data(), snapshot.connectivity.size());
+  writer.writeDataArray("offsets", 1, snapshot.offsets.data(), snapshot.offsets.size());
+  writer.writeDataArray("types", 1, snapshot.types.data(), snapshot.types.size());
+  outSubFile << "         </Cells>\n";
 
   // Write data
-  exportData(outSubFile, mesh);
+  outSubFile << "         <PointData Scalars=\"";
+  for (const std::string& dataName : snapshot.scalarDataNames) {
+    outSubFile << dataName << " ";
+  }
+  outSubFile << "\" Vectors=\"";
+  for (const std::string& dataName : snapshot.vectorDataNames) {
+    outSubFile << dataName << " ";
+  }
+  outSubFile << "\">\n";
+  for (const Snapshot::DataArray& array : snapshot.data) {
+    writer.writeDataArray(array.name, array.numberOfComponents, array.values.data(), array.values.size());
+  }
+  outSubFile << "         </PointData> \n";
 
-  outSubFile << "      </Piece>" << std::endl;
-  outSubFile << "   </UnstructuredGrid> " << std::endl;
+  outSubFile << "      </Piece>\n";
+  outSubFile << "   </UnstructuredGrid> \n";
+  writer.writeAppendedData();
   outSubFile << "</VTKFile>" << std::endl;
 
   outSubFile.close();
 }
 
-void ExportVTKXML::exportMesh
+void ExportVTKXML::writeTimeSeries
 (
-  std::ofstream& outFile,
-  mesh::Mesh&    mesh)
+  const Snapshot&    snapshot,
+  const std::string& filename )
 {
-  if (_meshDimensions == 2) { // write edges as cells
-    outFile << "         <Cells>" << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (mesh::Edge & edge : mesh.edges()) {
-      writeLine(edge, outFile);
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray> " << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.edges().size(); i++) {
-      outFile << 2*i << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.edges().size(); i++) {
-      outFile << 3 << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "         </Cells>" << std::endl;
-  } else { // write triangles and quads as cells
-
-    outFile << "         <Cells>" << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"connectivity\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (mesh::Triangle& triangle : mesh.triangles()) {
-      writeTriangle(triangle, outFile);
-    }
-    for (mesh::Quad& quad : mesh.quads()) {
-      writeQuadrangle(quad, outFile);
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray> " << std::endl;
-    outFile << "            <DataArray type=\"Int32\" Name=\"offsets\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-      outFile << 3*i << "  ";
-    }
-    for (size_t i = 1; i <= mesh.quads().size(); i++) {
-      outFile << 4*i << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "            <DataArray type=\"UInt8\"  Name=\"types\" NumberOfComponents=\"1\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    for (size_t i = 1; i <= mesh.triangles().size(); i++) {
-      outFile << 5 << "  ";
-    }
-    for (size_t i = 1; i <= mesh.quads().size(); i++) {
-      outFile << 9 << "  ";
-    }
-    outFile << std::endl;
-    outFile << "            </DataArray>" << std::endl;
-    outFile << "         </Cells>" << std::endl;
-  }
-}
+  // The series is the name without suffix, e.g., "MeshA-Fluid" for "MeshA-Fluid.dt5"
+  std::string series = snapshot.name.substr(0, snapshot.name.rfind('.'));
 
-void ExportVTKXML:: exportData
-(
-  std::ofstream& outFile,
-  mesh::Mesh&    mesh)
-{
-  outFile << "         <PointData Scalars=\"";
-  for (size_t i = 0; i < _scalarDataNames.size(); i++) {
-    outFile << _scalarDataNames[i] << " ";
-  }
-  outFile << "\" Vectors=\"";
-  for (size_t i = 0; i < _vectorDataNames.size(); i++) {
-    outFile << _vectorDataNames[i] << " ";
+  namespace fs = boost::filesystem;
+  fs::path outfile(snapshot.location);
+  outfile = outfile / fs::path(series + ".pvd");
+
+  // The header is written once, every export overwrites the closing tags with its entry
+  auto seriesEnd = _seriesEnds.find(series);
+  std::fstream outSeriesFile;
+  if (seriesEnd == _seriesEnds.end()) {
+    outSeriesFile.open(outfile.string(), std::ios::out | std::ios::trunc);
+  } else {
+    outSeriesFile.open(outfile.string(), std::ios::in | std::ios::out);
+    outSeriesFile.seekp(seriesEnd->second);
   }
-  outFile << "\">" << std::endl;
 
-  for (mesh::PtrData data : mesh.data()) { // Plot vertex data
-    Eigen::VectorXd& values = data->values();
-    int dataDimensions = data->getDimensions();
-    std::string dataName(data->getName());
-    int numberOfComponents = (dataDimensions==2) ? 3 : dataDimensions;
-    outFile << "            <DataArray type=\"Float32\" Name=\"" << dataName << "\" NumberOfComponents=\"" << numberOfComponents;
-    outFile << "\" format=\"ascii\">" << std::endl;
-    outFile << "               ";
-    if(dataDimensions > 1) {
-      Eigen::VectorXd viewTemp(dataDimensions);
-      for (size_t count = 0; count < mesh.vertices().size(); count++) {
-        size_t offset = count * dataDimensions;
-        for(int i=0; i < dataDimensions; i++){
-          viewTemp[i] = values(offset + i);
-        }
-        for(int i = 0; i < dataDimensions; i++){
-          outFile << viewTemp[i] << " ";
-        }
-        if(dataDimensions == 2){
-          outFile << "0.0" << " "; //2D data needs to be 3D for vtk
-        }
-        outFile << " ";
-      }
-    }
-    else if(dataDimensions == 1) {
-      for (size_t count = 0; count < mesh.vertices().size(); count++) {
-        outFile << values(count) << " ";
-      }
-    }
-    outFile << std::endl << "            </DataArray>" << std::endl;
+  if (not outSeriesFile) {
+    throw std::string("Could not open series file \"" + outfile.string() + "\" for VTKXML export!");
   }
-  outFile << "         </PointData> " << std::endl;
-}
 
-void ExportVTKXML::writeVertex
-(
-  const Eigen::VectorXd& position,
-  std::ofstream&         outFile)
-{
-  outFile << "               ";
-  for (int i = 0; i < position.size(); i++){
-    outFile << position(i) << "  ";
+  if (seriesEnd == _seriesEnds.end()) {
+    std::string byteOrder = utils::isMachineBigEndian() ? "BigEndian" : "LittleEndian";
+    outSeriesFile << "<?xml version=\"1.0\"?>\n";
+    outSeriesFile << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"" << byteOrder << "\">\n";
+    outSeriesFile << "   <Collection>\n";
   }
-  if (position.size() ==2)
-  {
-    outFile << 0.0 << "  ";  //also for 2D scenario, vtk needs 3D data
-  }
-  outFile << std::endl;
-}
+  outSeriesFile << std::setprecision(std::numeric_limits<double>::digits10);
+  outSeriesFile << "      <DataSet timestep=\"" << snapshot.time << "\" group=\"\" part=\"0\" file=\"" << filename << "\"/>\n";
+  _seriesEnds[series] = outSeriesFile.tellp();
+  outSeriesFile << "   </Collection>\n";
+  outSeriesFile << "</VTKFile>" << std::endl;
 
-
-void ExportVTKXML:: writeTriangle
-(
-  mesh::Triangle& triangle,
-  std::ofstream&  outFile)
-{
-  outFile << triangle.vertex(0).getID() << "  ";
-  outFile << triangle.vertex(1).getID() << "  ";
-  outFile << triangle.vertex(2).getID() << "  ";
-
-}
-
-void ExportVTKXML:: writeQuadrangle
-(
-  mesh::Quad&    quad,
-  std::ofstream& outFile)
-{
-  outFile << quad.vertex(0).getID() << "  ";
-  outFile << quad.vertex(1).getID() << "  ";
-  outFile << quad.vertex(2).getID() << "  ";
-  outFile << quad.vertex(3).getID() << "  ";
-}
-
-void ExportVTKXML:: writeLine
-(
-  mesh::Edge& edge,
-  std::ofstream& outFile)
-{
-  outFile << edge.vertex(0).getID() << "  ";
-  outFile << edge.vertex(1).getID() << "  ";
+  outSeriesFile.close();
 }
 
 }} // namespace precice, io
@@ -1,17 +1,21 @@
 #pragma once
 
 #include "Export.hpp"
+#include "VTKXMLDataWriter.hpp"
+#include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
-#include <vector>
+#include <condition_variable>
+#include <deque>
+#include <ios>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <string>
-#include <Eigen/Core>
+#include <thread>
 
 namespace precice {
    namespace mesh {
       class Mesh;
-      class Quad;
-      class Edge;
-      class Triangle;
    }
 }
 
@@ -19,7 +23,26 @@ namespace precice {
 namespace io {
 
 /**
- * @brief Writes meshes to xml-vtk files. Only for parallel usage. Serial usage (coupling mode) should still use ExportVTK
+ * @brief Writes meshes to xml-vtk files.
+ *
+ * In parallel, every rank writes a sub file and the master writes a master file. Serial
+ * participants should still use ExportVTK, unless a binary format or asynchronous export
+ * is wanted. Then, a single .vtu file is written.
+ *
+ * Every export copies the mesh and its data into a snapshot first. In asynchronous mode,
+ * the snapshot is formatted and written by a background thread, such that the caller can
+ * continue. At most two snapshots exist at a time, one being written and one waiting. If
+ * both are taken, doExport() blocks until the older one is written. If writing fails in the
+ * background thread, the error is raised by the next doExport(), drain(), or close(). The
+ * destructor only warns about an error not raised so far, as it must not exit.
+ *
+ * With a single aggregator, the slaves send their snapshots to the master, which writes a
+ * single .vtu file per export instead of one file per rank and a master file. With N > 1
+ * aggregators, the ranks are split into N contiguous groups. The first rank of every group
+ * gathers the snapshots of its group over a socket connection and writes one sub file, which
+ * the master file references. Optionally, a .pvd collection file is maintained for every
+ * series of exports, i.e., for every name without its suffix (e.g. ".dt5"), such that the
+ * time series is loaded with a single file. Every export appends its file and time to it.
  */
 class ExportVTKXML : public Export
 {
@@ -29,8 +52,22 @@ public:
    * @brief Standard constructor
    *
    * @param[in] writeNormals write normals to file?
+   * @param[in] format Encoding of the data arrays.
+   * @param[in] compress Compress the data arrays of binary formats with zlib?
+   * @param[in] asynchronous Write the files in a background thread?
+   * @param[in] aggregators Number of ranks writing the data of all ranks, 0 if every rank writes its own file.
+   * @param[in] timeSeries Write a .pvd collection file for every series of exports?
    */
-  ExportVTKXML ( bool writeNormals);
+  ExportVTKXML (
+    bool                     writeNormals,
+    VTKXMLDataWriter::Format format       = VTKXMLDataWriter::ASCII,
+    bool                     compress     = false,
+    bool                     asynchronous = false,
+    int                      aggregators  = 0,
+    bool                     timeSeries   = false );
+
+  /// Writes all pending exports and stops the background thread, warns about unreported write errors.
+  virtual ~ExportVTKXML();
 
   /// Returns the VTK type ID.
   virtual int getType() const;
@@ -41,71 +78,126 @@ public:
     const std::string& location,
     mesh::Mesh&        mesh );
 
-  static void writeVertex (
-    const Eigen::VectorXd& position,
-    std::ofstream&         outFile );
-
-  static void writeLine (
-    mesh::Edge&    edge,
-    std::ofstream& outFile );
+  /// Blocks until all asynchronous exports are written.
+  virtual void drain();
 
-  static void writeTriangle (
-    mesh::Triangle& triangle,
-    std::ofstream&  outFile );
+  /// Writes all pending exports, stops the background thread, and raises write errors.
+  virtual void close();
 
-  static void writeQuadrangle (
-    mesh::Quad&    quad,
-    std::ofstream& outFile );
+  /// Sets the simulation time written to the .pvd collection files.
+  virtual void setTime(double time);
 
 private:
 
    logging::Logger _log{"io::ExportVTKXML"};
 
+   /// Copy of everything written for one export.
+   struct Snapshot;
+
+   /// Maximum number of snapshots being written or waiting to be written.
+   static const size_t MAX_PENDING_SNAPSHOTS = 2;
+
    /// By default set true: plot vertex normals, false: no normals plotting
    bool _writeNormals;
 
-   /// dimensions of mesh
-   int _meshDimensions;
+   /// Encoding of the data arrays
+   VTKXMLDataWriter::Format _format;
+
+   /// Compress the data arrays of binary formats
+   bool _compress;
+
+   /// Write the files in a background thread
+   bool _asynchronous;
+
+   /// Number of ranks writing the data of all ranks, 0 if every rank writes its own file
+   int _aggregators;
+
+   /// Connection of a group member to its aggregator, or of an aggregator to its group
+   com::PtrCommunication _aggregatorCom;
+
+   /// Simulation time of the following exports
+   double _time = 0.0;
+
+   /// Write a .pvd collection file for every series of exports
+   bool _timeSeries;
+
+   /// End of the last entry of every .pvd collection file, only accessed by the writing thread
+   std::map<std::string, std::streamoff> _seriesEnds;
+
+   /// Snapshots being written (front) or waiting to be written
+   std::deque<std::unique_ptr<Snapshot>> _pendingSnapshots;
+
+   /// First error of the background thread, raised in the main thread
+   std::string _writeError;
+
+   /// Protects _pendingSnapshots, _stopWriting, and _writeError
+   std::mutex _mutex;
 
-   /// List of names of all scalar data on mesh
-   std::vector<std::string> _scalarDataNames;
+   /// Notified if a snapshot is added or written
+   std::condition_variable _pendingChanged;
 
-   /// List of names of all vector data on mesh
-   std::vector<std::string> _vectorDataNames;
+   bool _stopWriting = false;
+
+   std::thread _writerThread;
+
+   /// Copies names and dimensions, the mesh, and its data.
+   std::unique_ptr<Snapshot> takeSnapshot (
+     const std::string& name,
+     const std::string& location,
+     mesh::Mesh&        mesh ) const;
+
+   /// Sends the snapshots of all ranks to their aggregators, which append them to their own snapshot.
+   void aggregateSnapshot ( Snapshot& snapshot );
+
+   /// Connects the members of the given group of ranks to its aggregator, the first rank of the group.
+   void connectAggregator (
+     const Snapshot& snapshot,
+     int             group,
+     int             firstRank,
+     int             groupSize );
+
+   /// Sends the snapshot to rank 0 of the communication and clears it, as nothing is left to write.
+   void sendSnapshot (
+     Snapshot&           snapshot,
+     com::Communication& com );
+
+   /// Receives the snapshot of the given rank and appends it.
+   void receiveSnapshot (
+     Snapshot&           snapshot,
+     com::Communication& com,
+     int                 rankSender );
 
    /**
-    * @brief Stores scalar and vector data names in string vectors
-    * Needed for writing master file and sub files
+    * @brief Writes the master file and the sub file of a snapshot, as required.
+    *
+    * Throws the error message as std::string if a file cannot be written, since this may
+    * happen in the background thread.
     */
-   void processDataNamesAndDimensions
-   (
-     mesh::Mesh& mesh);
+   void write ( const Snapshot& snapshot );
 
    /**
     * @brief Writes the master file (called only by the master rank)
     */
-   void writeMasterFile
-   (
-     const std::string& name,
-     const std::string& location,
-     mesh::Mesh&        mesh);
+   void writeMasterFile ( const Snapshot& snapshot );
 
    /**
-    * @brief Writes the sub file for each rank
+    * @brief Writes the sub file for each rank, or the only file in serial
     */
-   void writeSubFile
-   (
-     const std::string& name,
-     const std::string& location,
-     mesh::Mesh&        mesh);
+   void writeSubFile ( const Snapshot& snapshot );
+
+   /// Appends a written file to the .pvd collection file of its series.
+   void writeTimeSeries (
+     const Snapshot&    snapshot,
+     const std::string& filename );
+
+   /// Loop of the background thread.
+   void writePendingSnapshots();
 
-   void exportMesh (
-     std::ofstream& outFile,
-     mesh::Mesh&    mesh );
+   /// Writes all pending snapshots and joins the background thread, if running.
+   void stopWriterThread();
 
-   void exportData (
-     std::ofstream& outFile,
-     mesh::Mesh&    mesh );
+   /// Raises the error of the background thread, if any. Requires _mutex or a joined thread.
+   void checkWriteError();
 };
 
 }} // namespace precice, io
@@ -0,0 +1,243 @@
+#include "VTKXMLDataWriter.hpp"
+#include <algorithm>
+#include <vector>
+#include "utils/Helpers.hpp"
+#include "utils/assertion.hpp"
+
+#ifndef PRECICE_NO_ZLIB
+#include <zlib.h>
+#endif
+
+namespace precice {
+namespace io {
+
+namespace {
+
+/// Header type of the binary data arrays, announced as header_type in the VTKFile element.
+using HeaderType = uint64_t;
+
+/// Uncompressed size of the blocks of compressed data arrays.
+const size_t COMPRESSION_BLOCK_SIZE = 1 << 15;
+
+std::string encodeBase64(const char* bytes, size_t size)
+{
+  static const char table[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string encoded;
+  encoded.reserve(((size + 2) / 3) * 4);
+  size_t i = 0;
+  for (; i + 2 < size; i += 3) {
+    uint32_t triple = (uint8_t(bytes[i]) << 16) | (uint8_t(bytes[i+1]) << 8) | uint8_t(bytes[i+2]);
+    encoded.push_back(table[(triple >> 18) & 0x3F]);
+    encoded.push_back(table[(triple >> 12) & 0x3F]);
+    encoded.push_back(table[(triple >> 6) & 0x3F]);
+    encoded.push_back(table[triple & 0x3F]);
+  }
+  if (i < size) {
+    uint32_t triple = uint8_t(bytes[i]) << 16;
+    if (i + 1 < size) {
+      triple |= uint8_t(bytes[i+1]) << 8;
+    }
+    encoded.push_back(table[(triple >> 18) & 0x3F]);
+    encoded.push_back(table[(triple >> 12) & 0x3F]);
+    encoded.push_back(i + 1 < size ? table[(triple >> 6) & 0x3F] : '=');
+    encoded.push_back('=');
+  }
+  return encoded;
+}
+
+void appendHeader(std::string& header, HeaderType value)
+{
+  header.append(reinterpret_cast<const char*>(&value), sizeof(HeaderType));
+}
+
+template<typename T>
+void writeValues(std::ostream& outFile, const T* values, size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    outFile << values[i] << ' ';
+  }
+}
+
+void writeValues(std::ostream& outFile, const uint8_t* values, size_t size)
+{
+  for (size_t i = 0; i < size; i++) {
+    outFile << static_cast<int>(values[i]) << ' ';
+  }
+}
+
+} // namespace
+
+VTKXMLDataWriter:: VTKXMLDataWriter
+(
+  std::ostream& outFile,
+  Format        format,
+  bool          compress )
+:
+  _outFile(outFile),
+  _format(format),
+  _compress(compress && (format != ASCII))
+{
+#ifdef PRECICE_NO_ZLIB
+  if (_compress) {
+    throw std::string("Compressed VTK export requires preCICE to be compiled with zlib!");
+  }
+#endif
+}
+
+std::string VTKXMLDataWriter:: getFileAttributes() const
+{
+  std::string byteOrder = utils::isMachineBigEndian() ? "BigEndian" : "LittleEndian";
+  if (_format == ASCII) {
+    return "version=\"0.1\" byte_order=\"" + byteOrder + "\"";
+  }
+  std::string attributes = "version=\"1.0\" byte_order=\"" + byteOrder + "\" header_type=\"UInt64\"";
+  if (_compress) {
+    attributes += " compressor=\"vtkZLibDataCompressor\"";
+  }
+  return attributes;
+}
+
+std::string VTKXMLDataWriter:: getFloatType() const
+{
+  // ASCII values are written with the default stream precision
+  return (_format == ASCII) ? "Float32" : "Float64";
+}
+
+void VTKXMLDataWriter:: writeDataArray
+(
+  const std::string& name,
+  int                numberOfComponents,
+  const double*      values,
+  size_t             size )
+{
+  if (_format == ASCII) {
+    writeDataArrayTag(name, getFloatType(), numberOfComponents);
+    writeValues(_outFile, values, size);
+    _outFile << "\n            </DataArray>\n";
+  }
+  else {
+    writeBinaryDataArray(name, getFloatType(), numberOfComponents,
+                         reinterpret_cast<const char*>(values), size * sizeof(double));
+  }
+}
+
+void VTKXMLDataWriter:: writeDataArray
+(
+  const std::string& name,
+  int                numberOfComponents,
+  const int*         values,
+  size_t             size )
+{
+  static_assert(sizeof(int) == 4, "VTK type Int32 requires 4 byte integers");
+  if (_format == ASCII) {
+    writeDataArrayTag(name, "Int32", numberOfComponents);
+    writeValues(_outFile, values, size);
+    _outFile << "\n            </DataArray>\n";
+  }
+  else {
+    writeBinaryDataArray(name, "Int32", numberOfComponents,
+                         reinterpret_cast<const char*>(values), size * sizeof(int));
+  }
+}
+
+void VTKXMLDataWriter:: writeDataArray
+(
+  const std::string& name,
+  int                numberOfComponents,
+  const uint8_t*     values,
+  size_t             size )
+{
+  if (_format == ASCII) {
+    writeDataArrayTag(name, "UInt8", numberOfComponents);
+    writeValues(_outFile, values, size);
+    _outFile << "\n            </DataArray>\n";
+  }
+  else {
+    writeBinaryDataArray(name, "UInt8", numberOfComponents,
+                         reinterpret_cast<const char*>(values), size);
+  }
+}
+
+void VTKXMLDataWriter:: writeAppendedData()
+{
+  if (_format != APPENDED) {
+    return;
+  }
+  _outFile << "   <AppendedData encoding=\"raw\">\n_";
+  _outFile.write(_appendedData.data(), _appendedData.size());
+  _outFile << "\n   </AppendedData>\n";
+  _appendedData.clear();
+}
+
+void VTKXMLDataWriter:: writeDataArrayTag
+(
+  const std::string& name,
+  const std::string& type,
+  int                numberOfComponents )
+{
+  _outFile << "            <DataArray type=\"" << type << "\" Name=\"" << name
+           << "\" NumberOfComponents=\"" << numberOfComponents << "\" format=\"";
+  if (_format == ASCII) {
+    _outFile << "ascii\">\n               ";
+  }
+  else if (_format == BINARY) {
+    _outFile << "binary\">\n               ";
+  }
+  else {
+    _outFile << "appended\" offset=\"" << _appendedData.size() << "\"/>\n";
+  }
+}
+
+void VTKXMLDataWriter:: writeBinaryDataArray
+(
+  const std::string& name,
+  const std::string& type,
+  int                numberOfComponents,
+  const char*        bytes,
+  size_t             size )
+{
+  assertion(_format != ASCII);
+  writeDataArrayTag(name, type, numberOfComponents);
+
+  std::string header;
+  std::string compressed;
+  if (_compress) {
+#ifndef PRECICE_NO_ZLIB
+    size_t numberOfBlocks = (size + COMPRESSION_BLOCK_SIZE - 1) / COMPRESSION_BLOCK_SIZE;
+    appendHeader(header, numberOfBlocks);
+    appendHeader(header, COMPRESSION_BLOCK_SIZE);
+    appendHeader(header, size % COMPRESSION_BLOCK_SIZE);
+    std::vector<Bytef> block(compressBound(COMPRESSION_BLOCK_SIZE));
+    for (size_t offset = 0; offset < size; offset += COMPRESSION_BLOCK_SIZE) {
+      uLongf compressedSize = block.size();
+      uLong  blockSize      = std::min(COMPRESSION_BLOCK_SIZE, size - offset);
+      int    status         = compress2(block.data(), &compressedSize,
+                                        reinterpret_cast<const Bytef*>(bytes + offset),
+                                        blockSize, Z_DEFAULT_COMPRESSION);
+      if (status != Z_OK) {
+        throw std::string("Compression of data array \"" + name + "\" failed!");
+      }
+      appendHeader(header, compressedSize);
+      compressed.append(reinterpret_cast<const char*>(block.data()), compressedSize);
+    }
+    bytes = compressed.data();
+    size  = compressed.size();
+#endif
+  }
+  else {
+    appendHeader(header, size);
+  }
+
+  if (_format == BINARY) {
+    // VTK decodes header and data separately
+    _outFile << encodeBase64(header.data(), header.size()) << encodeBase64(bytes, size);
+    _outFile << "\n            </DataArray>\n";
+  }
+  else {
+    _appendedData += header;
+    _appendedData.append(bytes, size);
+  }
+}
+
+}} // namespace precice, io
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace io {
+
+/**
+ * @brief Writes the DataArray elements of VTK XML files.
+ *
+ * In the ASCII format, the values are written as text into the DataArray element. In the
+ * binary formats, every array is preceded by a header holding its size in bytes (UInt64).
+ * The BINARY format stores header and array base64 encoded inside the DataArray element. The
+ * APPENDED format collects the raw bytes of all arrays, which are written as one block by
+ * writeAppendedData() at the end of the file.
+ *
+ * If compression is enabled, binary arrays are compressed blockwise with zlib, in the layout
+ * of the vtkZLibDataCompressor of VTK. Errors are thrown as std::string, since the writer
+ * may run in the background thread of ExportVTKXML.
+ */
+class VTKXMLDataWriter
+{
+public:
+
+  /// Encodings of the data arrays.
+  enum Format {
+    ASCII,
+    BINARY,
+    APPENDED
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] outFile Stream of the VTK XML file, has to be opened in binary mode for APPENDED.
+   * @param[in] format Encoding of the data arrays.
+   * @param[in] compress Compress binary arrays with zlib, ignored for ASCII.
+   */
+  VTKXMLDataWriter (
+    std::ostream& outFile,
+    Format        format,
+    bool          compress );
+
+  /// Returns the attributes of the VTKFile element describing the encoding.
+  std::string getFileAttributes() const;
+
+  /// Returns the VTK type of floating point data arrays.
+  std::string getFloatType() const;
+
+  /// Writes a DataArray element holding size doubles.
+  void writeDataArray (
+    const std::string& name,
+    int                numberOfComponents,
+    const double*      values,
+    size_t             size );
+
+  /// Writes a DataArray element holding size integers.
+  void writeDataArray (
+    const std::string& name,
+    int                numberOfComponents,
+    const int*         values,
+    size_t             size );
+
+  /// Writes a DataArray element holding size unsigned bytes.
+  void writeDataArray (
+    const std::string& name,
+    int                numberOfComponents,
+    const uint8_t*     values,
+    size_t             size );
+
+  /// Writes the AppendedData element. Does nothing, if the format is not APPENDED.
+  void writeAppendedData();
+
+private:
+
+  logging::Logger _log{"io::VTKXMLDataWriter"};
+
+  std::ostream& _outFile;
+
+  Format _format;
+
+  bool _compress;
+
+  /// Raw bytes of all arrays written so far in the APPENDED format.
+  std::string _appendedData;
+
+  /// Writes the opening tag of a DataArray element.
+  void writeDataArrayTag (
+    const std::string& name,
+    const std::string& type,
+    int                numberOfComponents );
+
+  /// Writes a DataArray element in one of the binary formats.
+  void writeBinaryDataArray (
+    const std::string& name,
+    const std::string& type,
+    int                numberOfComponents,
+    const char*        bytes,
+    size_t             size );
+};
+
+}} // namespace precice, io
@@ -2,6 +2,8 @@
 #include "io/Export.hpp"
 #include "xml/XMLTag.hpp"
 #include "xml/XMLAttribute.hpp"
+#include "xml/ValidatorEquals.hpp"
+#include "xml/ValidatorOr.hpp"
 
 namespace precice {
 namespace io {
@@ -22,6 +24,26 @@ ExportConfiguration:: ExportConfiguration(xml::XMLTag& parent)
   attrLocation.setDocumentation("Directory to export the files to.");
   attrLocation.setDefaultValue("");
 
+  XMLAttribute<std::string> attrFormat(ATTR_FORMAT);
+  doc = "Encoding of the exported data. \"" + VALUE_ASCII + "\" writes text files. ";
+  doc += "\"" + VALUE_BINARY + "\" writes base64 encoded binary data into VTK XML files, ";
+  doc += "\"" + VALUE_APPENDED + "\" writes raw binary data appended to VTK XML files, which is the fastest. ";
+  doc += "Binary formats are also used by serial participants.";
+  attrFormat.setDocumentation(doc);
+  ValidatorEquals<std::string> validAscii(VALUE_ASCII);
+  ValidatorEquals<std::string> validBinary(VALUE_BINARY);
+  ValidatorEquals<std::string> validAppended(VALUE_APPENDED);
+  attrFormat.setValidator(validAscii || validBinary || validAppended);
+  attrFormat.setDefaultValue(VALUE_ASCII);
+
+  XMLAttribute<std::string> attrCompression(ATTR_COMPRESSION);
+  doc = "Compression of binary data. \"" + VALUE_ZLIB + "\" requires preCICE to be compiled with zlib.";
+  attrCompression.setDocumentation(doc);
+  ValidatorEquals<std::string> validNone(VALUE_NONE);
+  ValidatorEquals<std::string> validZlib(VALUE_ZLIB);
+  attrCompression.setValidator(validNone || validZlib);
+  attrCompression.setDefaultValue(VALUE_NONE);
+
   XMLAttribute<int> attrTimestepInterval(ATTR_TIMESTEP_INTERVAL);
   doc = "preCICE timestep interval for export of files. Choose -1 for no exports.";
   attrTimestepInterval.setDocumentation(doc);
@@ -43,12 +65,37 @@ ExportConfiguration:: ExportConfiguration(xml::XMLTag& parent)
   attrEveryIteration.setDocumentation(doc);
   attrEveryIteration.setDefaultValue(false);
 
+  XMLAttribute<bool> attrAsynchronous(ATTR_ASYNCHRONOUS);
+  doc = "If set to on/yes, the files are written by a background thread, while the ";
+  doc += "participant continues. Pending files are written at the latest in finalize.";
+  attrAsynchronous.setDocumentation(doc);
+  attrAsynchronous.setDefaultValue(false);
+
+  XMLAttribute<int> attrAggregators(ATTR_AGGREGATORS);
+  doc = "Number of ranks writing the files of a parallel export. With 0, every rank writes its own file ";
+  doc += "and the master writes a master file. With 1, the master gathers the data of all ranks and writes ";
+  doc += "a single file. With N > 1, the ranks are split into N contiguous groups, the first rank of every ";
+  doc += "group gathers and writes the data of its group, and the master writes a master file.";
+  attrAggregators.setDocumentation(doc);
+  attrAggregators.setDefaultValue(0);
+
+  XMLAttribute<bool> attrTimeSeries(ATTR_TIME_SERIES);
+  doc = "If set to on/yes, a .pvd collection file referencing all exports of a mesh is written, ";
+  doc += "which loads the whole time series at once.";
+  attrTimeSeries.setDocumentation(doc);
+  attrTimeSeries.setDefaultValue(false);
+
   for (XMLTag& tag : tags){
     tag.addAttribute(attrLocation);
+    tag.addAttribute(attrFormat);
+    tag.addAttribute(attrCompression);
     tag.addAttribute(attrTimestepInterval);
     tag.addAttribute(attrTriggerSolver);
     tag.addAttribute(attrNormals);
     tag.addAttribute(attrEveryIteration);
+    tag.addAttribute(attrAsynchronous);
+    tag.addAttribute(attrAggregators);
+    tag.addAttribute(attrTimeSeries);
     parent.addSubtag(tag);
   }
 }
@@ -64,7 +111,26 @@ void ExportConfiguration:: xmlTagCallback
     context.timestepInterval = tag.getIntAttributeValue(ATTR_TIMESTEP_INTERVAL);
     context.plotNormals = tag.getBooleanAttributeValue(ATTR_NORMALS);
     context.everyIteration = tag.getBooleanAttributeValue(ATTR_EVERY_ITERATION);
+    context.asynchronous = tag.getBooleanAttributeValue(ATTR_ASYNCHRONOUS);
+    context.aggregators = tag.getIntAttributeValue(ATTR_AGGREGATORS);
+    context.timeSeries = tag.getBooleanAttributeValue(ATTR_TIME_SERIES);
     context.type = tag.getName();
+    std::string format = tag.getStringAttributeValue(ATTR_FORMAT);
+    if (format == VALUE_BINARY) {
+      context.format = VTKXMLDataWriter::BINARY;
+    } else if (format == VALUE_APPENDED) {
+      context.format = VTKXMLDataWriter::APPENDED;
+    } else {
+      context.format = VTKXMLDataWriter::ASCII;
+    }
+    context.compress = tag.getStringAttributeValue(ATTR_COMPRESSION) == VALUE_ZLIB;
+#   ifdef PRECICE_NO_ZLIB
+    CHECK(not context.compress, "Export compression \"" << VALUE_ZLIB << "\" can only be used "
+          << "when preCICE is compiled with zlib!");
+#   endif
+    CHECK(not context.compress || context.format != VTKXMLDataWriter::ASCII,
+          "Export compression requires a binary format!");
+    CHECK(context.aggregators >= 0, "The number of export aggregators has to be >= 0!");
     _contexts.push_back(context);
   }
 }
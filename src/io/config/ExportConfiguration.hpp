@@ -40,11 +40,23 @@ private:
   const std::string ATTR_AUTO = "auto";
   const std::string VALUE_VTK = "vtk";
 
+  const std::string ATTR_FORMAT = "format";
+  const std::string VALUE_ASCII = "ascii";
+  const std::string VALUE_BINARY = "binary";
+  const std::string VALUE_APPENDED = "appended";
+
+  const std::string ATTR_COMPRESSION = "compression";
+  const std::string VALUE_NONE = "none";
+  const std::string VALUE_ZLIB = "zlib";
+
   const std::string ATTR_TIMESTEP_INTERVAL = "timestep-interval";
   const std::string ATTR_NEIGHBORS = "neighbors";
   const std::string ATTR_TRIGGER_SOLVER = "trigger-solver";
   const std::string ATTR_NORMALS = "normals";
   const std::string ATTR_EVERY_ITERATION = "every-iteration";
+  const std::string ATTR_ASYNCHRONOUS = "asynchronous";
+  const std::string ATTR_AGGREGATORS = "aggregators";
+  const std::string ATTR_TIME_SERIES = "time-series";
 
   std::list<ExportContext> _contexts;
 };
@@ -0,0 +1,53 @@
+#include "io/BinaryReader.hpp"
+#include "io/BinaryWriter.hpp"
+#include "testing/Testing.hpp"
+
+BOOST_AUTO_TEST_SUITE(IOTests)
+
+using namespace precice;
+using namespace precice::io;
+
+BOOST_AUTO_TEST_CASE(BinaryWriterReaderTest, * testing::OnMaster())
+{
+  Eigen::MatrixXd matOutput(3, 2);
+  matOutput << 1, 2, 3, 4, 5, 6;
+  Eigen::VectorXd vecOutput = Eigen::VectorXd::LinSpaced(4, 0.1, 0.4);
+  Eigen::MatrixXd emptyOutput(5, 0);
+  std::deque<int> colsOutput{2, 0, 3};
+  {
+    BinaryWriter writer("io-BinaryWriterReaderTest.bin");
+    writer.write(1.0 / 3.0);
+    writer.write(-7);
+    writer.write(true);
+    writer.write(matOutput);
+    writer.write(vecOutput);
+    writer.write(emptyOutput);
+    writer.write(colsOutput);
+  }
+
+  BinaryReader reader("io-BinaryWriterReaderTest.bin");
+  double scalar = 0.0;
+  reader.read(scalar);
+  BOOST_TEST(scalar == 1.0 / 3.0);
+  int integer = 0;
+  reader.read(integer);
+  BOOST_TEST(integer == -7);
+  bool flag = false;
+  reader.read(flag);
+  BOOST_TEST(flag);
+  Eigen::MatrixXd matInput;
+  reader.read(matInput);
+  BOOST_TEST(testing::equals(matOutput, matInput));
+  Eigen::VectorXd vecInput;
+  reader.read(vecInput);
+  BOOST_TEST((vecInput == vecOutput));
+  Eigen::MatrixXd emptyInput;
+  reader.read(emptyInput);
+  BOOST_TEST(emptyInput.rows() == 5);
+  BOOST_TEST(emptyInput.cols() == 0);
+  std::deque<int> colsInput;
+  reader.read(colsInput);
+  BOOST_TEST((colsInput == colsOutput));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // IOTests
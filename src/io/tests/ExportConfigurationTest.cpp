@@ -29,6 +29,22 @@ BOOST_AUTO_TEST_CASE(Configuration)
     BOOST_TEST(context.timestepInterval == 1);
     BOOST_TEST(context.location == "somepath");
     BOOST_TEST(not context.triggerSolverPlot);
+    BOOST_TEST(context.format == io::VTKXMLDataWriter::ASCII);
+    BOOST_TEST(not context.asynchronous);
+    BOOST_TEST(context.aggregators == 0);
+    BOOST_TEST(not context.timeSeries);
+  }
+  {
+    tag.clear();
+    io::ExportConfiguration config(tag);
+    xml::configure(tag, testing::getPathToSources() + "/io/tests/config3.xml");
+    BOOST_TEST(config.exportContexts().size() == 1);
+    const io::ExportContext &context = config.exportContexts().front();
+    BOOST_TEST(context.format == io::VTKXMLDataWriter::APPENDED);
+    BOOST_TEST(not context.compress);
+    BOOST_TEST(context.asynchronous);
+    BOOST_TEST(context.aggregators == 2);
+    BOOST_TEST(context.timeSeries);
   }
 }
 
@@ -1,7 +1,10 @@
 #ifndef PRECICE_NO_MPI
 
+#include <fstream>
+#include <iterator>
 #include "com/MPIDirectCommunication.hpp"
 #include "io/ExportVTKXML.hpp"
+#include "mesh/Data.hpp"
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Triangle.hpp"
@@ -83,6 +86,99 @@ struct SetupMasterSlaveFixture {
   }
 };
 
+BOOST_AUTO_TEST_SUITE(VTKXMLExportSerial, *testing::OnMaster())
+
+BOOST_AUTO_TEST_CASE(ExportTriangulatedMeshAppended)
+{
+  int        dim           = 3;
+  bool       invertNormals = false;
+  mesh::Mesh mesh("MyMesh", dim, invertNormals);
+
+  mesh::Vertex &  v1      = mesh.createVertex(Eigen::VectorXd::Zero(dim));
+  mesh::Vertex &  v2      = mesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+  Eigen::VectorXd coords3 = Eigen::VectorXd::Zero(dim);
+  coords3[0]              = 1.0;
+  mesh::Vertex &v3        = mesh.createVertex(coords3);
+
+  mesh::Edge &e1 = mesh.createEdge(v1, v2);
+  mesh::Edge &e2 = mesh.createEdge(v2, v3);
+  mesh::Edge &e3 = mesh.createEdge(v3, v1);
+  mesh.createTriangle(e1, e2, e3);
+
+  mesh::PtrData data = mesh.createData("Forces", dim);
+  mesh.allocateDataValues();
+  data->values() << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0;
+  mesh.computeState();
+
+  bool             exportNormals = false;
+  io::ExportVTKXML exportVTKXML(exportNormals, io::VTKXMLDataWriter::APPENDED);
+  std::string      filename = "io-ExportVTKXMLTest-testExportTriangulatedMeshAppended";
+  std::string      location = "";
+  exportVTKXML.doExport(filename, location, mesh);
+
+  // serial participants write a single file
+  std::ifstream file(filename + ".vtu", std::ios::binary);
+  BOOST_TEST(file.good());
+  std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  BOOST_TEST(content.find("<AppendedData encoding=\"raw\">") != std::string::npos);
+  BOOST_TEST(content.find("Name=\"Forces\" NumberOfComponents=\"3\" format=\"appended\"") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(ExportMeshAsynchronous)
+{
+  int        dim           = 2;
+  bool       invertNormals = false;
+  mesh::Mesh mesh("MyMesh", dim, invertNormals);
+
+  mesh::Vertex &  v1      = mesh.createVertex(Eigen::VectorXd::Zero(dim));
+  mesh::Vertex &  v2      = mesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+  mesh.createEdge(v1, v2);
+
+  mesh::PtrData data = mesh.createData("Forces", dim);
+  mesh.allocateDataValues();
+  data->values() << 1.0, 2.0, 3.0, 4.0;
+  mesh.computeState();
+
+  bool             exportNormals = false;
+  io::ExportVTKXML exportVTKXML(exportNormals, io::VTKXMLDataWriter::ASCII, false, true);
+  std::string      filename = "io-ExportVTKXMLTest-testExportMeshAsynchronous";
+  std::string      location = "";
+  for (int i = 0; i < 3; i++) {
+    exportVTKXML.doExport(filename + std::to_string(i), location, mesh);
+    // the export works on a snapshot, the mesh can be changed right away
+    data->values() *= 2.0;
+  }
+  exportVTKXML.drain();
+
+  for (int i = 0; i < 3; i++) {
+    std::ifstream file(filename + std::to_string(i) + ".vtu");
+    BOOST_TEST(file.good());
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    // first value of Forces, scaled after each export
+    std::string forces = std::to_string(1 << i) + " " + std::to_string(2 << i) + " 0 ";
+    BOOST_TEST(content.find(forces) != std::string::npos);
+  }
+}
+
+/// A failed asynchronous export is only reported by close(), the destructor must not exit
+BOOST_AUTO_TEST_CASE(ExportAsynchronousFailureWithoutClose)
+{
+  int        dim           = 2;
+  bool       invertNormals = false;
+  mesh::Mesh mesh("MyMesh", dim, invertNormals);
+  mesh.createVertex(Eigen::VectorXd::Zero(dim));
+  mesh.computeState();
+
+  bool exportNormals = false;
+  {
+    io::ExportVTKXML exportVTKXML(exportNormals, io::VTKXMLDataWriter::ASCII, false, true);
+    exportVTKXML.doExport("io-ExportVTKXMLTest-testExportAsynchronousFailure", "/nonexistent-precice-directory", mesh);
+  }
+  BOOST_TEST(mesh.vertices().size() == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // VTKXMLExportSerial
+
 BOOST_FIXTURE_TEST_SUITE(VTKXMLExport, SetupMasterSlaveFixture,
                          *testing::OnSize(4))
 
@@ -179,6 +275,110 @@ BOOST_AUTO_TEST_CASE(ExportTriangulatedMesh)
   exportVTKXML.doExport(filename, location, mesh);
 }
 
+BOOST_AUTO_TEST_CASE(ExportTriangulatedMeshAggregated)
+{
+  int        dim           = 3;
+  bool       invertNormals = false;
+  mesh::Mesh mesh("MyMesh", dim, invertNormals);
+
+  if (utils::Parallel::getProcessRank() != 1) {
+    mesh::Vertex &  v1      = mesh.createVertex(Eigen::VectorXd::Zero(dim));
+    mesh::Vertex &  v2      = mesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+    Eigen::VectorXd coords3 = Eigen::VectorXd::Zero(dim);
+    coords3[0]              = 1.0;
+    mesh::Vertex &v3        = mesh.createVertex(coords3);
+
+    mesh::Edge &e1 = mesh.createEdge(v1, v2);
+    mesh::Edge &e2 = mesh.createEdge(v2, v3);
+    mesh::Edge &e3 = mesh.createEdge(v3, v1);
+    mesh.createTriangle(e1, e2, e3);
+  }
+  mesh.computeState();
+
+  bool             exportNormals = false;
+  int              aggregators   = 1;
+  io::ExportVTKXML exportVTKXML(exportNormals, io::VTKXMLDataWriter::ASCII, false, false, aggregators, true);
+  std::string      filename = "io-ExportVTKXMLTest-testExportTriangulatedMeshAggregated";
+  std::string      location = "";
+  exportVTKXML.setTime(0.5);
+  exportVTKXML.doExport(filename + ".dt0", location, mesh);
+  exportVTKXML.setTime(1.5);
+  exportVTKXML.doExport(filename + ".dt1", location, mesh);
+
+  if (utils::MasterSlave::_masterMode) {
+    // one file with the triangles of ranks 0, 2, and 3
+    std::ifstream file(filename + ".dt1.vtu");
+    BOOST_TEST(file.good());
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    BOOST_TEST(content.find("NumberOfPoints=\"9\" NumberOfCells=\"3\"") != std::string::npos);
+    BOOST_TEST(content.find("0 1 2 3 4 5 6 7 8 ") != std::string::npos);
+    BOOST_TEST(content.find("3 6 9 ") != std::string::npos);
+
+    std::ifstream seriesFile(filename + ".pvd");
+    BOOST_TEST(seriesFile.good());
+    std::string series((std::istreambuf_iterator<char>(seriesFile)), std::istreambuf_iterator<char>());
+    BOOST_TEST(series.find("timestep=\"0.5\" group=\"\" part=\"0\" file=\"" + filename + ".dt0.vtu\"") != std::string::npos);
+    BOOST_TEST(series.find("timestep=\"1.5\" group=\"\" part=\"0\" file=\"" + filename + ".dt1.vtu\"") != std::string::npos);
+    // appended entries leave a single well-formed collection
+    BOOST_TEST(series.find("</Collection>") == series.rfind("</Collection>"));
+    BOOST_TEST(series.rfind("</VTKFile>\n") == series.size() - 11);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ExportTriangulatedMeshTwoAggregators)
+{
+  int        dim           = 3;
+  bool       invertNormals = false;
+  mesh::Mesh mesh("MyMesh", dim, invertNormals);
+
+  if (utils::Parallel::getProcessRank() != 1) {
+    mesh::Vertex &  v1      = mesh.createVertex(Eigen::VectorXd::Zero(dim));
+    mesh::Vertex &  v2      = mesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+    Eigen::VectorXd coords3 = Eigen::VectorXd::Zero(dim);
+    coords3[0]              = 1.0;
+    mesh::Vertex &v3        = mesh.createVertex(coords3);
+
+    mesh::Edge &e1 = mesh.createEdge(v1, v2);
+    mesh::Edge &e2 = mesh.createEdge(v2, v3);
+    mesh::Edge &e3 = mesh.createEdge(v3, v1);
+    mesh.createTriangle(e1, e2, e3);
+  }
+  if (utils::Parallel::getProcessRank() == 0) {
+    mesh.getVertexDistribution()[0] = {0, 1, 2};
+    mesh.getVertexDistribution()[1] = {};
+    mesh.getVertexDistribution()[2] = {3, 4, 5};
+    mesh.getVertexDistribution()[3] = {6, 7, 8};
+  }
+  mesh.computeState();
+
+  bool             exportNormals = false;
+  int              aggregators   = 2;
+  io::ExportVTKXML exportVTKXML(exportNormals, io::VTKXMLDataWriter::ASCII, false, false, aggregators, false);
+  std::string      filename = "io-ExportVTKXMLTest-testExportTriangulatedMeshTwoAggregators";
+  std::string      location = "";
+  exportVTKXML.doExport(filename + ".dt0", location, mesh);
+  exportVTKXML.doExport(filename + ".dt1", location, mesh);
+
+  // Rank 0 writes the group of ranks 0 and 1, rank 2 the group of ranks 2 and 3
+  int rank = utils::MasterSlave::_rank;
+  std::ifstream file(filename + ".dt1_r" + std::to_string(rank) + ".vtu");
+  BOOST_TEST(file.good() == (rank == 0 || rank == 2));
+  if (rank == 2) {
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    BOOST_TEST(content.find("NumberOfPoints=\"6\" NumberOfCells=\"2\"") != std::string::npos);
+    BOOST_TEST(content.find("0 1 2 3 4 5 ") != std::string::npos);
+    BOOST_TEST(content.find("3 6 ") != std::string::npos);
+  }
+  if (utils::MasterSlave::_masterMode) {
+    std::ifstream masterFile(filename + ".dt1_master.pvtu");
+    BOOST_TEST(masterFile.good());
+    std::string content((std::istreambuf_iterator<char>(masterFile)), std::istreambuf_iterator<char>());
+    BOOST_TEST(content.find("<Piece Source=\"" + filename + ".dt1_r0.vtu\"/>") != std::string::npos);
+    BOOST_TEST(content.find("<Piece Source=\"" + filename + ".dt1_r2.vtu\"/>") != std::string::npos);
+    BOOST_TEST(content.find("_r3.vtu") == std::string::npos);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ExportQuadMesh)
 {
   using namespace mesh;
@@ -0,0 +1,106 @@
+#include <sstream>
+#include "io/VTKXMLDataWriter.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Helpers.hpp"
+
+#ifndef PRECICE_NO_ZLIB
+#include <zlib.h>
+#endif
+
+BOOST_AUTO_TEST_SUITE(IOTests)
+
+BOOST_AUTO_TEST_SUITE(VTKXMLDataWriterTests, * precice::testing::OnMaster())
+
+using namespace precice;
+using io::VTKXMLDataWriter;
+
+BOOST_AUTO_TEST_CASE(ASCII)
+{
+  std::ostringstream out;
+  VTKXMLDataWriter   writer(out, VTKXMLDataWriter::ASCII, false);
+  std::vector<int>   values{1, 2, 3};
+  writer.writeDataArray("ids", 1, values.data(), values.size());
+  writer.writeAppendedData();
+  BOOST_TEST(writer.getFloatType() == "Float32");
+  BOOST_TEST(out.str().find("type=\"Int32\" Name=\"ids\" NumberOfComponents=\"1\" format=\"ascii\"") != std::string::npos);
+  BOOST_TEST(out.str().find("1 2 3 ") != std::string::npos);
+  BOOST_TEST(out.str().find("AppendedData") == std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Binary)
+{
+  if (utils::isMachineBigEndian()) {
+    return;
+  }
+  std::ostringstream out;
+  VTKXMLDataWriter   writer(out, VTKXMLDataWriter::BINARY, false);
+  std::vector<int>   values{1, 2};
+  writer.writeDataArray("ids", 1, values.data(), values.size());
+  BOOST_TEST(writer.getFloatType() == "Float64");
+  BOOST_TEST(writer.getFileAttributes().find("header_type=\"UInt64\"") != std::string::npos);
+  // header (8 bytes) and data are encoded separately
+  BOOST_TEST(out.str().find("format=\"binary\"") != std::string::npos);
+  BOOST_TEST(out.str().find("CAAAAAAAAAA=AQAAAAIAAAA=") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(Appended)
+{
+  std::ostringstream  out;
+  VTKXMLDataWriter    writer(out, VTKXMLDataWriter::APPENDED, false);
+  std::vector<double> first{1.0, 2.0, 3.0};
+  std::vector<int>    second{4};
+  writer.writeDataArray("first", 3, first.data(), first.size());
+  writer.writeDataArray("second", 1, second.data(), second.size());
+  writer.writeAppendedData();
+
+  const std::string content = out.str();
+  BOOST_TEST(content.find("Name=\"first\" NumberOfComponents=\"3\" format=\"appended\" offset=\"0\"") != std::string::npos);
+  BOOST_TEST(content.find("Name=\"second\" NumberOfComponents=\"1\" format=\"appended\" offset=\"32\"") != std::string::npos);
+
+  size_t start = content.find('_');
+  BOOST_TEST_REQUIRE(start != std::string::npos);
+  uint64_t size = 0;
+  content.copy(reinterpret_cast<char *>(&size), sizeof(size), start + 1);
+  BOOST_TEST(size == 3 * sizeof(double));
+  double value = 0.0;
+  content.copy(reinterpret_cast<char *>(&value), sizeof(value), start + 1 + sizeof(size) + 2 * sizeof(double));
+  BOOST_TEST(value == 3.0);
+  int last = 0;
+  content.copy(reinterpret_cast<char *>(&last), sizeof(last), start + 1 + 32 + sizeof(size));
+  BOOST_TEST(last == 4);
+}
+
+#ifndef PRECICE_NO_ZLIB
+BOOST_AUTO_TEST_CASE(AppendedCompressed)
+{
+  std::ostringstream  out;
+  VTKXMLDataWriter    writer(out, VTKXMLDataWriter::APPENDED, true);
+  // two compression blocks, the last one partial
+  std::vector<double> values(5000);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = i % 7;
+  }
+  writer.writeDataArray("values", 1, values.data(), values.size());
+  writer.writeAppendedData();
+  BOOST_TEST(writer.getFileAttributes().find("compressor=\"vtkZLibDataCompressor\"") != std::string::npos);
+
+  const std::string content = out.str();
+  size_t start = content.find('_') + 1;
+  uint64_t header[5];
+  content.copy(reinterpret_cast<char *>(header), sizeof(header), start);
+  BOOST_TEST(header[0] == 2);
+  BOOST_TEST(header[1] == 32768);
+  BOOST_TEST(header[2] == values.size() * sizeof(double) - 32768);
+
+  std::vector<double> decompressed(values.size());
+  const Bytef *       compressed = reinterpret_cast<const Bytef *>(content.data() + start + sizeof(header));
+  uLongf              firstSize  = header[1];
+  BOOST_TEST(uncompress(reinterpret_cast<Bytef *>(decompressed.data()), &firstSize, compressed, header[3]) == Z_OK);
+  uLongf lastSize = header[2];
+  BOOST_TEST(uncompress(reinterpret_cast<Bytef *>(decompressed.data()) + header[1], &lastSize, compressed + header[3], header[4]) == Z_OK);
+  BOOST_TEST(decompressed == values, boost::test_tools::per_element());
+}
+#endif // not PRECICE_NO_ZLIB
+
+BOOST_AUTO_TEST_SUITE_END() // VTKXMLDataWriterTests
+BOOST_AUTO_TEST_SUITE_END() // IOTests
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <boost/log/expressions.hpp>
-#include <boost/log/attributes/mutable_constant.hpp>
+#include <boost/log/utility/manipulators/add_value.hpp>
 
 #include <boost/preprocessor/variadic/to_seq.hpp>
 #include <boost/preprocessor/seq/for_each_i.hpp>
@@ -17,23 +17,26 @@
 #include "Tracer.hpp"
 
 
+/// Attaches the source location to a record. Only evaluated if the record passes the filters.
+#define LOG_LOCATION                                                    \
+  boost::log::add_value("Line", __LINE__)                               \
+  << boost::log::add_value("File", std::string(__FILE__))               \
+  << boost::log::add_value("Function", std::string(__func__))
+
 #define WARN(message) do {                                  \
-    LOG_LOCATION;                                                       \
     BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::warning)   \
-      << message;                                                       \
+      << LOG_LOCATION << message;                                       \
   } while (false)
 
 #define INFO(message)                                                   \
   if (not precice::utils::MasterSlave::_slaveMode) {                    \
-    LOG_LOCATION;                                                       \
     BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::info)      \
-      << message;                                                       \
+      << LOG_LOCATION << message;                                       \
   }
 
 #define ERROR(message) do {                                             \
-    LOG_LOCATION;                                                       \
     BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::error)     \
-      << message;                                                       \
+      << LOG_LOCATION << message;                                       \
     std::exit(-1);                                                        \
   } while (false)
 
@@ -50,9 +53,8 @@
 #else // NDEBUG
 
 #define DEBUG(message) do {                                             \
-    LOG_LOCATION;                                                       \
     BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::debug)     \
-      << message;                                                       \
+      << LOG_LOCATION << message;                                       \
   } while (false)
 
 /// Helper macro, used by TRACE
@@ -61,32 +63,13 @@
 
 // Do not put do {...} while (false) here, it will destroy the _tracer_ right after creation
 #define TRACE(...)                                                      \
-  LOG_LOCATION;                                                         \
   BOOST_LOG_FUNCTION();                                                 \
   precice::logging::Tracer _tracer_(_log, __func__, __FILE__,__LINE__); \
-  BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::trace) << "Entering " << __func__ \
+  BOOST_LOG_SEV(_log, boost::log::trivial::severity_level::trace)       \
+    << LOG_LOCATION << "Entering " << __func__                          \
   BOOST_PP_IF(BOOST_VMD_IS_EMPTY(__VA_ARGS__),                          \
               BOOST_PP_EMPTY(),                                         \
               BOOST_PP_SEQ_FOR_EACH_I(LOG_ARGUMENT,, BOOST_PP_VARIADIC_TO_SEQ(__VA_ARGS__)));
 
 
 #endif // ! NDEBUG
-
-
-#define LOG_LOCATION do {                                               \
-    boost::log::attribute_cast<boost::log::attributes::mutable_constant<int>>( \
-      boost::log::core::get()->get_global_attributes()["Line"]).set(__LINE__); \
-    boost::log::attribute_cast<boost::log::attributes::mutable_constant<std::string>>( \
-      boost::log::core::get()->get_global_attributes()["File"]).set(__FILE__); \
-    boost::log::attribute_cast<boost::log::attributes::mutable_constant<std::string>>( \
-      boost::log::core::get()->get_global_attributes()["Function"]).set(__func__); \
-  } while (false)
-
-  
-
-
-
-
-
-
-
@@ -2,11 +2,13 @@
 
 #include <string>
 #include <boost/log/trivial.hpp>
+#include <boost/log/sources/severity_logger.hpp>
 
 namespace precice {
 namespace logging {
 
-class Logger : public boost::log::sources::severity_logger<boost::log::trivial::severity_level>
+/// Thread-safe logger, such that background threads may log through the same logger as the main thread.
+class Logger : public boost::log::sources::severity_logger_mt<boost::log::trivial::severity_level>
 {
 public:
   explicit Logger(std::string module);
@@ -4,20 +4,22 @@
 namespace precice {
 namespace logging {
 
+/// Logs leaving a function at the end of the scope, created by TRACE.
 class Tracer
 {
 public:  
   
-  Tracer (Logger &log, std::string function, std::string file, long line);
+  Tracer (Logger &log, const char* function, const char* file, long line);
   ~Tracer();
 
 private:
 
-  Logger _log;
+  Logger & _log;
 
-  std::string _function;
+  /// Function, file and line of the TRACE, only converted if the record is emitted
+  const char* _function;
 
-  std::string _file;
+  const char* _file;
 
   long _line;
 
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <vector>
 #include "mesh/SharedPointer.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice
 {
@@ -70,17 +72,112 @@ public:
    */
   virtual void closeConnection() = 0;
 
-  /// Sends an array of double values from all slaves (different for each slave).
+  /**
+   * @brief Sends an array of double values from all slaves (different for each slave).
+   *
+   * @param[in] singlePrecision If true, the values may be transferred rounded to single
+   *            precision. Sender and receiver have to agree on this flag.
+   */
   virtual void send(
       double *itemsToSend,
       size_t  size,
-      int     valueDimension) = 0;
+      int     valueDimension,
+      bool    singlePrecision = false) = 0;
 
   /// All slaves receive an array of doubles (different for each slave).
   virtual void receive(
       double *itemsToReceive,
       size_t  size,
-      int     valueDimension) = 0;
+      int     valueDimension,
+      bool    singlePrecision = false) = 0;
+
+  /**
+   * @brief Starts sending an array of double values, completed by completeSend().
+   *
+   * Allows to overlap the transfer with other sends and receives on different
+   * communications. By default, the values are sent blocking.
+   */
+  virtual void startSend(
+      double *itemsToSend,
+      size_t  size,
+      int     valueDimension,
+      bool    singlePrecision = false)
+  {
+    send(itemsToSend, size, valueDimension, singlePrecision);
+  }
+
+  /// Blocks until the send started by startSend() is completed.
+  virtual void completeSend() {}
+
+  /**
+   * @brief Starts receiving an array of double values, completed by completeReceive().
+   *
+   * The values must not be accessed before completeReceive() returns. By default,
+   * the values are received blocking.
+   */
+  virtual void startReceive(
+      double *itemsToReceive,
+      size_t  size,
+      int     valueDimension,
+      bool    singlePrecision = false)
+  {
+    receive(itemsToReceive, size, valueDimension, singlePrecision);
+  }
+
+  /// Blocks until the receive started by startReceive() is completed.
+  virtual void completeReceive() {}
+
+  /**
+   * @brief Sends an array of double values, every receiving slave gets the header in addition.
+   *
+   * Allows to piggyback small control information, e.g. convergence flags, onto the data.
+   * Requires reachesAllRanks().
+   */
+  virtual void sendWithHeader(
+      double *                   itemsToSend,
+      size_t                     size,
+      int                        valueDimension,
+      bool                       singlePrecision,
+      const std::vector<double> &header)
+  {
+    assertion(false, "Sending a header is not supported by this distributed communication.");
+  }
+
+  /**
+   * @brief Starts sending an array of double values with a header, completed by completeSend().
+   *
+   * By default, the values are sent blocking.
+   */
+  virtual void startSendWithHeader(
+      double *                   itemsToSend,
+      size_t                     size,
+      int                        valueDimension,
+      bool                       singlePrecision,
+      const std::vector<double> &header)
+  {
+    sendWithHeader(itemsToSend, size, valueDimension, singlePrecision, header);
+  }
+
+  /// All slaves receive an array of doubles and the header, which has to be sized by the caller.
+  virtual void receiveWithHeader(
+      double *             itemsToReceive,
+      size_t               size,
+      int                  valueDimension,
+      bool                 singlePrecision,
+      std::vector<double> &header)
+  {
+    assertion(false, "Receiving a header is not supported by this distributed communication.");
+  }
+
+  /**
+   * @brief Returns true, if a header sent with the values reaches all slaves of the receiving participant.
+   *
+   * Both participants have to agree on the result.
+   */
+  virtual bool reachesAllRanks() const
+  {
+    return false;
+  }
 
 protected:
   /**
@@ -1,4 +1,5 @@
 #include "GatherScatterCommunication.hpp"
+#include <algorithm>
 #include "com/Communication.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/MasterSlave.hpp"
@@ -56,9 +57,20 @@ void GatherScatterCommunication::closeConnection()
 void GatherScatterCommunication::send(
     double *itemsToSend,
     size_t  size,
-    int     valueDimension)
+    int     valueDimension,
+    bool    singlePrecision)
 {
-  TRACE(size);
+  sendWithHeader(itemsToSend, size, valueDimension, singlePrecision, std::vector<double>());
+}
+
+void GatherScatterCommunication::sendWithHeader(
+    double *                   itemsToSend,
+    size_t                     size,
+    int                        valueDimension,
+    bool                       singlePrecision,
+    const std::vector<double> &header)
+{
+  TRACE(size, header.size());
   assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
   assertion(utils::MasterSlave::_communication.get() != nullptr);
   assertion(utils::MasterSlave::_communication->isConnected());
@@ -75,12 +87,14 @@ void GatherScatterCommunication::send(
     mesh::Mesh::VertexDistribution  &vertexDistribution = _mesh->getVertexDistribution();
     int                              globalSize         = _mesh->getGlobalNumberOfVertices() * valueDimension;
     DEBUG("Global Size = " << globalSize);
-    std::vector<double> globalItemsToSend(globalSize);
+    int                              offset             = header.size();
+    std::vector<double> globalItemsToSend(offset + globalSize);
+    std::copy(header.begin(), header.end(), globalItemsToSend.begin());
 
     // Master data
     for (size_t i = 0; i < vertexDistribution[0].size(); i++) {
       for (int j = 0; j < valueDimension; j++) {
-        globalItemsToSend[vertexDistribution[0][i] * valueDimension + j] += itemsToSend[i * valueDimension + j];
+        globalItemsToSend[offset + vertexDistribution[0][i] * valueDimension + j] += itemsToSend[i * valueDimension + j];
       }
     }
 
@@ -93,37 +107,56 @@ void GatherScatterCommunication::send(
         utils::MasterSlave::_communication->receive(valuesSlave, rankSlave);
         for (size_t i = 0; i < vertexDistribution[rankSlave].size(); i++) {
           for (int j = 0; j < valueDimension; j++) {
-            globalItemsToSend[vertexDistribution[rankSlave][i] * valueDimension + j] += valuesSlave[i * valueDimension + j];
+            globalItemsToSend[offset + vertexDistribution[rankSlave][i] * valueDimension + j] += valuesSlave[i * valueDimension + j];
           }
         }
       }
     }
 
-    // Send data to other master
-    _com->send(globalItemsToSend.data(), globalSize, 0);
+    // Send header and data to other master
+    _com->send(globalItemsToSend.data(), offset + globalSize, 0);
   } // Master
 }
 
 void GatherScatterCommunication::receive(
     double *itemsToReceive,
     size_t  size,
-    int     valueDimension)
+    int     valueDimension,
+    bool    singlePrecision)
+{
+  std::vector<double> header;
+  receiveWithHeader(itemsToReceive, size, valueDimension, singlePrecision, header);
+}
+
+void GatherScatterCommunication::receiveWithHeader(
+    double *             itemsToReceive,
+    size_t               size,
+    int                  valueDimension,
+    bool                 singlePrecision,
+    std::vector<double> &header)
 {
-  TRACE(size);
+  TRACE(size, header.size());
   assertion(utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode);
   assertion(utils::MasterSlave::_communication.get() != nullptr);
   assertion(utils::MasterSlave::_communication->isConnected());
   assertion(utils::MasterSlave::_size > 1);
   assertion(utils::MasterSlave::_rank != -1);
 
+  int                 offset = header.size();
   std::vector<double> globalItemsToReceive;
 
   // Receive data at master
   if (utils::MasterSlave::_masterMode) {
     int globalSize = _mesh->getGlobalNumberOfVertices() * valueDimension;
     DEBUG("Global Size = " << globalSize);
-    globalItemsToReceive.resize(globalSize);
-    _com->receive(globalItemsToReceive.data(), globalSize, 0);
+    globalItemsToReceive.resize(offset + globalSize);
+    _com->receive(globalItemsToReceive.data(), offset + globalSize, 0);
+    std::copy(globalItemsToReceive.begin(), globalItemsToReceive.begin() + offset, header.begin());
+  }
+
+  // Only the master received the header
+  if (offset > 0) {
+    utils::MasterSlave::broadcast(header.data(), offset);
   }
 
   // Scatter data
@@ -140,7 +173,7 @@ void GatherScatterCommunication::receive(
     // Master data
     for (size_t i = 0; i < vertexDistribution[0].size(); i++) {
       for (int j = 0; j < valueDimension; j++) {
-        itemsToReceive[i * valueDimension + j] = globalItemsToReceive[vertexDistribution[0][i] * valueDimension + j];
+        itemsToReceive[i * valueDimension + j] = globalItemsToReceive[offset + vertexDistribution[0][i] * valueDimension + j];
       }
     }
 
@@ -152,7 +185,7 @@ void GatherScatterCommunication::receive(
         std::vector<double> valuesSlave(slaveSize);
         for (size_t i = 0; i < vertexDistribution[rankSlave].size(); i++) {
           for (int j = 0; j < valueDimension; j++) {
-            valuesSlave[i * valueDimension + j] = globalItemsToReceive[vertexDistribution[rankSlave][i] * valueDimension + j];
+            valuesSlave[i * valueDimension + j] = globalItemsToReceive[offset + vertexDistribution[rankSlave][i] * valueDimension + j];
           }
         }
         utils::MasterSlave::_communication->send(valuesSlave, rankSlave);
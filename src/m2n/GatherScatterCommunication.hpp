@@ -62,17 +62,51 @@ public:
    */
   virtual void closeConnection();
 
-  /// Sends an array of double values from all slaves (different for each slave).
+  /**
+   * @brief Sends an array of double values from all slaves (different for each slave).
+   *
+   * The values are always transferred in double precision, singlePrecision is ignored.
+   */
   virtual void send(
       double *itemsToSend,
       size_t  size,
-      int     valueDimension);
+      int     valueDimension,
+      bool    singlePrecision = false);
 
   /// All slaves receive an array of doubles (different for each slave).
   virtual void receive(
       double *itemsToReceive,
       size_t  size,
-      int     valueDimension);
+      int     valueDimension,
+      bool    singlePrecision = false);
+
+  /**
+   * @brief The header is prepended to the gathered values, which are sent by the master.
+   *
+   * As all values pass the master anyway, the header only saves a separate message between the
+   * masters. Unlike for point-to-point communication, the receiving master still broadcasts it
+   * to its slaves, see receiveWithHeader().
+   */
+  virtual void sendWithHeader(
+      double *                   itemsToSend,
+      size_t                     size,
+      int                        valueDimension,
+      bool                       singlePrecision,
+      const std::vector<double> &header);
+
+  /// The master receives the header with the global values and broadcasts it to all slaves.
+  virtual void receiveWithHeader(
+      double *             itemsToReceive,
+      size_t               size,
+      int                  valueDimension,
+      bool                 singlePrecision,
+      std::vector<double> &header);
+
+  /// Every message passes the master, which forwards the header to all slaves.
+  virtual bool reachesAllRanks() const
+  {
+    return true;
+  }
 
 private:
   logging::Logger _log{"m2n::GatherScatterCommunication"};
@@ -1,7 +1,9 @@
 #include "M2N.hpp"
+#include <algorithm>
 #include "DistributedComFactory.hpp"
 #include "DistributedCommunication.hpp"
 #include "com/Communication.hpp"
+#include "com/Request.hpp"
 #include "mesh/Mesh.hpp"
 #include "utils/EventTimings.hpp"
 #include "utils/MasterSlave.hpp"
@@ -136,7 +138,8 @@ void M2N::send(
     double *itemsToSend,
     int     size,
     int     meshID,
-    int     valueDimension)
+    int     valueDimension,
+    bool    singlePrecision)
 {
   if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
     assertion(_areSlavesConnected);
@@ -151,14 +154,131 @@ void M2N::send(
         _masterCom->send(ack, 0);
       }
     }
-    Event e("m2n.sendData", precice::syncMode);
-    _distComs[meshID]->send(itemsToSend, size, valueDimension);
+    static const utils::EventName sendDataEventName("m2n.sendData");
+    Event e(sendDataEventName, precice::syncMode);
+    _distComs[meshID]->send(itemsToSend, size, valueDimension, singlePrecision);
   } else { //coupling mode
     assertion(_isMasterConnected);
     _masterCom->send(itemsToSend, size, 0);
   }
 }
 
+bool M2N::canSendHeader(int meshID)
+{
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_distComs.find(meshID) != _distComs.end());
+    return _distComs[meshID]->reachesAllRanks();
+  }
+  return true;
+}
+
+void M2N::send(
+    double *                   itemsToSend,
+    int                        size,
+    int                        meshID,
+    int                        valueDimension,
+    bool                       singlePrecision,
+    const std::vector<double> &header)
+{
+  assertion(canSendHeader(meshID));
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_areSlavesConnected);
+    assertion(_distComs[meshID].get() != nullptr);
+
+    if (precice::syncMode) {
+      if (not utils::MasterSlave::_slaveMode) {
+        bool ack = true;
+        _masterCom->send(ack, 0);
+        _masterCom->receive(ack, 0);
+        _masterCom->send(ack, 0);
+      }
+    }
+    static const utils::EventName sendDataEventName("m2n.sendData");
+    Event e(sendDataEventName, precice::syncMode);
+    _distComs[meshID]->sendWithHeader(itemsToSend, size, valueDimension, singlePrecision, header);
+  } else { //coupling mode
+    assertion(_isMasterConnected);
+    std::vector<double> message(header);
+    message.insert(message.end(), itemsToSend, itemsToSend + size);
+    _masterCom->send(message.data(), message.size(), 0);
+  }
+}
+
+void M2N::startSend(
+    double *itemsToSend,
+    int     size,
+    int     meshID,
+    int     valueDimension,
+    bool    singlePrecision)
+{
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_areSlavesConnected);
+    assertion(_distComs.find(meshID) != _distComs.end());
+    assertion(_distComs[meshID].get() != nullptr);
+
+    if (precice::syncMode) {
+      if (not utils::MasterSlave::_slaveMode) {
+        bool ack = true;
+        _masterCom->send(ack, 0);
+        _masterCom->receive(ack, 0);
+        _masterCom->send(ack, 0);
+      }
+    }
+    _distComs[meshID]->startSend(itemsToSend, size, valueDimension, singlePrecision);
+  } else { //coupling mode
+    assertion(_isMasterConnected);
+    assertion(_sendRequests.count(meshID) == 0, meshID);
+    _sendRequests[meshID] = _masterCom->aSend(itemsToSend, size, 0);
+  }
+}
+
+void M2N::startSend(
+    double *                   itemsToSend,
+    int                        size,
+    int                        meshID,
+    int                        valueDimension,
+    bool                       singlePrecision,
+    const std::vector<double> &header)
+{
+  assertion(canSendHeader(meshID));
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_areSlavesConnected);
+    assertion(_distComs[meshID].get() != nullptr);
+
+    if (precice::syncMode) {
+      if (not utils::MasterSlave::_slaveMode) {
+        bool ack = true;
+        _masterCom->send(ack, 0);
+        _masterCom->receive(ack, 0);
+        _masterCom->send(ack, 0);
+      }
+    }
+    _distComs[meshID]->startSendWithHeader(itemsToSend, size, valueDimension, singlePrecision, header);
+  } else { //coupling mode
+    assertion(_isMasterConnected);
+    assertion(_sendRequests.count(meshID) == 0, meshID);
+    std::vector<double> &message = _sendBuffers[meshID];
+    message = header;
+    message.insert(message.end(), itemsToSend, itemsToSend + size);
+    _sendRequests[meshID] = _masterCom->aSend(message.data(), message.size(), 0);
+  }
+}
+
+void M2N::completeSend(int meshID)
+{
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_distComs.find(meshID) != _distComs.end());
+    static const utils::EventName sendDataEventName("m2n.sendData");
+    Event e(sendDataEventName, precice::syncMode);
+    _distComs[meshID]->completeSend();
+  } else { //coupling mode
+    assertion(_sendRequests.count(meshID) == 1, meshID);
+    _sendRequests[meshID]->wait();
+    _sendRequests.erase(meshID);
+    _sendBuffers.erase(meshID);
+  }
+}
+
 void M2N::send(bool itemToSend)
 {
   TRACE(utils::MasterSlave::_rank);
@@ -175,10 +295,27 @@ void M2N::send(double itemToSend)
   }
 }
 
+void M2N::startBatch()
+{
+  TRACE(utils::MasterSlave::_rank);
+  if (not utils::MasterSlave::_slaveMode) {
+    _masterCom->startBatch();
+  }
+}
+
+void M2N::flush()
+{
+  TRACE(utils::MasterSlave::_rank);
+  if (not utils::MasterSlave::_slaveMode) {
+    _masterCom->flush();
+  }
+}
+
 void M2N::receive(double *itemsToReceive,
                   int     size,
                   int     meshID,
-                  int     valueDimension)
+                  int     valueDimension,
+                  bool    singlePrecision)
 {
   if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
     assertion(_areSlavesConnected);
@@ -194,14 +331,90 @@ void M2N::receive(double *itemsToReceive,
         _masterCom->receive(ack, 0);
       }
     }
-    Event e("m2n.receiveData", precice::syncMode);
-    _distComs[meshID]->receive(itemsToReceive, size, valueDimension);
+    static const utils::EventName receiveDataEventName("m2n.receiveData");
+    Event e(receiveDataEventName, precice::syncMode);
+    _distComs[meshID]->receive(itemsToReceive, size, valueDimension, singlePrecision);
   } else { //coupling mode
     assertion(_isMasterConnected);
     _masterCom->receive(itemsToReceive, size, 0);
   }
 }
 
+void M2N::receive(double *             itemsToReceive,
+                  int                  size,
+                  int                  meshID,
+                  int                  valueDimension,
+                  bool                 singlePrecision,
+                  std::vector<double> &header)
+{
+  assertion(canSendHeader(meshID));
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_areSlavesConnected);
+    assertion(_distComs[meshID].get() != nullptr);
+
+    if (precice::syncMode) {
+      if (not utils::MasterSlave::_slaveMode) {
+        bool ack;
+
+        _masterCom->receive(ack, 0);
+        _masterCom->send(ack, 0);
+        _masterCom->receive(ack, 0);
+      }
+    }
+    static const utils::EventName receiveDataEventName("m2n.receiveData");
+    Event e(receiveDataEventName, precice::syncMode);
+    _distComs[meshID]->receiveWithHeader(itemsToReceive, size, valueDimension, singlePrecision, header);
+  } else { //coupling mode
+    assertion(_isMasterConnected);
+    std::vector<double> message(header.size() + size);
+    _masterCom->receive(message.data(), message.size(), 0);
+    std::copy(message.begin(), message.begin() + header.size(), header.begin());
+    std::copy(message.begin() + header.size(), message.end(), itemsToReceive);
+  }
+}
+
+void M2N::startReceive(double *itemsToReceive,
+                       int     size,
+                       int     meshID,
+                       int     valueDimension,
+                       bool    singlePrecision)
+{
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_areSlavesConnected);
+    assertion(_distComs.find(meshID) != _distComs.end());
+    assertion(_distComs[meshID].get() != nullptr);
+
+    if (precice::syncMode) {
+      if (not utils::MasterSlave::_slaveMode) {
+        bool ack;
+
+        _masterCom->receive(ack, 0);
+        _masterCom->send(ack, 0);
+        _masterCom->receive(ack, 0);
+      }
+    }
+    _distComs[meshID]->startReceive(itemsToReceive, size, valueDimension, singlePrecision);
+  } else { //coupling mode
+    assertion(_isMasterConnected);
+    assertion(_receiveRequests.count(meshID) == 0, meshID);
+    _receiveRequests[meshID] = _masterCom->aReceive(itemsToReceive, size, 0);
+  }
+}
+
+void M2N::completeReceive(int meshID)
+{
+  if (utils::MasterSlave::_slaveMode || utils::MasterSlave::_masterMode) {
+    assertion(_distComs.find(meshID) != _distComs.end());
+    static const utils::EventName receiveDataEventName("m2n.receiveData");
+    Event e(receiveDataEventName, precice::syncMode);
+    _distComs[meshID]->completeReceive();
+  } else { //coupling mode
+    assertion(_receiveRequests.count(meshID) == 1, meshID);
+    _receiveRequests[meshID]->wait();
+    _receiveRequests.erase(meshID);
+  }
+}
+
 void M2N::receive(bool &itemToReceive)
 {
   TRACE(utils::MasterSlave::_rank);
@@ -5,6 +5,7 @@
 #include "logging/Logger.hpp"
 #include "mesh/SharedPointer.hpp"
 #include <map>
+#include <vector>
 
 namespace precice
 {
@@ -77,11 +78,17 @@ public:
   /// Creates a new distributes communication for that mesh, stores the pointer in _distComs
   void createDistributedCommunication(mesh::PtrMesh mesh);
 
-  /// Sends an array of double values from all slaves (different for each slave).
+  /**
+   * @brief Sends an array of double values from all slaves (different for each slave).
+   *
+   * If singlePrecision is true, the distributed communication may transfer the values
+   * rounded to single precision. Without master-slave, values are always sent as doubles.
+   */
   void send(double *itemsToSend,
             int     size,
             int     meshID,
-            int     valueDimension);
+            int     valueDimension,
+            bool    singlePrecision = false);
 
   /**
    * @brief The master sends a bool to the other master, for performance reasons, we
@@ -99,14 +106,87 @@ public:
   void receive(double *itemsToReceive,
                int     size,
                int     meshID,
-               int     valueDimension);
+               int     valueDimension,
+               bool    singlePrecision = false);
 
   /// All slaves receive a bool (the same for each slave).
   void receive(bool &itemToReceive);
 
+  /**
+   * @brief Returns true, if a header sent with the data of the given mesh reaches all slaves.
+   *
+   * Both participants get the same answer, as long as both use the same mesh.
+   */
+  bool canSendHeader(int meshID);
+
+  /**
+   * @brief Sends an array of double values from all slaves, each message starts with the header.
+   *
+   * The header is the same for all slaves. It replaces a separate send of small control values
+   * from master to master. Requires canSendHeader().
+   */
+  void send(double *                   itemsToSend,
+            int                        size,
+            int                        meshID,
+            int                        valueDimension,
+            bool                       singlePrecision,
+            const std::vector<double> &header);
+
+  /// All slaves receive an array of doubles and the header sent with it, which has to be sized by the caller.
+  void receive(double *             itemsToReceive,
+               int                  size,
+               int                  meshID,
+               int                  valueDimension,
+               bool                 singlePrecision,
+               std::vector<double> &header);
+
   /// All slaves receive a double (the same for each slave).
   void receive(double &itemToReceive);
 
+  /**
+   * @brief Starts sending an array of double values from all slaves, completed by completeSend().
+   *
+   * Allows to overlap the transfers to several M2N instances. Only one send per mesh may be
+   * pending. Without master-slave, the values are sent asynchronously by the master communication.
+   */
+  void startSend(double *itemsToSend,
+                 int     size,
+                 int     meshID,
+                 int     valueDimension,
+                 bool    singlePrecision = false);
+
+  /// Starts sending an array of double values with the header, completed by completeSend(). Requires canSendHeader().
+  void startSend(double *                   itemsToSend,
+                 int                        size,
+                 int                        meshID,
+                 int                        valueDimension,
+                 bool                       singlePrecision,
+                 const std::vector<double> &header);
+
+  /// Blocks until the send started by startSend() for the given mesh is completed.
+  void completeSend(int meshID);
+
+  /**
+   * @brief Starts receiving an array of double values on all slaves, completed by completeReceive().
+   *
+   * The values must not be accessed before completeReceive() returns. Without master-slave,
+   * the values are received asynchronously by the master communication.
+   */
+  void startReceive(double *itemsToReceive,
+                    int     size,
+                    int     meshID,
+                    int     valueDimension,
+                    bool    singlePrecision = false);
+
+  /// Blocks until the receive started by startReceive() for the given mesh is completed.
+  void completeReceive(int meshID);
+
+  /// The master starts coalescing the following sends of bools and doubles to the other master.
+  void startBatch();
+
+  /// The master writes all coalesced sends to the other master.
+  void flush();
+
 private:
   logging::Logger _log{"m2n::M2N"};
 
@@ -115,6 +195,15 @@ private:
 
   com::PtrCommunication _masterCom;
 
+  /// mesh::getID() -> Pending send of the master communication, started by startSend()
+  std::map<int, com::PtrRequest> _sendRequests;
+
+  /// mesh::getID() -> Header and values of a pending send of the master communication
+  std::map<int, std::vector<double>> _sendBuffers;
+
+  /// mesh::getID() -> Pending receive of the master communication, started by startReceive()
+  std::map<int, com::PtrRequest> _receiveRequests;
+
   DistributedComFactory::SharedPointer _distrFactory;
 
   bool _isMasterConnected = false;
@@ -1,6 +1,9 @@
 #include "PointToPointCommunication.hpp"
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include <thread>
+#include <unordered_set>
 #include "com/Communication.hpp"
 #include "com/CommunicationFactory.hpp"
 #include "mesh/Mesh.hpp"
@@ -17,6 +20,14 @@ bool extern syncMode;
 namespace m2n
 {
 
+static_assert(sizeof(double) == 2 * sizeof(float), "Packing of single precision values requires 8 byte doubles.");
+
+/// Number of doubles needed to hold the given number of packed float values.
+size_t packedSize(size_t floatCount)
+{
+  return (floatCount + 1) / 2;
+}
+
 void send(mesh::Mesh::VertexDistribution const &m,
           int                                    rankReceiver,
           com::PtrCommunication                  communication)
@@ -254,6 +265,37 @@ std::map<int, std::vector<int>> buildCommunicationMap(
   return communicationMap;
 }
 
+/**
+ * @brief Returns true, if every rank of this participant shares at least one
+ *        vertex with the other participant, i.e., has a communication partner.
+ *
+ * Ranks without any vertex do not show up in the vertex distribution, they are
+ * detected by the master via hasAllRanks().
+ */
+bool everyRankHasPartners(
+    mesh::Mesh::VertexDistribution const &thisVertexDistribution,
+    mesh::Mesh::VertexDistribution const &otherVertexDistribution)
+{
+  std::unordered_set<int> otherIndices;
+  for (const auto &other : otherVertexDistribution) {
+    otherIndices.insert(other.second.begin(), other.second.end());
+  }
+  for (const auto &rank : thisVertexDistribution) {
+    bool hasPartner = std::any_of(rank.second.begin(), rank.second.end(),
+                                  [&](int index) { return otherIndices.count(index) > 0; });
+    if (not hasPartner) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// Returns true, if all ranks of the participant own vertices.
+bool hasAllRanks(mesh::Mesh::VertexDistribution const &vertexDistribution)
+{
+  return static_cast<int>(vertexDistribution.size()) == utils::MasterSlave::_size;
+}
+
 PointToPointCommunication::PointToPointCommunication(
     com::PtrCommunicationFactory communicationFactory,
     mesh::PtrMesh                mesh)
@@ -284,6 +326,7 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
 
   mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
   mesh::Mesh::VertexDistribution  requesterVertexDistribution;
+  bool                            requesterHasAllRanks = false;
 
   if (utils::MasterSlave::_masterMode) {
     Event e0("m2n.exchangeVertexDistribution");
@@ -301,6 +344,8 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
     // Exchange vertex distributions.
     m2n::send(vertexDistribution, 0, c);
     m2n::receive(requesterVertexDistribution, 0, c);
+    c->send(hasAllRanks(vertexDistribution), 0);
+    c->receive(requesterHasAllRanks, 0);
   } else {
     assertion(utils::MasterSlave::_slaveMode);
   }
@@ -308,6 +353,7 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
   m2n::broadcast(vertexDistribution);
   m2n::broadcast(requesterVertexDistribution);
+  utils::MasterSlave::broadcast(requesterHasAllRanks);
   e1.stop();
 
   // Local (for process rank in the current participant) communication map that
@@ -330,6 +376,9 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   Event e2("m2n.buildCommunicationMap", precice::syncMode);
   std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
     vertexDistribution, requesterVertexDistribution);
+  _reachesAllRanks = hasAllRanks(vertexDistribution) && requesterHasAllRanks &&
+                     everyRankHasPartners(vertexDistribution, requesterVertexDistribution) &&
+                     everyRankHasPartners(requesterVertexDistribution, vertexDistribution);
   e2.stop();
 
 // Print `communicationMap'.
@@ -416,6 +465,7 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
 
   mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
   mesh::Mesh::VertexDistribution  acceptorVertexDistribution;
+  bool                            acceptorHasAllRanks = false;
 
   if (utils::MasterSlave::_masterMode) {
     Event e0("m2n.exchangeVertexDistribution");
@@ -432,6 +482,8 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
     // Exchange vertex distributions.
     m2n::receive(acceptorVertexDistribution, 0, c);
     m2n::send(vertexDistribution, 0, c);
+    c->receive(acceptorHasAllRanks, 0);
+    c->send(hasAllRanks(vertexDistribution), 0);
   } else {
     assertion(utils::MasterSlave::_slaveMode);
   }
@@ -439,6 +491,7 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
   m2n::broadcast(vertexDistribution);
   m2n::broadcast(acceptorVertexDistribution);
+  utils::MasterSlave::broadcast(acceptorHasAllRanks);
   e1.stop();
 
   // Local (for process rank in the current participant) communication map that
@@ -461,6 +514,9 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   Event e2("m2n.buildCommunicationMap", precice::syncMode);
   std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
     vertexDistribution, acceptorVertexDistribution);
+  _reachesAllRanks = hasAllRanks(vertexDistribution) && acceptorHasAllRanks &&
+                     everyRankHasPartners(vertexDistribution, acceptorVertexDistribution) &&
+                     everyRankHasPartners(acceptorVertexDistribution, vertexDistribution);
   e2.stop();
 
 // Print `communicationMap'.
@@ -544,24 +600,10 @@ void PointToPointCommunication::closeConnection()
 
 void PointToPointCommunication::send(double *itemsToSend,
                                      size_t  size,
-                                     int     valueDimension)
+                                     int     valueDimension,
+                                     bool    singlePrecision)
 {
-
-  if (_mappings.empty()) {
-    return;
-  }
-
-  for (auto &mapping : _mappings) {
-    auto buffer = std::make_shared<std::vector<double>>();
-    buffer->reserve(mapping.indices.size() * valueDimension);
-    for (auto index : mapping.indices) {
-      for (int d = 0; d < valueDimension; ++d) {
-        buffer->push_back(itemsToSend[index * valueDimension + d]);
-      }
-    }
-    auto request = mapping.communication->aSend(*buffer, mapping.remoteRank);
-    bufferedRequests.emplace_back(request, buffer);
-  }
+  startSend(itemsToSend, size, valueDimension, singlePrecision);
 
   /* Disable asynchronous sending
    * For SocketCommunuication, an async send request is given to asio::async_write and from that
@@ -575,35 +617,172 @@ void PointToPointCommunication::send(double *itemsToSend,
    * https://lists.boost.org/Archives/boost/2018/10/243612.php
    * https://www.boost.org/doc/libs/1_68_0/doc/html/boost_asio/reference/async_write/overload1.html
    */
-  checkBufferedRequests(true);
+  completeSend();
 }
 
 void PointToPointCommunication::receive(double *itemsToReceive,
                                         size_t  size,
-                                        int     valueDimension)
+                                        int     valueDimension,
+                                        bool    singlePrecision)
+{
+  startReceive(itemsToReceive, size, valueDimension, singlePrecision);
+  completeReceive();
+}
+
+void PointToPointCommunication::sendWithHeader(double *                   itemsToSend,
+                                               size_t                     size,
+                                               int                        valueDimension,
+                                               bool                       singlePrecision,
+                                               const std::vector<double> &header)
+{
+  assertion(_reachesAllRanks);
+  postSends(itemsToSend, valueDimension, singlePrecision, header);
+  completeSend();
+}
+
+void PointToPointCommunication::startSendWithHeader(double *                   itemsToSend,
+                                                    size_t                     size,
+                                                    int                        valueDimension,
+                                                    bool                       singlePrecision,
+                                                    const std::vector<double> &header)
+{
+  assertion(_reachesAllRanks);
+  postSends(itemsToSend, valueDimension, singlePrecision, header);
+}
+
+void PointToPointCommunication::receiveWithHeader(double *             itemsToReceive,
+                                                  size_t               size,
+                                                  int                  valueDimension,
+                                                  bool                 singlePrecision,
+                                                  std::vector<double> &header)
+{
+  assertion(_reachesAllRanks);
+  postReceives(itemsToReceive, size, valueDimension, singlePrecision, &header);
+  completeReceive();
+}
+
+bool PointToPointCommunication::reachesAllRanks() const
+{
+  return _reachesAllRanks;
+}
+
+void PointToPointCommunication::startSend(double *itemsToSend,
+                                          size_t  size,
+                                          int     valueDimension,
+                                          bool    singlePrecision)
+{
+  postSends(itemsToSend, valueDimension, singlePrecision, std::vector<double>());
+}
+
+void PointToPointCommunication::postSends(double *                   itemsToSend,
+                                          int                        valueDimension,
+                                          bool                       singlePrecision,
+                                          const std::vector<double> &header)
 {
   if (_mappings.empty()) {
     return;
   }
 
+  for (auto &mapping : _mappings) {
+    auto buffer = std::make_shared<std::vector<double>>(header);
+    if (singlePrecision) {
+      std::vector<float> reduced;
+      reduced.reserve(mapping.indices.size() * valueDimension);
+      for (auto index : mapping.indices) {
+        for (int d = 0; d < valueDimension; ++d) {
+          reduced.push_back(static_cast<float>(itemsToSend[index * valueDimension + d]));
+        }
+      }
+      buffer->resize(header.size() + packedSize(reduced.size()));
+      std::memcpy(buffer->data() + header.size(), reduced.data(), reduced.size() * sizeof(float));
+    } else {
+      buffer->reserve(header.size() + mapping.indices.size() * valueDimension);
+      for (auto index : mapping.indices) {
+        for (int d = 0; d < valueDimension; ++d) {
+          buffer->push_back(itemsToSend[index * valueDimension + d]);
+        }
+      }
+    }
+    auto request = mapping.communication->aSend(*buffer, mapping.remoteRank);
+    bufferedRequests.emplace_back(request, buffer);
+  }
+}
+
+void PointToPointCommunication::completeSend()
+{
+  checkBufferedRequests(true);
+}
+
+void PointToPointCommunication::startReceive(double *itemsToReceive,
+                                             size_t  size,
+                                             int     valueDimension,
+                                             bool    singlePrecision)
+{
+  postReceives(itemsToReceive, size, valueDimension, singlePrecision, nullptr);
+}
+
+void PointToPointCommunication::postReceives(double *             itemsToReceive,
+                                             size_t               size,
+                                             int                  valueDimension,
+                                             bool                 singlePrecision,
+                                             std::vector<double> *header)
+{
+  if (_mappings.empty()) {
+    return;
+  }
+  assertion(_pendingReceive == nullptr);
+
   std::fill(itemsToReceive, itemsToReceive + size, 0);
 
+  size_t headerSize = header == nullptr ? 0 : header->size();
   for (auto &mapping : _mappings) {
-    mapping.recvBuffer.resize(mapping.indices.size() * valueDimension);
+    size_t count = mapping.indices.size() * valueDimension;
+    mapping.recvBuffer.resize(headerSize + (singlePrecision ? packedSize(count) : count));
     mapping.request = mapping.communication->aReceive(mapping.recvBuffer, mapping.remoteRank);
   }
 
+  _pendingReceive                = itemsToReceive;
+  _pendingReceiveDimension       = valueDimension;
+  _pendingReceiveSinglePrecision = singlePrecision;
+  _pendingReceiveHeader          = header;
+}
+
+void PointToPointCommunication::completeReceive()
+{
+  if (_pendingReceive == nullptr) {
+    return;
+  }
+
+  const int  valueDimension  = _pendingReceiveDimension;
+  const bool singlePrecision = _pendingReceiveSinglePrecision;
+  const int  headerSize      = _pendingReceiveHeader == nullptr ? 0 : _pendingReceiveHeader->size();
+
+  std::vector<float> reduced;
   for (auto &mapping : _mappings) {
     mapping.request->wait();
+    const double *values = mapping.recvBuffer.data() + headerSize;
+
+    if (singlePrecision) {
+      reduced.resize(mapping.indices.size() * valueDimension);
+      std::memcpy(reduced.data(), values, reduced.size() * sizeof(float));
+    }
 
     int i = 0;
     for (auto index : mapping.indices) {
       for (int d = 0; d < valueDimension; ++d) {
-        itemsToReceive[index * valueDimension + d] += mapping.recvBuffer[i * valueDimension + d];
+        _pendingReceive[index * valueDimension + d] += singlePrecision ? reduced[i * valueDimension + d]
+                                                                       : values[i * valueDimension + d];
       }
       i++;
     }
   }
+  // all remote ranks send the same header
+  if (_pendingReceiveHeader != nullptr) {
+    std::copy(_mappings.front().recvBuffer.begin(), _mappings.front().recvBuffer.begin() + headerSize,
+              _pendingReceiveHeader->begin());
+  }
+  _pendingReceive       = nullptr;
+  _pendingReceiveHeader = nullptr;
 }
 
 void PointToPointCommunication::checkBufferedRequests(bool blocking)
@@ -61,8 +61,14 @@ public:
   /**
    * @brief Sends a subset of local double values corresponding to local indices
    *        deduced from the current and remote vertex distributions.
+   *
+   * If singlePrecision is set, the values are rounded to float and two of them are
+   * packed into each double of the send buffer, which halves the transferred volume.
    */
-  virtual void send(double *itemsToSend, size_t size, int valueDimension = 1);
+  virtual void send(double *itemsToSend,
+                    size_t  size,
+                    int     valueDimension  = 1,
+                    bool    singlePrecision = false);
 
   /**
    * @brief Receives a subset of local double values corresponding to local
@@ -70,7 +76,50 @@ public:
    */
   virtual void receive(double *itemsToReceive,
                        size_t  size,
-                       int     valueDimension = 1);
+                       int     valueDimension  = 1,
+                       bool    singlePrecision = false);
+
+  /// Posts asynchronous sends to all remote ranks, completed by completeSend().
+  virtual void startSend(double *itemsToSend,
+                         size_t  size,
+                         int     valueDimension  = 1,
+                         bool    singlePrecision = false);
+
+  /// Waits for all sends posted by startSend().
+  virtual void completeSend();
+
+  /// Posts asynchronous receives from all remote ranks, completed by completeReceive().
+  virtual void startReceive(double *itemsToReceive,
+                            size_t  size,
+                            int     valueDimension  = 1,
+                            bool    singlePrecision = false);
+
+  /// Waits for all receives posted by startReceive() and accumulates the values.
+  virtual void completeReceive();
+
+  /// Sends the values to all remote ranks, every message starts with the header.
+  virtual void sendWithHeader(double *                   itemsToSend,
+                              size_t                     size,
+                              int                        valueDimension,
+                              bool                       singlePrecision,
+                              const std::vector<double> &header);
+
+  /// Receives the values from all remote ranks and the header of their messages.
+  /// Posts asynchronous sends with the header to all remote ranks, completed by completeSend().
+  virtual void startSendWithHeader(double *                   itemsToSend,
+                                   size_t                     size,
+                                   int                        valueDimension,
+                                   bool                       singlePrecision,
+                                   const std::vector<double> &header);
+
+  virtual void receiveWithHeader(double *             itemsToReceive,
+                                 size_t               size,
+                                 int                  valueDimension,
+                                 bool                 singlePrecision,
+                                 std::vector<double> &header);
+
+  /// Returns true, if every rank of both participants has at least one remote rank to communicate with.
+  virtual bool reachesAllRanks() const;
 
 private:
   logging::Logger _log{"m2n::PointToPointCommunication"};
@@ -80,6 +129,19 @@ private:
    * @param[in] blocking False means that the function returns, even when there are requests left.
    */  
   void checkBufferedRequests(bool blocking);
+
+  /// Posts asynchronous sends of the values to all remote ranks, preceded by the header.
+  void postSends(double *                   itemsToSend,
+                 int                        valueDimension,
+                 bool                       singlePrecision,
+                 const std::vector<double> &header);
+
+  /// Posts asynchronous receives from all remote ranks, the header is skipped if nullptr.
+  void postReceives(double *             itemsToReceive,
+                    size_t               size,
+                    int                  valueDimension,
+                    bool                 singlePrecision,
+                    std::vector<double> *header);
   
   com::PtrCommunicationFactory _communicationFactory;
 
@@ -108,9 +170,22 @@ private:
 
   bool _isConnected = false;
 
+  /// True, if every rank of both participants has at least one remote rank to communicate with.
+  bool _reachesAllRanks = false;
+
   std::list<std::pair<std::shared_ptr<com::Request>,
                       std::shared_ptr<std::vector<double>>>> bufferedRequests;
 
+  /// Target of the receive started by startReceive(), nullptr if none is pending
+  double *_pendingReceive = nullptr;
+
+  int _pendingReceiveDimension = 1;
+
+  bool _pendingReceiveSinglePrecision = false;
+
+  /// Target of the header of the pending receive, nullptr if the messages have no header
+  std::vector<double> *_pendingReceiveHeader = nullptr;
+
 };
 } // namespace m2n
 } // namespace precice
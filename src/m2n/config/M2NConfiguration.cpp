@@ -3,6 +3,8 @@
 #include "com/MPIDirectCommunication.hpp"
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/MPISinglePortsCommunicationFactory.hpp"
+#include "com/SharedMemoryCommunication.hpp"
+#include "com/SharedMemoryCommunicationFactory.hpp"
 #include "com/SocketCommunicationFactory.hpp"
 #include "m2n/DistributedComFactory.hpp"
 #include "m2n/GatherScatterComFactory.hpp"
@@ -47,6 +49,34 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     attrNetwork.setDefaultValue("lo");
     tag.addAttribute(attrNetwork);
 
+    XMLAttribute<int> attrBufferSize(ATTR_BUFFER_SIZE);
+    doc = "Size in bytes of the send and receive buffers of the sockets. ";
+    doc += "The default is \"0\", what means that the default of the OS is used.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(0);
+    tag.addAttribute(attrBufferSize);
+
+    XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
+    doc = "Directory where connection information is exchanged. By default, the ";
+    doc += "directory of startup is chosen, and both solvers have to be started ";
+    doc += "in the same directory.";
+    attrExchangeDirectory.setDocumentation(doc);
+    attrExchangeDirectory.setDefaultValue("");
+    tag.addAttribute(attrExchangeDirectory);
+    tags.push_back(tag);
+  }
+  {
+    XMLTag tag(*this, "shared-memory", occ, TAG);
+    doc = "Communication via POSIX shared memory. Both participants have to run on the same node.";
+    tag.setDocumentation(doc);
+
+    XMLAttribute<int> attrBufferSize(ATTR_BUFFER_SIZE);
+    doc = "Size in bytes of the ring buffer for each direction of each connection. ";
+    doc += "Larger messages are transferred in chunks.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(com::SharedMemoryCommunication::DEFAULT_BUFFER_SIZE);
+    tag.addAttribute(attrBufferSize);
+
     XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
     doc = "Directory where connection information is exchanged. By default, the ";
     doc += "directory of startup is chosen, and both solvers have to be started ";
@@ -123,7 +153,7 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
   for (XMLTag &tag : tags) {
     tag.addAttribute(attrFrom);
     tag.addAttribute(attrTo);
-    if (tag.getName() == "mpi" || tag.getName() == "mpi-singleports" || tag.getName() == "sockets") {
+    if (tag.getName() == "mpi" || tag.getName() == "mpi-singleports" || tag.getName() == "sockets" || tag.getName() == "shared-memory") {
       tag.addAttribute(attrDistrTypeBoth);
     } else {
       tag.addAttribute(attrDistrTypeOnly);
@@ -164,8 +194,18 @@ void M2NConfiguration::xmlTagCallback(xml::XMLTag &tag)
       CHECK(not utils::isTruncated<unsigned short>(port),
             "The value given for the \"port\" attribute is not a 16-bit unsigned integer: " << port);
 
+      int bufferSize = tag.getIntAttributeValue(ATTR_BUFFER_SIZE);
+      CHECK(bufferSize >= 0, "The value given for the \"" << ATTR_BUFFER_SIZE << "\" attribute must not be negative: " << bufferSize);
+
+      std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
+      comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir, bufferSize);
+      com             = comFactory->newCommunication();
+    } else if (tag.getName() == "shared-memory") {
+      int bufferSize = tag.getIntAttributeValue(ATTR_BUFFER_SIZE);
+      CHECK(bufferSize > 0, "The value given for the \"" << ATTR_BUFFER_SIZE << "\" attribute has to be positive: " << bufferSize);
+
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
-      comFactory      = std::make_shared<com::SocketCommunicationFactory>(port, false, network, dir);
+      comFactory      = std::make_shared<com::SharedMemoryCommunicationFactory>(dir, bufferSize);
       com             = comFactory->newCommunication();
     } else if (tag.getName() == "mpi") {
       std::string dir = tag.getStringAttributeValue(ATTR_EXCHANGE_DIRECTORY);
@@ -207,7 +247,7 @@ void M2NConfiguration::xmlTagCallback(xml::XMLTag &tag)
       assertion(distrType == VALUE_GATHER_SCATTER);
       distrFactory = std::make_shared<GatherScatterComFactory>(com);
     } else if (distrType == VALUE_POINT_TO_POINT) {
-      assertion(tag.getName() == "mpi" or tag.getName() == "mpi-singleports" or tag.getName() == "sockets");
+      assertion(tag.getName() == "mpi" or tag.getName() == "mpi-singleports" or tag.getName() == "sockets" or tag.getName() == "shared-memory");
       distrFactory = std::make_shared<PointToPointComFactory>(comFactory);
     }
     assertion(distrFactory.get() != nullptr);
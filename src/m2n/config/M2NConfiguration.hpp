@@ -53,6 +53,7 @@ private:
   const std::string TAG                     = "m2n";
   const std::string ATTR_DISTRIBUTION_TYPE  = "distribution-type";
   const std::string ATTR_EXCHANGE_DIRECTORY = "exchange-directory";
+  const std::string ATTR_BUFFER_SIZE        = "buffer-size";
 
   const std::string VALUE_GATHER_SCATTER = "gather-scatter";
   const std::string VALUE_POINT_TO_POINT = "point-to-point";
@@ -16,7 +16,13 @@ BOOST_AUTO_TEST_SUITE(M2NTests)
 using namespace precice;
 using namespace m2n;
 
-BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
+/**
+ * @brief Sends values from a serial participant to a parallel one using gather-scatter and back.
+ *
+ * With withHeader, every message is sent with a header, which also has to reach the slaves
+ * without values.
+ */
+void runGatherScatterTest(bool withHeader)
 {
   assertion(utils::Parallel::getCommunicatorSize() == 4);
 
@@ -80,15 +86,38 @@ BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
   int             valueDimension   = 1;
   Eigen::VectorXd offset           = Eigen::VectorXd::Zero(dimensions);
 
+  // Headers of the messages from Part1 to Part2 and back
+  std::vector<double> header1({1.0, 0.5});
+  std::vector<double> header2({3.0});
+
+  mesh::PtrMesh pMesh(new mesh::Mesh("Mesh", dimensions, flipNormals));
+  m2n->createDistributedCommunication(pMesh);
+  auto send = [&](double *values, int size) {
+    if (withHeader) {
+      m2n->send(values, size, pMesh->getID(), valueDimension, false,
+                utils::Parallel::getProcessRank() == 0 ? header1 : header2);
+    } else {
+      m2n->send(values, size, pMesh->getID(), valueDimension);
+    }
+  };
+  auto receive = [&](double *values, int size) {
+    if (withHeader) {
+      std::vector<double> header(utils::Parallel::getProcessRank() == 0 ? header2.size() : header1.size());
+      m2n->receive(values, size, pMesh->getID(), valueDimension, false, header);
+      BOOST_TEST(header == (utils::Parallel::getProcessRank() == 0 ? header2 : header1),
+                 boost::test_tools::per_element());
+    } else {
+      m2n->receive(values, size, pMesh->getID(), valueDimension);
+    }
+  };
+
   if (utils::Parallel::getProcessRank() == 0) { // Part1
-    mesh::PtrMesh pMesh(new mesh::Mesh("Mesh", dimensions, flipNormals));
-    m2n->createDistributedCommunication(pMesh);
     m2n->acceptSlavesConnection("Part1", "Part2Master");
+    BOOST_TEST(m2n->canSendHeader(pMesh->getID()));
     Eigen::VectorXd values = Eigen::VectorXd::Zero(numberOfVertices);
     values << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
-    m2n->send(values.data(), numberOfVertices, pMesh->getID(), valueDimension);
-    m2n->receive(values.data(), numberOfVertices, pMesh->getID(),
-                 valueDimension);
+    send(values.data(), numberOfVertices);
+    receive(values.data(), numberOfVertices);
     BOOST_TEST(values[0] == 2.0);
     BOOST_TEST(values[1] == 4.0);
     BOOST_TEST(values[2] == 6.0);
@@ -97,9 +126,8 @@ BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
     BOOST_TEST(values[5] == 12.0);
 
   } else {
-    mesh::PtrMesh pMesh(new mesh::Mesh("Mesh", dimensions, flipNormals));
-    m2n->createDistributedCommunication(pMesh);
     m2n->requestSlavesConnection("Part1", "Part2Master");
+    BOOST_TEST(m2n->canSendHeader(pMesh->getID()));
 
     if (utils::Parallel::getProcessRank() == 1) { // Master
       pMesh->setGlobalNumberOfVertices(numberOfVertices);
@@ -112,25 +140,25 @@ BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
       pMesh->getVertexDistribution()[2].push_back(5);
 
       Eigen::Vector3d values(0.0, 0.0, 0.0);
-      m2n->receive(values.data(), 3, pMesh->getID(), valueDimension);
+      receive(values.data(), 3);
       BOOST_TEST(values[0] == 1.0);
       BOOST_TEST(values[1] == 2.0);
       BOOST_TEST(values[2] == 4.0);
       values = values * 2;
-      m2n->send(values.data(), 3, pMesh->getID(), valueDimension);
+      send(values.data(), 3);
     } else if (utils::Parallel::getProcessRank() == 2) { // Slave1
       Eigen::VectorXd values;
-      m2n->receive(values.data(), 0, pMesh->getID(), valueDimension);
-      m2n->send(values.data(), 0, pMesh->getID(), valueDimension);
+      receive(values.data(), 0);
+      send(values.data(), 0);
     } else if (utils::Parallel::getProcessRank() == 3) { // Slave2
       Eigen::Vector4d values(0.0, 0.0, 0.0, 0.0);
-      m2n->receive(values.data(), 4, pMesh->getID(), valueDimension);
+      receive(values.data(), 4);
       BOOST_TEST(values[0] == 3.0);
       BOOST_TEST(values[1] == 4.0);
       BOOST_TEST(values[2] == 5.0);
       BOOST_TEST(values[3] == 6.0);
       values = values * 2;
-      m2n->send(values.data(), 4, pMesh->getID(), valueDimension);
+      send(values.data(), 4);
     }
   }
 
@@ -144,6 +172,17 @@ BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
   utils::Parallel::clearGroups();
 }
 
+BOOST_AUTO_TEST_CASE(GatherScatterTest, *testing::OnSize(4))
+{
+  runGatherScatterTest(false);
+}
+
+/// The header of a message reaches all slaves of the receiving participant.
+BOOST_AUTO_TEST_CASE(GatherScatterHeaderTest, *testing::OnSize(4))
+{
+  runGatherScatterTest(true);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif // PRECICE_NO_MPI
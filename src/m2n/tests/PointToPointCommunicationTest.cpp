@@ -26,7 +26,8 @@ void process(vector<double> &data)
   }
 }
 
-void P2PComTest1(com::PtrCommunicationFactory cf)
+/// With withHeader, the answer is sent with a header, which has to reach all ranks
+void P2PComTest1(com::PtrCommunicationFactory cf, bool singlePrecision = false, bool withHeader = false)
 {
   assertion(Parallel::getCommunicatorSize() == 4);
 
@@ -132,20 +133,33 @@ void P2PComTest1(com::PtrCommunicationFactory cf)
   }
   }
 
+  // every rank has a communication partner, such that a header reaches all ranks
   if (Parallel::getProcessRank() < 2) {
     c.requestConnection("B", "A");
+    BOOST_TEST(c.reachesAllRanks());
 
-    c.send(data.data(), data.size());
-    c.receive(data.data(), data.size());
+    c.send(data.data(), data.size(), 1, singlePrecision);
+    if (withHeader) {
+      vector<double> header(2);
+      c.receiveWithHeader(data.data(), data.size(), 1, singlePrecision, header);
+      BOOST_TEST(header == vector<double>({1.0, 0.5}), boost::test_tools::per_element());
+    } else {
+      c.receive(data.data(), data.size(), 1, singlePrecision);
+    }
 
     BOOST_TEST(data == expectedData);
   } else {
     c.acceptConnection("B", "A");
+    BOOST_TEST(c.reachesAllRanks());
 
-    c.receive(data.data(), data.size());
+    c.receive(data.data(), data.size(), 1, singlePrecision);
     BOOST_TEST(data == expectedData);
     process(data);
-    c.send(data.data(), data.size());
+    if (withHeader) {
+      c.sendWithHeader(data.data(), data.size(), 1, singlePrecision, {1.0, 0.5});
+    } else {
+      c.send(data.data(), data.size(), 1, singlePrecision);
+    }
   }
 
   MasterSlave::_communication.reset();
@@ -294,6 +308,25 @@ BOOST_AUTO_TEST_CASE(SocketCommunication,
   }
 }
 
+BOOST_AUTO_TEST_CASE(SocketCommunicationWithHeader,
+                     * testing::OnSize(4))
+{
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  if (utils::Parallel::getProcessRank() < 4) {
+    P2PComTest1(cf, false, true);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(SocketCommunicationSinglePrecision,
+                     * testing::OnSize(4))
+{
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  if (utils::Parallel::getProcessRank() < 4) {
+    // All values are exactly representable in single precision
+    P2PComTest1(cf, true);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(MPIPortsCommunication,
                      * testing::OnSize(4)
                      * boost::unit_test::label("MPI_Ports"))
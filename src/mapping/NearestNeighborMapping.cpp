@@ -32,6 +32,7 @@ void NearestNeighborMapping:: computeMapping()
   assertion(output().get() != nullptr);
 
   precice::utils::Event e("map.nn.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  _mapDataEventName = utils::EventName("map.nn.mapData.From" + input()->getName() + "To" + output()->getName());
   
   if (getConstraint() == CONSISTENT){
     DEBUG("Compute consistent mapping");
@@ -87,7 +88,7 @@ void NearestNeighborMapping:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.nn.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(_mapDataEventName, precice::syncMode);
 
   const Eigen::VectorXd& inputValues = input()->data(inputDataID)->values();
   Eigen::VectorXd& outputValues = output()->data(outputDataID)->values();
@@ -2,6 +2,7 @@
 
 #include "mapping/Mapping.hpp"
 #include "logging/Logger.hpp"
+#include "utils/EventTimings.hpp"
 #include <vector>
 
 namespace precice {
@@ -46,6 +47,9 @@ private:
   /// Flag to indicate whether computeMapping() has been called.
   bool _hasComputedMapping = false;
 
+  /// Name of the event of map(), registered in computeMapping().
+  utils::EventName _mapDataEventName;
+
   /// Computed output vertex indices to map data from input vertices to.
   std::vector<int> _vertexIndices;
 };
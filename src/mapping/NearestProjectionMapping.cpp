@@ -31,6 +31,7 @@ void NearestProjectionMapping:: computeMapping()
   TRACE(input()->vertices().size(), output()->vertices().size());
 
   precice::utils::Event e("map.np.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  _mapDataEventName = utils::EventName("map.np.mapData.From" + input()->getName() + "To" + output()->getName());
 
   if (getConstraint() == CONSISTENT){
     DEBUG("Compute consistent mapping");
@@ -83,7 +84,7 @@ void NearestProjectionMapping:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.np.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(_mapDataEventName, precice::syncMode);
 
   mesh::PtrData inData = input()->data(inputDataID);
   mesh::PtrData outData = output()->data(outputDataID);
@@ -4,6 +4,7 @@
 #include <list>
 #include <vector>
 #include "logging/Logger.hpp"
+#include "utils/EventTimings.hpp"
 #include "query/FindClosest.hpp"
 
 namespace precice {
@@ -55,6 +56,9 @@ private:
   std::vector<InterpolationElements> _weights;
 
   bool _hasComputedMapping = false;
+
+  /// Name of the event of map(), registered in computeMapping().
+  utils::EventName _mapDataEventName;
 };
 
 }} // namespace precice, mapping
@@ -102,6 +102,9 @@ private:
 
   bool _hasComputedMapping = false;
 
+  /// Names of the events of map(), registered in computeMapping().
+  utils::EventName _mapDataEventName, _solveConservativeEventName, _solveConsistentEventName;
+
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
@@ -245,6 +248,10 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 {
   TRACE();
   precice::utils::Event e("map.pet.computeMapping.From" + input()->getName() + "To"+ output()->getName(), precice::syncMode);
+  std::string meshes = ".From" + input()->getName() + "To" + output()->getName();
+  _mapDataEventName = utils::EventName("map.pet.mapData" + meshes);
+  _solveConservativeEventName = utils::EventName("map.pet.solveConservative" + meshes);
+  _solveConsistentEventName = utils::EventName("map.pet.solveConsistent" + meshes);
 
   clear();
 
@@ -600,7 +607,7 @@ template<typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int outputDataID)
 {
   TRACE(inputDataID, outputDataID);
-  precice::utils::Event e("map.pet.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(_mapDataEventName, precice::syncMode);
 
   assertion(_hasComputedMapping);
   assertion(input()->getDimensions() == output()->getDimensions(),
@@ -654,7 +661,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
       }
       else {
         ierr = MatMultTranspose(_matrixA, in, au); CHKERRV(ierr);
-        utils::Event eSolve("map.pet.solveConservative.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+        utils::Event eSolve(_solveConservativeEventName, precice::syncMode);
         if (not _solver.solve(au, out)) {
           KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
           ERROR("RBF linear system has not converged.");
@@ -717,7 +724,7 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(int inputDataID, int
                                  std::forward_as_tuple(_matrixC, "p"))
         )->second;
 
-      utils::Event eSolve("map.pet.solveConsistent.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+      utils::Event eSolve(_solveConsistentEventName, precice::syncMode);
       if (not _solver.solve(in, p)) {
         KSPView(_solver, PETSC_VIEWER_STDOUT_WORLD);
         ERROR("RBF linear system has not converged.");
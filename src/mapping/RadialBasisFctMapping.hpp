@@ -68,6 +68,9 @@ private:
 
   bool _hasComputedMapping = false;
 
+  /// Name of the event of map(), registered in computeMapping().
+  utils::EventName _mapDataEventName;
+
   /// Radial basis function type used in interpolation.
   RADIAL_BASIS_FUNCTION_T _basisFunction;
 
@@ -130,6 +133,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: computeMapping()
   TRACE();
 
   precice::utils::Event e("map.rbf.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  _mapDataEventName = utils::EventName("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName());
 
   CHECK(not utils::MasterSlave::_slaveMode && not utils::MasterSlave::_masterMode,
         "RBF mapping is not supported for a participant in master mode, use petrbf instead");
@@ -232,7 +236,7 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>:: map
 {
   TRACE(inputDataID, outputDataID);
 
-  precice::utils::Event e("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+  precice::utils::Event e(_mapDataEventName, precice::syncMode);
 
   assertion(_hasComputedMapping);
   assertion(input()->getDimensions() == output()->getDimensions(),
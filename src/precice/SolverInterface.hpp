@@ -26,6 +26,7 @@ namespace PreciceTests {
     struct TestQN;
     struct testDistributedCommunications;
     struct CouplingOnLine;
+    struct MultiCouplingConcurrentExchange;
   }
   namespace Serial {
     struct TestExplicit;
@@ -38,10 +39,14 @@ namespace PreciceTests {
     struct testExplicitWithDisplacingGeometry;
     struct testExplicitWithDataScaling;
     struct testImplicit;
+    struct testAdvanceTimings;
+    struct testImplicitWithWaveform;
+    struct testImplicitWithWaveformSamples;
     struct testStationaryMappingWithSolverMesh;
     struct testBug;
     struct testThreeSolvers;
     struct testMultiCoupling;
+    struct testMultiCouplingManifoldMapping;
   }
   namespace Server {
     struct testCouplingModeWithOneServer;
@@ -598,6 +603,7 @@ private:
   friend struct PreciceTests::Parallel::TestQN;
   friend struct PreciceTests::Parallel::testDistributedCommunications;
   friend struct PreciceTests::Parallel::CouplingOnLine;
+  friend struct PreciceTests::Parallel::MultiCouplingConcurrentExchange;
   friend struct PreciceTests::Serial::TestExplicit;
   friend struct PreciceTests::Serial::TestConfiguration;
   friend struct PreciceTests::Serial::testExplicitWithSubcycling;
@@ -608,10 +614,14 @@ private:
   friend struct PreciceTests::Serial::testExplicitWithDisplacingGeometry;
   friend struct PreciceTests::Serial::testExplicitWithDataScaling;
   friend struct PreciceTests::Serial::testImplicit;
+  friend struct PreciceTests::Serial::testAdvanceTimings;
+  friend struct PreciceTests::Serial::testImplicitWithWaveform;
+  friend struct PreciceTests::Serial::testImplicitWithWaveformSamples;
   friend struct PreciceTests::Serial::testStationaryMappingWithSolverMesh;
   friend struct PreciceTests::Serial::testBug;
   friend struct PreciceTests::Serial::testThreeSolvers;
   friend struct PreciceTests::Serial::testMultiCoupling;
+  friend struct PreciceTests::Serial::testMultiCouplingManifoldMapping;
   friend struct PreciceTests::Server::testCouplingModeWithOneServer;
   friend struct PreciceTests::Server::testCouplingModeParallelWithOneServer;
 
@@ -1,5 +1,8 @@
 #include "Configuration.hpp"
 #include "xml/XMLAttribute.hpp"
+#include "xml/ValidatorEquals.hpp"
+#include "xml/ValidatorOr.hpp"
+#include "utils/EventTimings.hpp"
 
 
 namespace precice {
@@ -30,6 +33,29 @@ Configuration:: Configuration()
   attrSyncMode.setDocumentation(doc);
   _tag.addAttribute(attrSyncMode);
 
+  xml::XMLAttribute<std::string> attrEventStatistics("event-statistics");
+  doc = "Collection of event timings from all ranks at the end of the run. \"gather\" sends all events ";
+  doc += "of all ranks to rank 0. \"reduce\" only reduces statistics per event, which scales to many ranks.";
+  attrEventStatistics.setDocumentation(doc);
+  xml::ValidatorEquals<std::string> validGather("gather");
+  xml::ValidatorEquals<std::string> validReduce("reduce");
+  attrEventStatistics.setValidator(validGather || validReduce);
+  attrEventStatistics.setDefaultValue("gather");
+  _tag.addAttribute(attrEventStatistics);
+
+  xml::XMLAttribute<bool> attrEventTrace("event-trace");
+  doc = "If enabled, all ranks write their event state changes in parallel to a binary trace file.";
+  attrEventTrace.setDefaultValue(false);
+  attrEventTrace.setDocumentation(doc);
+  _tag.addAttribute(attrEventTrace);
+
+  xml::XMLAttribute<bool> attrChromeTrace("chrome-trace");
+  doc = "If enabled, the collected event timeline is written in the Chrome Trace Event format, ";
+  doc += "which is opened with chrome://tracing or Perfetto. With event-statistics=\"reduce\", ";
+  doc += "only the events of the first rank are contained.";
+  attrChromeTrace.setDefaultValue(false);
+  attrChromeTrace.setDocumentation(doc);
+  _tag.addAttribute(attrChromeTrace);
 }
 
 xml::XMLTag& Configuration:: getXMLTag()
@@ -42,6 +68,17 @@ void Configuration::xmlTagCallback(xml::XMLTag& tag)
   TRACE(tag.getName());
   if (tag.getName() == "precice-configuration") {
     precice::syncMode = tag.getBooleanAttributeValue("sync-mode");
+    auto & registry = utils::EventRegistry::instance();
+    if (tag.getStringAttributeValue("event-statistics") == "reduce")
+      registry.collectMode = utils::EventRegistry::CollectMode::REDUCE;
+    else
+      registry.collectMode = utils::EventRegistry::CollectMode::GATHER;
+    registry.writeTrace = tag.getBooleanAttributeValue("event-trace");
+    registry.chromeTrace = tag.getBooleanAttributeValue("chrome-trace");
+    if (registry.chromeTrace && registry.collectMode == utils::EventRegistry::CollectMode::REDUCE) {
+      WARN("The Chrome trace only contains the events of the first rank, since event-statistics=\"reduce\" "
+           << "does not collect the state changes of the other ranks");
+    }
   }
 }
 
@@ -3,6 +3,7 @@
 #include "precice/impl/MappingContext.hpp"
 #include "precice/impl/DataContext.hpp"
 #include "precice/impl/WatchPoint.hpp"
+#include "com/SharedMemoryCommunication.hpp"
 #include "com/config/CommunicationConfiguration.hpp"
 #include "action/config/ActionConfiguration.hpp"
 #include "mesh/config/MeshConfiguration.hpp"
@@ -63,6 +64,16 @@ ParticipantConfiguration:: ParticipantConfiguration
   attrMesh.setDocumentation(doc);
   tagWriteData.addAttribute(attrMesh);
   tagReadData.addAttribute(attrMesh);
+  XMLAttribute<int> attrWaveformOrder(ATTR_WAVEFORM_ORDER);
+  doc = "Order of the interpolation of the read data in time. With 0, the received values are ";
+  doc += "read until new values are received. With 1, the values are interpolated linearly between ";
+  doc += "the beginning and the end of the time window, such that subcycling solvers read data ";
+  doc += "at the end of their next timestep. Meaningful if the received values belong to the end of ";
+  doc += "the current time window, e.g. for implicit coupling schemes. If the data is exchanged with ";
+  doc += "waveform samples, the values are interpolated piecewise linearly across them.";
+  attrWaveformOrder.setDocumentation(doc);
+  attrWaveformOrder.setDefaultValue(0);
+  tagReadData.addAttribute(attrWaveformOrder);
   tag.addSubtag(tagWriteData);
   tag.addSubtag(tagReadData);
 
@@ -174,6 +185,40 @@ ParticipantConfiguration:: ParticipantConfiguration
     attrNetwork.setDefaultValue("lo");
     tagServer.addAttribute(attrNetwork);
 
+    XMLAttribute<int> attrBufferSize(ATTR_BUFFER_SIZE);
+    doc = "Size in bytes of the send and receive buffers of the sockets. ";
+    doc += "The default is \"0\", what means that the default of the OS is used.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(0);
+    tagServer.addAttribute(attrBufferSize);
+
+    XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
+    doc = "Directory where connection information is exchanged. By default, the ";
+    doc += "directory of startup is chosen, and both solvers have to be started ";
+    doc += "in the same directory.";
+    attrExchangeDirectory.setDocumentation(doc);
+    attrExchangeDirectory.setDefaultValue("");
+    tagServer.addAttribute(attrExchangeDirectory);
+
+    serverTags.push_back(tagServer);
+  }
+  {
+    XMLTag tagServer(*this, "shared-memory", serverOcc, TAG_SERVER);
+    doc = "When a solver runs in parallel, it can use preCICE in form of a ";
+    doc += "separately running server (deprecated feature). This is enabled by this tag. ";
+    doc += "The communication between participant and server is done by POSIX shared memory, ";
+    doc += "which requires the server to run on the same node as all ranks of the solver. ";
+    doc += "The ranks map the data values of the server, such that writing and reading data ";
+    doc += "needs no request to the server. The number of data values must not change after initialize.";
+    tagServer.setDocumentation(doc);
+
+    XMLAttribute<int> attrBufferSize(ATTR_BUFFER_SIZE);
+    doc = "Size in bytes of the ring buffer for each direction of each connection. ";
+    doc += "Larger messages are transferred in chunks.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(com::SharedMemoryCommunication::DEFAULT_BUFFER_SIZE);
+    tagServer.addAttribute(attrBufferSize);
+
     XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
     doc = "Directory where connection information is exchanged. By default, the ";
     doc += "directory of startup is chosen, and both solvers have to be started ";
@@ -243,6 +288,40 @@ ParticipantConfiguration:: ParticipantConfiguration
     attrNetwork.setDefaultValue("lo");
     tagMaster.addAttribute(attrNetwork);
 
+    XMLAttribute<int> attrBufferSize(ATTR_BUFFER_SIZE);
+    doc = "Size in bytes of the send and receive buffers of the sockets. ";
+    doc += "The default is \"0\", what means that the default of the OS is used.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(0);
+    tagMaster.addAttribute(attrBufferSize);
+
+    XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
+    doc = "Directory where connection information is exchanged. By default, the ";
+    doc += "directory of startup is chosen.";
+    attrExchangeDirectory.setDocumentation(doc);
+    attrExchangeDirectory.setDefaultValue("");
+    tagMaster.addAttribute(attrExchangeDirectory);
+
+    masterTags.push_back(tagMaster);
+  }
+  {
+    XMLTag tagMaster(*this, "shared-memory", masterOcc, TAG_MASTER);
+    doc = "A solver in parallel has to use either a Master or a Server (Master is recommended), but not both. ";
+    doc += "If you use a Master, you do not have to start-up a further executable, ";
+    doc += "all communication is handled peer to peer. One solver process becomes the ";
+    doc += " Master handling the synchronization of all slaves. Here, you define then ";
+    doc += " the communication between the Master and all slaves. ";
+    doc += "The communication between Master and slaves is done by POSIX shared memory, ";
+    doc += "which requires all ranks of the solver to run on the same node.";
+    tagMaster.setDocumentation(doc);
+
+    XMLAttribute<int> attrBufferSize(ATTR_BUFFER_SIZE);
+    doc = "Size in bytes of the ring buffer for each direction of each connection. ";
+    doc += "Larger messages are transferred in chunks.";
+    attrBufferSize.setDocumentation(doc);
+    attrBufferSize.setDefaultValue(com::SharedMemoryCommunication::DEFAULT_BUFFER_SIZE);
+    tagMaster.addAttribute(attrBufferSize);
+
     XMLAttribute<std::string> attrExchangeDirectory(ATTR_EXCHANGE_DIRECTORY);
     doc = "Directory where connection information is exchanged. By default, the ";
     doc += "directory of startup is chosen.";
@@ -360,8 +439,12 @@ void ParticipantConfiguration:: xmlTagCallback
     CHECK(mesh.use_count() > 0, "Participant "
           << "\"" << _participants.back()->getName() << "\" has to use "
           << "mesh \"" << meshName << "\" in order to read data from it!" );
+    int waveformOrder = tag.getIntAttributeValue(ATTR_WAVEFORM_ORDER);
+    CHECK(waveformOrder == 0 || waveformOrder == 1, "Read data \"" << dataName
+          << "\" of participant \"" << _participants.back()->getName()
+          << "\" has waveform order " << waveformOrder << ", but only 0 and 1 are supported!" );
     mesh::PtrData data = getData ( mesh, dataName );
-    _participants.back()->addReadData ( data, mesh );
+    _participants.back()->addReadData ( data, mesh, waveformOrder );
   }
   else if ( tag.getName() == TAG_WATCH_POINT ){
     assertion(_dimensions != 0); // setDimensions() has been called
@@ -584,8 +667,11 @@ void ParticipantConfiguration:: finishParticipantConfiguration
   for (io::ExportContext& context : _exportConfig->exportContexts()){
     io::PtrExport exporter;
     if (context.type == VALUE_VTK){
-      if(_participants.back()->useMaster()){
-        exporter = io::PtrExport(new io::ExportVTKXML(context.plotNormals));
+      if(_participants.back()->useMaster() || context.format != io::VTKXMLDataWriter::ASCII
+         || context.asynchronous || context.timeSeries){
+        exporter = io::PtrExport(new io::ExportVTKXML(context.plotNormals, context.format,
+                                                      context.compress, context.asynchronous,
+                                                      context.aggregators, context.timeSeries));
       }
       else{
         exporter = io::PtrExport(new io::ExportVTK(context.plotNormals));
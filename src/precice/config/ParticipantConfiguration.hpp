@@ -84,6 +84,8 @@ private:
   const std::string ATTR_CONTEXT = "context";
   const std::string ATTR_NETWORK = "network";
   const std::string ATTR_EXCHANGE_DIRECTORY = "exchange-directory";
+  const std::string ATTR_BUFFER_SIZE = "buffer-size";
+  const std::string ATTR_WAVEFORM_ORDER = "waveform-order";
 
   const std::string VALUE_FILTER_FIRST = "filter-first";
   const std::string VALUE_BROADCAST_FILTER = "broadcast-filter";
@@ -28,6 +28,29 @@ SolverInterfaceConfiguration:: SolverInterfaceConfiguration(xml::XMLTag& parent
   attrDimensions.setValidator(validDim2 || validDim3);
   tag.addAttribute(attrDimensions);
 
+  XMLAttribute<bool> attrAdvanceTimings("advance-timings");
+  doc = "If enabled, the master of every participant writes the time spent in sending, receiving, ";
+  doc += "mapping, post-processing, convergence measurement, and export for every call of advance() ";
+  doc += "to precice-PARTICIPANT-advance.log, next to the time the solver computed in between.";
+  attrAdvanceTimings.setDocumentation(doc);
+  attrAdvanceTimings.setDefaultValue(false);
+  tag.addAttribute(attrAdvanceTimings);
+
+  XMLAttribute<int> attrCheckpointInterval("checkpoint-interval");
+  doc = "If larger than zero, every rank of every participant writes the state of its coupling scheme ";
+  doc += "after every given number of completed timesteps to precice-PARTICIPANT-checkpoint-rankN.bin. ";
+  doc += "Besides time and iteration counters, this includes the coupling data and the quasi-Newton matrices.";
+  attrCheckpointInterval.setDocumentation(doc);
+  attrCheckpointInterval.setDefaultValue(0);
+  tag.addAttribute(attrCheckpointInterval);
+
+  XMLAttribute<bool> attrRestart("restart");
+  doc = "If enabled, the state of the coupling scheme is restored in initialize() from the last checkpoint ";
+  doc += "written with checkpoint-interval. The participants have to run on the same decomposition.";
+  attrRestart.setDocumentation(doc);
+  attrRestart.setDefaultValue(false);
+  tag.addAttribute(attrRestart);
+
   _dataConfiguration = mesh::PtrDataConfiguration (
       new mesh::DataConfiguration(tag) );
   _meshConfiguration = mesh::PtrMeshConfiguration (
@@ -50,6 +73,10 @@ void SolverInterfaceConfiguration:: xmlTagCallback
   TRACE();
   if (tag.getName() == "solver-interface"){
     _dimensions = tag.getIntAttributeValue("dimensions");
+    _writeAdvanceTimings = tag.getBooleanAttributeValue("advance-timings");
+    _checkpointInterval = tag.getIntAttributeValue("checkpoint-interval");
+    _restart = tag.getBooleanAttributeValue("restart");
+    CHECK(_checkpointInterval >= 0, "The checkpoint-interval has to be zero or positive!");
     _dataConfiguration->setDimensions(_dimensions);
     _meshConfiguration->setDimensions(_dimensions);
     _participantConfiguration->setDimensions(_dimensions);
@@ -101,6 +128,21 @@ int SolverInterfaceConfiguration:: getDimensions() const
   return _dimensions;
 }
 
+bool SolverInterfaceConfiguration:: writeAdvanceTimings() const
+{
+  return _writeAdvanceTimings;
+}
+
+int SolverInterfaceConfiguration:: getCheckpointInterval() const
+{
+  return _checkpointInterval;
+}
+
+bool SolverInterfaceConfiguration:: restartFromCheckpoint() const
+{
+  return _restart;
+}
+
 const PtrParticipantConfiguration &
 SolverInterfaceConfiguration:: getParticipantConfiguration() const
 {
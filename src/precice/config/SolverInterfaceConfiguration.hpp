@@ -47,6 +47,15 @@ public:
    */
   int getDimensions() const;
 
+  /// Returns whether the times spent in the phases of advance() are written to a file.
+  bool writeAdvanceTimings() const;
+
+  /// Returns the number of timesteps between two checkpoints of the coupling state, 0 if none are written.
+  int getCheckpointInterval() const;
+
+  /// Returns whether the coupling state is restored from a checkpoint in initialize().
+  bool restartFromCheckpoint() const;
+
   const mesh::PtrDataConfiguration getDataConfiguration() const
   {
     return _dataConfiguration;
@@ -101,6 +110,15 @@ private:
   /// Spatial dimension of problem to be solved. Either 2 or 3.
   int _dimensions = -1;
 
+  /// Write the times spent in the phases of advance() to a file
+  bool _writeAdvanceTimings = false;
+
+  /// Number of timesteps between two checkpoints of the coupling state
+  int _checkpointInterval = 0;
+
+  /// Restore the coupling state from a checkpoint
+  bool _restart = false;
+
   // @brief Participating solvers in the coupled simulation.
   //std::vector<impl::PtrParticipant> _participants;
 
@@ -2,6 +2,8 @@
 
 #include "MappingContext.hpp"
 #include "mesh/SharedPointer.hpp"
+#include <Eigen/Core>
+#include <vector>
 
 namespace precice {
 namespace impl {
@@ -21,6 +23,27 @@ struct DataContext
   mesh::PtrMesh mesh;
 
   MappingContext mappingContext;
+
+  /// Order of the interpolation of read data in time, 0 keeps the received values constant.
+  int waveformOrder = 0;
+
+  /// Read or written data values at the beginning of the current time window.
+  Eigen::VectorXd waveformStart;
+
+  /// Read data values last received for the end of the current time window.
+  Eigen::VectorXd waveformEnd;
+
+  /// Exchanged data holding samples of the values at equidistant times within the time window.
+  std::vector<mesh::PtrData> waveformSamples;
+
+  /// Read data values of the samples within the current time window, mapped like the values.
+  std::vector<Eigen::VectorXd> waveformSampleValues;
+
+  /// Written data values at the end of the last timestep of the solver.
+  Eigen::VectorXd waveformLast;
+
+  /// Time of waveformLast relative to the time window.
+  double waveformLastTime = 0.0;
 };
 
 }} // namespace precice, impl
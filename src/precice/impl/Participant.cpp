@@ -116,13 +116,15 @@ void Participant:: addWriteData
 void Participant:: addReadData
 (
   const mesh::PtrData& data,
-  const mesh::PtrMesh& mesh )
+  const mesh::PtrMesh& mesh,
+  int                  waveformOrder )
 {
   checkDuplicatedData ( data );
   assertion ( data->getID() < (int)_dataContexts.size() );
   DataContext* context = new DataContext ();
   context->toData = data;
   context->mesh = mesh;
+  context->waveformOrder = waveformOrder;
   // will be overwritten later if a mapping exists
   context->fromData = context->toData;
   _dataContexts[data->getID()] = context;
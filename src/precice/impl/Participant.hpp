@@ -68,7 +68,8 @@ public:
 
   void addReadData (
     const mesh::PtrData& data,
-    const mesh::PtrMesh& mesh );
+    const mesh::PtrMesh& mesh,
+    int                  waveformOrder = 0 );
 
   const DataContext& dataContext ( int dataID ) const;
 
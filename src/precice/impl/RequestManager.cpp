@@ -1,8 +1,11 @@
 #include "RequestManager.hpp"
 #include "com/Communication.hpp"
+#include "com/SharedMemoryCommunication.hpp"
 #include "cplscheme/CouplingScheme.hpp"
+#include "mesh/Data.hpp"
 #include "precice/impl/SolverInterfaceImpl.hpp"
 #include <algorithm>
+#include <unistd.h>
 
 namespace precice {
 namespace impl {
@@ -15,7 +18,8 @@ RequestManager:: RequestManager
 :
   _interface(solverInterfaceImpl),
   _com(clientServerCommunication),
-  _couplingScheme(couplingScheme)
+  _couplingScheme(couplingScheme),
+  _shareValues(std::dynamic_pointer_cast<com::SharedMemoryCommunication>(clientServerCommunication) != nullptr)
 {}
 
 void RequestManager:: handleRequests()
@@ -105,9 +109,6 @@ void RequestManager:: handleRequests()
       handleRequestGetMeshVertexSize(rankSender);
       singleRequest = true;
       break;
-    case REQUEST_RESET_MESH:
-      handleRequestResetMesh(rankSender);
-      break;
     case REQUEST_SET_MESH_VERTICES:
       handleRequestSetMeshVertices(rankSender);
       singleRequest = true;
@@ -120,40 +121,12 @@ void RequestManager:: handleRequests()
       handleRequestGetMeshVertexIDsFromPositions(rankSender);
       singleRequest = true;
       break;
-    case REQUEST_SET_MESH_EDGE:
-      handleRequestSetMeshEdge(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE:
-      handleRequestSetMeshTriangle(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
-      handleRequestSetMeshTriangleWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_SET_MESH_QUAD:
-      handleRequestSetMeshQuad(rankSender);
+    case REQUEST_BATCH:
+      handleRequestBatch(rankSender);
       singleRequest = true;
       break;
-    case REQUEST_SET_MESH_QUAD_WITH_EDGES:
-      handleRequestSetMeshQuadWithEdges(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_SCALAR_DATA:
-      handleRequestWriteBlockScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_SCALAR_DATA:
-      handleRequestWriteScalarData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_BLOCK_VECTOR_DATA:
-      handleRequestWriteBlockVectorData(rankSender);
-      singleRequest = true;
-      break;
-    case REQUEST_WRITE_VECTOR_DATA:
-      handleRequestWriteVectorData(rankSender);
+    case REQUEST_SET_MESH_EDGE:
+      handleRequestSetMeshEdge(rankSender);
       singleRequest = true;
       break;
     case REQUEST_READ_BLOCK_SCALAR_DATA:
@@ -227,7 +200,8 @@ void RequestManager:: handleRequests()
 void RequestManager:: requestPing()
 {
   TRACE();
-  _com->send(REQUEST_PING, 0);
+  startRequest(REQUEST_PING);
+  _com->flush();
   int dummy = 0;
   _com->receive(dummy, 0);
 }
@@ -235,14 +209,19 @@ void RequestManager:: requestPing()
 void RequestManager:: requestInitialize()
 {
   TRACE();
-  _com->send(REQUEST_INITIALIZE, 0);
+  startRequest(REQUEST_INITIALIZE);
+  _com->flush();
   _couplingScheme->receiveState(_com, 0);
+  if (_shareValues){
+    receiveSharedValues();
+  }
 }
 
 void RequestManager:: requestInitialzeData()
 {
   TRACE();
-  _com->send(REQUEST_INITIALIZE_DATA, 0);
+  startRequest(REQUEST_INITIALIZE_DATA);
+  _com->flush();
   _couplingScheme->receiveState(_com, 0);
 }
 
@@ -251,15 +230,17 @@ void RequestManager:: requestAdvance
   double dt )
 {
   TRACE();
-  _com->send(REQUEST_ADVANCE, 0);
+  startRequest(REQUEST_ADVANCE);
   _com->send(dt, 0);
+  _com->flush();
   _couplingScheme->receiveState(_com, 0);
 }
 
 void RequestManager:: requestFinalize()
 {
   TRACE();
-  _com->send(REQUEST_FINALIZE, 0);
+  startRequest(REQUEST_FINALIZE);
+  _com->flush();
 }
 
 
@@ -268,8 +249,9 @@ void RequestManager:: requestFulfilledAction
   const std::string& action )
 {
   TRACE();
-  _com->send(REQUEST_FULFILLED_ACTION, 0);
+  startRequest(REQUEST_FULFILLED_ACTION);
   _com->send(action, 0);
+  _com->flush();
 }
 
 int RequestManager:: requestSetMeshVertex
@@ -278,9 +260,10 @@ int RequestManager:: requestSetMeshVertex
   Eigen::VectorXd& position )
 {
   TRACE();
-  _com->send(REQUEST_SET_MESH_VERTEX, 0);
+  startRequest(REQUEST_SET_MESH_VERTEX);
   _com->send(meshID, 0);
   _com->send(position.data(), position.size(), 0);
+  _com->flush();
   int index = -1;
   _com->receive(index, 0);
   return index;
@@ -291,8 +274,9 @@ int RequestManager:: requestGetMeshVertexSize
   int meshID )
 {
   TRACE(meshID);
-  _com->send(REQUEST_GET_MESH_VERTEX_SIZE, 0);
+  startRequest(REQUEST_GET_MESH_VERTEX_SIZE);
   _com->send(meshID, 0);
+  _com->flush();
   int size = -1;
   _com->receive(size, 0);
   return size;
@@ -303,8 +287,8 @@ void RequestManager:: requestResetMesh
   int meshID )
 {
   TRACE(meshID);
-  _com->send(REQUEST_RESET_MESH, 0);
-  _com->send(meshID, 0);
+  _batchedInts.push_back(REQUEST_RESET_MESH);
+  _batchedInts.push_back(meshID);
 }
 
 void RequestManager:: requestSetMeshVertices
@@ -315,10 +299,11 @@ void RequestManager:: requestSetMeshVertices
   int*    ids )
 {
   TRACE();
-  _com->send(REQUEST_SET_MESH_VERTICES, 0);
+  startRequest(REQUEST_SET_MESH_VERTICES);
   _com->send(meshID, 0);
   _com->send(size, 0);
   _com->send(positions, size*_interface.getDimensions(), 0);
+  _com->flush();
   _com->receive(ids, size, 0);
 }
 
@@ -330,10 +315,11 @@ void RequestManager:: requestGetMeshVertices
   double* positions )
 {
   TRACE();
-  _com->send(REQUEST_GET_MESH_VERTICES, 0);
+  startRequest(REQUEST_GET_MESH_VERTICES);
   _com->send(meshID, 0);
   _com->send(size, 0);
   _com->send(ids, size, 0);
+  _com->flush();
   _com->receive(positions, size*_interface.getDimensions(), 0);
 }
 
@@ -345,10 +331,11 @@ void RequestManager:: requestGetMeshVertexIDsFromPositions
   int*    ids )
 {
   TRACE(size);
-  _com->send(REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS, 0);
+  startRequest(REQUEST_GET_MESH_VERTEX_IDS_FROM_POSITIONS);
   _com->send(meshID, 0);
   _com->send(size, 0);
   _com->send(positions, size*_interface.getDimensions(), 0);
+  _com->flush();
   _com->receive(ids, size, 0);
 }
 
@@ -360,9 +347,10 @@ int RequestManager:: requestSetMeshEdge
   int secondVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID);
-  _com->send(REQUEST_SET_MESH_EDGE, 0);
+  startRequest(REQUEST_SET_MESH_EDGE);
   int data[3] = { meshID, firstVertexID, secondVertexID };
   _com->send(data, 3, 0);
+  _com->flush();
   int createdEdgeID = -1;
   _com->receive(createdEdgeID, 0);
   return createdEdgeID;
@@ -376,9 +364,8 @@ void RequestManager:: requestSetMeshTriangle
   int thirdEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE, 0);
-  int data[4] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID};
-  _com->send(data, 4, 0);
+  int data[5] = {REQUEST_SET_MESH_TRIANGLE, meshID, firstEdgeID, secondEdgeID, thirdEdgeID};
+  _batchedInts.insert(_batchedInts.end(), data, data + 5);
 }
 
 void RequestManager:: requestSetMeshTriangleWithEdges
@@ -390,9 +377,8 @@ void RequestManager:: requestSetMeshTriangleWithEdges
 {
   TRACE(meshID, firstVertexID,
                 secondVertexID, thirdVertexID);
-  _com->send(REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, 0);
-  int data[4] = {meshID, firstVertexID, secondVertexID, thirdVertexID};
-  _com->send(data, 4, 0);
+  int data[5] = {REQUEST_SET_MESH_TRIANGLE_WITH_EDGES, meshID, firstVertexID, secondVertexID, thirdVertexID};
+  _batchedInts.insert(_batchedInts.end(), data, data + 5);
 }
 
 void RequestManager:: requestSetMeshQuad
@@ -404,9 +390,8 @@ void RequestManager:: requestSetMeshQuad
   int fourthEdgeID )
 {
   TRACE(meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID);
-  _com->send(REQUEST_SET_MESH_QUAD, 0);
-  int data[5] = {meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID};
-  _com->send(data, 5, 0);
+  int data[6] = {REQUEST_SET_MESH_QUAD, meshID, firstEdgeID, secondEdgeID, thirdEdgeID, fourthEdgeID};
+  _batchedInts.insert(_batchedInts.end(), data, data + 6);
 }
 
 void RequestManager:: requestSetMeshQuadWithEdges
@@ -418,9 +403,8 @@ void RequestManager:: requestSetMeshQuadWithEdges
   int fourthVertexID )
 {
   TRACE(meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
-  _com->send(REQUEST_SET_MESH_QUAD_WITH_EDGES, 0);
-  int data[5] = {meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID};
-  _com->send(data, 5, 0);
+  int data[6] = {REQUEST_SET_MESH_QUAD_WITH_EDGES, meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID};
+  _batchedInts.insert(_batchedInts.end(), data, data + 6);
 }
 
 void RequestManager:: requestWriteBlockScalarData (
@@ -430,11 +414,17 @@ void RequestManager:: requestWriteBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_WRITE_BLOCK_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size, 0);
+  if (SharedValues* shared = findSharedValues(dataID, 1)){
+    for (int i = 0; i < size; i++){
+      *sharedValuesAt(*shared, valueIndices[i]) = values[i];
+    }
+    return;
+  }
+  _batchedInts.push_back(REQUEST_WRITE_BLOCK_SCALAR_DATA);
+  _batchedInts.push_back(dataID);
+  _batchedInts.push_back(size);
+  _batchedInts.insert(_batchedInts.end(), valueIndices, valueIndices + size);
+  _batchedDoubles.insert(_batchedDoubles.end(), values, values + size);
 }
 
 void RequestManager:: requestWriteScalarData
@@ -444,10 +434,14 @@ void RequestManager:: requestWriteScalarData
   double value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_SCALAR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, 0);
+  if (SharedValues* shared = findSharedValues(dataID, 1)){
+    *sharedValuesAt(*shared, valueIndex) = value;
+    return;
+  }
+  _batchedInts.push_back(REQUEST_WRITE_SCALAR_DATA);
+  _batchedInts.push_back(dataID);
+  _batchedInts.push_back(valueIndex);
+  _batchedDoubles.push_back(value);
 }
 
 void RequestManager:: requestWriteBlockVectorData (
@@ -457,11 +451,18 @@ void RequestManager:: requestWriteBlockVectorData (
   double* values )
 {
   TRACE(dataID);
-  _com->send(REQUEST_WRITE_BLOCK_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(size, 0);
-  _com->send(valueIndices, size, 0);
-  _com->send(values, size*_interface.getDimensions(), 0);
+  int dimensions = _interface.getDimensions();
+  if (SharedValues* shared = findSharedValues(dataID, dimensions)){
+    for (int i = 0; i < size; i++){
+      std::copy(values + i*dimensions, values + (i+1)*dimensions, sharedValuesAt(*shared, valueIndices[i]));
+    }
+    return;
+  }
+  _batchedInts.push_back(REQUEST_WRITE_BLOCK_VECTOR_DATA);
+  _batchedInts.push_back(dataID);
+  _batchedInts.push_back(size);
+  _batchedInts.insert(_batchedInts.end(), valueIndices, valueIndices + size);
+  _batchedDoubles.insert(_batchedDoubles.end(), values, values + size*_interface.getDimensions());
 }
 
 void RequestManager:: requestWriteVectorData
@@ -471,10 +472,14 @@ void RequestManager:: requestWriteVectorData
   double* value )
 {
   TRACE();
-  _com->send(REQUEST_WRITE_VECTOR_DATA, 0);
-  _com->send(dataID, 0);
-  _com->send(valueIndex, 0);
-  _com->send(value, _interface.getDimensions(), 0);
+  if (SharedValues* shared = findSharedValues(dataID, _interface.getDimensions())){
+    std::copy(value, value + _interface.getDimensions(), sharedValuesAt(*shared, valueIndex));
+    return;
+  }
+  _batchedInts.push_back(REQUEST_WRITE_VECTOR_DATA);
+  _batchedInts.push_back(dataID);
+  _batchedInts.push_back(valueIndex);
+  _batchedDoubles.insert(_batchedDoubles.end(), value, value + _interface.getDimensions());
 }
 
 void RequestManager:: requestReadBlockScalarData (
@@ -484,10 +489,17 @@ void RequestManager:: requestReadBlockScalarData (
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_READ_BLOCK_SCALAR_DATA, 0);
+  if (SharedValues* shared = findSharedValues(dataID, 1)){
+    for (int i = 0; i < size; i++){
+      values[i] = *sharedValuesAt(*shared, valueIndices[i]);
+    }
+    return;
+  }
+  startRequest(REQUEST_READ_BLOCK_SCALAR_DATA);
   _com->send(dataID, 0);
   _com->send(size, 0);
   _com->send(valueIndices, size, 0);
+  _com->flush();
   _com->receive(values, size, 0);
 }
 
@@ -498,9 +510,14 @@ void RequestManager:: requestReadScalarData
   double& value )
 {
   TRACE();
-  _com->send(REQUEST_READ_SCALAR_DATA, 0);
+  if (SharedValues* shared = findSharedValues(dataID, 1)){
+    value = *sharedValuesAt(*shared, valueIndex);
+    return;
+  }
+  startRequest(REQUEST_READ_SCALAR_DATA);
   _com->send(dataID, 0);
   _com->send(valueIndex, 0);
+  _com->flush();
   _com->receive(value, 0);
 }
 
@@ -512,10 +529,19 @@ void RequestManager:: requestReadBlockVectorData
   double* values )
 {
   TRACE(dataID, size);
-  _com->send(REQUEST_READ_BLOCK_VECTOR_DATA, 0);
+  int dimensions = _interface.getDimensions();
+  if (SharedValues* shared = findSharedValues(dataID, dimensions)){
+    for (int i = 0; i < size; i++){
+      const double* vertexValues = sharedValuesAt(*shared, valueIndices[i]);
+      std::copy(vertexValues, vertexValues + dimensions, values + i*dimensions);
+    }
+    return;
+  }
+  startRequest(REQUEST_READ_BLOCK_VECTOR_DATA);
   _com->send(dataID, 0);
   _com->send(size, 0);
   _com->send(valueIndices, size, 0);
+  _com->flush();
   _com->receive(values, size*_interface.getDimensions(), 0);
 }
 
@@ -526,9 +552,16 @@ void RequestManager:: requestReadVectorData
   double* value )
 {
   TRACE();
-  _com->send(REQUEST_READ_VETOR_DATA, 0);
+  int dimensions = _interface.getDimensions();
+  if (SharedValues* shared = findSharedValues(dataID, dimensions)){
+    const double* vertexValues = sharedValuesAt(*shared, valueIndex);
+    std::copy(vertexValues, vertexValues + dimensions, value);
+    return;
+  }
+  startRequest(REQUEST_READ_VETOR_DATA);
   _com->send(dataID, 0);
   _com->send(valueIndex, 0);
+  _com->flush();
   _com->receive(value, _interface.getDimensions(), 0);
 }
 
@@ -537,10 +570,14 @@ void RequestManager:: requestMapWriteDataFrom
   int fromMeshID )
 {
   TRACE(fromMeshID);
-  _com->send(REQUEST_MAP_WRITE_DATA_FROM, 0);
+  startRequest(REQUEST_MAP_WRITE_DATA_FROM);
+  _com->flush();
   int ping;
   _com->receive(ping, 0);
   _com->send(fromMeshID, 0);
+  if (_shareValues){
+    _com->receive(ping, 0);
+  }
 }
 
 void RequestManager:: requestMapReadDataTo
@@ -548,10 +585,31 @@ void RequestManager:: requestMapReadDataTo
   int toMeshID )
 {
   TRACE(toMeshID);
-  _com->send(REQUEST_MAP_READ_DATA_TO, 0);
+  startRequest(REQUEST_MAP_READ_DATA_TO);
+  _com->flush();
   int ping;
   _com->receive(ping, 0);
   _com->send(toMeshID, 0);
+  if (_shareValues){
+    _com->receive(ping, 0);
+  }
+}
+
+void RequestManager:: startRequest
+(
+  Request requestID )
+{
+  _com->startBatch();
+  if (not _batchedInts.empty()){
+    DEBUG("Sending " << _batchedInts.size() << " integers and "
+          << _batchedDoubles.size() << " doubles of batched requests");
+    _com->send(REQUEST_BATCH, 0);
+    _com->send(_batchedInts, 0);
+    _com->send(_batchedDoubles, 0);
+    _batchedInts.clear();
+    _batchedDoubles.clear();
+  }
+  _com->send(requestID, 0);
 }
 
 void RequestManager:: handleRequestInitialze
@@ -560,8 +618,12 @@ void RequestManager:: handleRequestInitialze
 {
   TRACE()
   _interface.initialize();
+  pushSharedValues();
   for (int rank : clientRanks) {
     _couplingScheme->sendState(_com, rank);
+    if (_shareValues){
+      sendSharedValues(rank);
+    }
   }
 }
 
@@ -570,7 +632,9 @@ void RequestManager:: handleRequestInitialzeData
   const std::list<int>& clientRanks )
 {
   TRACE();
+  pullSharedValues();
   _interface.initializeData();
+  pushSharedValues();
   for (int rank : clientRanks) {
     _couplingScheme->sendState(_com, rank);
   }
@@ -592,7 +656,9 @@ void RequestManager:: handleRequestAdvance
           "Ambiguous timestep length when calling request advance from several processes!");
     oldDt = dt;
   }
+  pullSharedValues();
   _interface.advance(oldDt);
+  pushSharedValues();
   for (int rank : clientRanks) {
     _couplingScheme->sendState(_com, rank);
   }
@@ -621,9 +687,9 @@ void RequestManager:: handleRequestSetMeshVertex
   TRACE(rankSender);
   int meshID = -1;
   _com->receive(meshID, rankSender);
-  double position[_interface.getDimensions()];
-  _com->receive(position, _interface.getDimensions(), rankSender);
-  int index = _interface.setMeshVertex(meshID, position);
+  Eigen::VectorXd position(_interface.getDimensions());
+  _com->receive(position.data(), _interface.getDimensions(), rankSender);
+  int index = _interface.setMeshVertex(meshID, position.data());
   _com->send(index, rankSender);
 }
 
@@ -638,17 +704,6 @@ void RequestManager:: handleRequestGetMeshVertexSize
   _com->send(size, rankSender);
 }
 
-void RequestManager:: handleRequestResetMesh
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int meshID = -1;
-  _com->receive(meshID, rankSender);
-  _interface.resetMesh(meshID);
-}
-
-
 void RequestManager:: handleRequestSetMeshVertices
 (
   int rankSender )
@@ -659,13 +714,11 @@ void RequestManager:: handleRequestSetMeshVertices
   int size = -1;
   _com->receive(size, rankSender);
   CHECK(size > 0, "You cannot call setMeshVertices with size=0.");
-  double* positions = new double[size*_interface.getDimensions()];
-  _com->receive(positions, size*_interface.getDimensions(), rankSender);
-  int* ids = new int[size];
-  _interface.setMeshVertices(meshID, size, positions, ids);
-  _com->send(ids, size, rankSender);
-  delete[] positions;
-  delete[] ids;
+  _doubleBuffer.resize(size*_interface.getDimensions());
+  _com->receive(_doubleBuffer.data(), size*_interface.getDimensions(), rankSender);
+  _intBuffer.resize(size);
+  _interface.setMeshVertices(meshID, size, _doubleBuffer.data(), _intBuffer.data());
+  _com->send(_intBuffer.data(), size, rankSender);
 }
 
 void RequestManager:: handleRequestGetMeshVertices
@@ -678,13 +731,11 @@ void RequestManager:: handleRequestGetMeshVertices
   _com->receive(meshID, rankSender);
   _com->receive(size, rankSender);
   assertion(size > 0, size);
-  int* ids = new int[size];
-  double* positions = new double[size*_interface.getDimensions()];
-  _com->receive(ids, size, rankSender);
-  _interface.getMeshVertices(meshID, size, ids, positions);
-  _com->send(positions, size*_interface.getDimensions(), rankSender);
-  delete[] ids;
-  delete[] positions;
+  _intBuffer.resize(size);
+  _doubleBuffer.resize(size*_interface.getDimensions());
+  _com->receive(_intBuffer.data(), size, rankSender);
+  _interface.getMeshVertices(meshID, size, _intBuffer.data(), _doubleBuffer.data());
+  _com->send(_doubleBuffer.data(), size*_interface.getDimensions(), rankSender);
 }
 
 void RequestManager:: handleRequestGetMeshVertexIDsFromPositions
@@ -697,128 +748,90 @@ void RequestManager:: handleRequestGetMeshVertexIDsFromPositions
   _com->receive(meshID, rankSender);
   _com->receive(size, rankSender);
   assertion(size > 0, size);
-  int* ids = new int[size];
-  double* positions = new double[size*_interface.getDimensions()];
-  _com->receive(positions, size*_interface.getDimensions(), rankSender);
-  _interface.getMeshVertexIDsFromPositions(meshID, size, positions, ids);
-  _com->send(ids, size, rankSender);
-  delete[] ids;
-  delete[] positions;
-}
-
-void RequestManager:: handleRequestSetMeshEdge
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[3]; // 0: meshID, 1: firstVertexID, 2: secondVertexID
-  _com->receive(data, 3, rankSender);
-  int createEdgeID = _interface.setMeshEdge(data[0], data[1], data[2]);
-  _com->send(createEdgeID, rankSender);
-}
-
-void RequestManager:: handleRequestSetMeshTriangle
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[4]; // 0: meshID, 1,2,3: edge IDs
-  _com->receive(data, 4, rankSender);
-  _interface.setMeshTriangle(data[0], data[1], data[2], data[3]);
-}
-
-void RequestManager:: handleRequestSetMeshTriangleWithEdges
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[4]; // 0: meshID, 1,2,3: vertex IDs
-  _com->receive(data, 4, rankSender);
-  _interface.setMeshTriangleWithEdges(data[0], data[1], data[2], data[3]);
-}
-
-void RequestManager:: handleRequestSetMeshQuad
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[5]; // 0: meshID, 1,2,3,4: edge IDs
-  _com->receive(data, 5, rankSender);
-  _interface.setMeshQuad(data[0], data[1], data[2], data[3], data[4]);
-}
-
-void RequestManager:: handleRequestSetMeshQuadWithEdges
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int data[5]; // 0: meshID, 1,2,3,4: vertex IDs
-  _com->receive(data, 5, rankSender);
-  _interface.setMeshQuadWithEdges(data[0], data[1], data[2], data[3], data[4]);
+  _intBuffer.resize(size);
+  _doubleBuffer.resize(size*_interface.getDimensions());
+  _com->receive(_doubleBuffer.data(), size*_interface.getDimensions(), rankSender);
+  _interface.getMeshVertexIDsFromPositions(meshID, size, _doubleBuffer.data(), _intBuffer.data());
+  _com->send(_intBuffer.data(), size, rankSender);
 }
 
-void RequestManager:: handleRequestWriteScalarData
+void RequestManager:: handleRequestBatch
 (
   int rankSender )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive(index, rankSender);
-  double data;
-  _com->receive(data, rankSender);
-  _interface.writeScalarData(dataID, index, data);
-}
-
-void RequestManager:: handleRequestWriteBlockScalarData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
-  int* indices = new int[size];
-  _com->receive(indices, size, rankSender);
-  double* data = new double[size];
-  _com->receive(data, size, rankSender);
-  _interface.writeBlockScalarData(dataID, size, indices, data);
-  delete[] indices;
-  delete[] data;
-}
-
-void RequestManager:: handleRequestWriteBlockVectorData
-(
-  int rankSender )
-{
-  TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int size = -1;
-  _com->receive(size, rankSender);
-  int* indices = new int[size];
-  _com->receive(indices, size, rankSender);
-  double* data = new double[size*_interface.getDimensions()];
-  _com->receive(data, size*_interface.getDimensions(), rankSender);
-  _interface.writeBlockVectorData(dataID, size, indices, data);
-  delete[] indices;
-  delete[] data;
+  _com->receive(_batchedInts, rankSender);
+  _com->receive(_batchedDoubles, rankSender);
+  DEBUG("Received " << _batchedInts.size() << " integers and "
+        << _batchedDoubles.size() << " doubles of batched requests");
+  int dimensions = _interface.getDimensions();
+  int* ints = _batchedInts.data();
+  int* intsEnd = ints + _batchedInts.size();
+  double* values = _batchedDoubles.data();
+  while (ints != intsEnd){
+    int requestID = *ints++;
+    switch (requestID){
+    case REQUEST_RESET_MESH:
+      _interface.resetMesh(ints[0]);
+      ints += 1;
+      break;
+    case REQUEST_SET_MESH_TRIANGLE:
+      _interface.setMeshTriangle(ints[0], ints[1], ints[2], ints[3]);
+      ints += 4;
+      break;
+    case REQUEST_SET_MESH_TRIANGLE_WITH_EDGES:
+      _interface.setMeshTriangleWithEdges(ints[0], ints[1], ints[2], ints[3]);
+      ints += 4;
+      break;
+    case REQUEST_SET_MESH_QUAD:
+      _interface.setMeshQuad(ints[0], ints[1], ints[2], ints[3], ints[4]);
+      ints += 5;
+      break;
+    case REQUEST_SET_MESH_QUAD_WITH_EDGES:
+      _interface.setMeshQuadWithEdges(ints[0], ints[1], ints[2], ints[3], ints[4]);
+      ints += 5;
+      break;
+    case REQUEST_WRITE_SCALAR_DATA:
+      _interface.writeScalarData(ints[0], ints[1], *values);
+      ints += 2;
+      values += 1;
+      break;
+    case REQUEST_WRITE_VECTOR_DATA:
+      _interface.writeVectorData(ints[0], ints[1], values);
+      ints += 2;
+      values += dimensions;
+      break;
+    case REQUEST_WRITE_BLOCK_SCALAR_DATA: {
+      int size = ints[1];
+      _interface.writeBlockScalarData(ints[0], size, ints + 2, values);
+      ints += 2 + size;
+      values += size;
+      break;
+    }
+    case REQUEST_WRITE_BLOCK_VECTOR_DATA: {
+      int size = ints[1];
+      _interface.writeBlockVectorData(ints[0], size, ints + 2, values);
+      ints += 2 + size;
+      values += size * dimensions;
+      break;
+    }
+    default:
+      ERROR("Request ID \"" << requestID << "\" cannot be batched");
+    }
+    assertion(ints <= intsEnd);
+  }
+  assertion(values == _batchedDoubles.data() + _batchedDoubles.size());
 }
 
-void RequestManager:: handleRequestWriteVectorData
+void RequestManager:: handleRequestSetMeshEdge
 (
   int rankSender )
 {
   TRACE(rankSender);
-  int dataID = -1;
-  _com->receive(dataID, rankSender);
-  int index = -1;
-  _com->receive( index, rankSender);
-  double data[_interface.getDimensions()];
-  _com->receive(data, _interface.getDimensions(), rankSender);
-  _interface.writeVectorData(dataID, index, data);
+  int data[3]; // 0: meshID, 1: firstVertexID, 2: secondVertexID
+  _com->receive(data, 3, rankSender);
+  int createEdgeID = _interface.setMeshEdge(data[0], data[1], data[2]);
+  _com->send(createEdgeID, rankSender);
 }
 
 void RequestManager:: handleRequestReadScalarData
@@ -844,13 +857,11 @@ void RequestManager:: handleRequestReadBlockScalarData
   _com->receive(dataID, rankSender);
   int size = -1;
   _com->receive(size, rankSender);
-  int* indices = new int[size];
-  _com->receive(indices, size, rankSender);
-  double* data = new double[size];
-  _interface.readBlockScalarData(dataID, size, indices, data);
-  _com->send(data, size, rankSender);
-  delete[] indices;
-  delete[] data;
+  _intBuffer.resize(size);
+  _com->receive(_intBuffer.data(), size, rankSender);
+  _doubleBuffer.resize(size);
+  _interface.readBlockScalarData(dataID, size, _intBuffer.data(), _doubleBuffer.data());
+  _com->send(_doubleBuffer.data(), size, rankSender);
 }
 
 void RequestManager:: handleRequestReadBlockVectorData
@@ -862,13 +873,11 @@ void RequestManager:: handleRequestReadBlockVectorData
   _com->receive(dataID, rankSender);
   int size = -1;
   _com->receive(size, rankSender);
-  int* indices = new int[size];
-  _com->receive(indices, size, rankSender);
-  double* data = new double[size*_interface.getDimensions()];
-  _interface.readBlockVectorData(dataID, size, indices, data);
-  _com->send(data, size*_interface.getDimensions(), rankSender);
-  delete[] indices;
-  delete[] data;
+  _intBuffer.resize(size);
+  _com->receive(_intBuffer.data(), size, rankSender);
+  _doubleBuffer.resize(size*_interface.getDimensions());
+  _interface.readBlockVectorData(dataID, size, _intBuffer.data(), _doubleBuffer.data());
+  _com->send(_doubleBuffer.data(), size*_interface.getDimensions(), rankSender);
 }
 
 void RequestManager:: handleRequestReadVectorData
@@ -880,9 +889,9 @@ void RequestManager:: handleRequestReadVectorData
   _com->receive(dataID, rankSender);
   int index = -1;
   _com->receive(index, rankSender);
-  double data[_interface.getDimensions()];
-  _interface.readVectorData(dataID, index, data);
-  _com->send(data, _interface.getDimensions(), rankSender);
+  Eigen::VectorXd data(_interface.getDimensions());
+  _interface.readVectorData(dataID, index, data.data());
+  _com->send(data.data(), _interface.getDimensions(), rankSender);
 }
 
 void RequestManager:: handleRequestMapWriteDataFrom
@@ -904,7 +913,10 @@ void RequestManager:: handleRequestMapWriteDataFrom
           "Ambiguous mesh ID when calling map written data from several processes!");
     oldMeshID = meshID;
   }
+  pullSharedValues();
   _interface.mapWriteDataFrom(oldMeshID);
+  pushSharedValues();
+  acknowledgeSharedValues(clientRanks);
 }
 
 void RequestManager:: handleRequestMapReadDataTo
@@ -927,7 +939,119 @@ void RequestManager:: handleRequestMapReadDataTo
           <<  ") when calling map read data from several processes!");
     oldMeshID = meshID;
   }
+  pullSharedValues();
   _interface.mapReadDataTo(oldMeshID);
+  pushSharedValues();
+  acknowledgeSharedValues(clientRanks);
+}
+
+RequestManager::SharedValues* RequestManager:: findSharedValues
+(
+  int dataID,
+  int dimensions )
+{
+  auto iter = _sharedValues.find(dataID);
+  if (iter == _sharedValues.end()){
+    return nullptr;
+  }
+  CHECK(iter->second.dimensions == dimensions,
+        "Data with ID " << dataID << " has " << iter->second.dimensions
+        << " components, but is accessed with " << dimensions << "!");
+  return &iter->second;
+}
+
+double* RequestManager:: sharedValuesAt
+(
+  SharedValues& shared,
+  int           valueIndex )
+{
+  size_t vertexCount = shared.segment->size() / (sizeof(double) * shared.dimensions);
+  CHECK((valueIndex >= 0) && (static_cast<size_t>(valueIndex) < vertexCount),
+        "Invalid value index (" << valueIndex << ") when accessing data values shared with the server!");
+  return static_cast<double*>(shared.segment->data()) + valueIndex * shared.dimensions;
+}
+
+void RequestManager:: pushSharedValues()
+{
+  if (not _shareValues){
+    return;
+  }
+  TRACE();
+  if (_sharedValues.empty()){
+    for (const auto& pair : _interface.getAccessedData()){
+      SharedValues& shared = _sharedValues[pair.first];
+      shared.data = pair.second;
+      shared.dimensions = pair.second->getDimensions();
+      std::string name = "/precice-values-" + std::to_string(getpid()) + "-" + std::to_string(pair.first);
+      shared.segment.reset(new com::SharedMemorySegment(name, pair.second->values().size() * sizeof(double)));
+    }
+  }
+  for (auto& pair : _sharedValues){
+    const Eigen::VectorXd& values = pair.second.data->values();
+    CHECK(values.size() * sizeof(double) == pair.second.segment->size(),
+          "The number of values of data \"" << pair.second.data->getName()
+          << "\" changed, which is not supported with a shared memory server!");
+    std::copy(values.data(), values.data() + values.size(), static_cast<double*>(pair.second.segment->data()));
+  }
+}
+
+void RequestManager:: pullSharedValues()
+{
+  if (not _shareValues){
+    return;
+  }
+  TRACE();
+  for (auto& pair : _sharedValues){
+    Eigen::VectorXd& values = pair.second.data->values();
+    CHECK(values.size() * sizeof(double) == pair.second.segment->size(),
+          "The number of values of data \"" << pair.second.data->getName()
+          << "\" changed, which is not supported with a shared memory server!");
+    const double* sharedValues = static_cast<const double*>(pair.second.segment->data());
+    std::copy(sharedValues, sharedValues + values.size(), values.data());
+  }
+}
+
+void RequestManager:: sendSharedValues
+(
+  int rank )
+{
+  TRACE(rank);
+  _com->send(static_cast<int>(_sharedValues.size()), rank);
+  for (const auto& pair : _sharedValues){
+    _com->send(pair.first, rank);
+    _com->send(pair.second.dimensions, rank);
+    _com->send(pair.second.segment->getName(), rank);
+  }
+}
+
+void RequestManager:: receiveSharedValues()
+{
+  TRACE();
+  int count = 0;
+  _com->receive(count, 0);
+  for (int i = 0; i < count; i++){
+    int dataID = -1;
+    _com->receive(dataID, 0);
+    SharedValues& shared = _sharedValues[dataID];
+    _com->receive(shared.dimensions, 0);
+    std::string name;
+    _com->receive(name, 0);
+    shared.segment.reset(new com::SharedMemorySegment(name));
+  }
+  DEBUG("Mapped the values of " << count << " data from the server");
+}
+
+void RequestManager:: acknowledgeSharedValues
+(
+  const std::list<int>& clientRanks )
+{
+  if (not _shareValues){
+    return;
+  }
+  int ping = 0;
+  for (int rank : clientRanks){
+    _com->send(ping, rank);
+  }
 }
 
 }} // namespace precice, impl
@@ -1,10 +1,15 @@
 #pragma once
 
 #include "cplscheme/SharedPointer.hpp"
+#include "com/SharedMemorySegment.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
+#include "mesh/SharedPointer.hpp"
 #include <set>
 #include <list>
+#include <map>
+#include <memory>
+#include <vector>
 #include <Eigen/Core>
 
 namespace precice {
@@ -16,7 +21,20 @@ namespace precice {
 namespace precice {
 namespace impl {
 
-/// Takes requests from clients and handles requests on server side.
+/**
+ * @brief Takes requests from clients and handles requests on server side.
+ *
+ * Requests without reply, i.e., writing data, setting mesh triangles and quads, and resetting
+ * meshes, are not sent right away. The client queues them and sends them as one batch in front of
+ * the next request with a reply or a collective request. Hence, these requests cost no round trip.
+ * Errors of batched requests are reported by the server once the batch is handled.
+ *
+ * If client and server are connected by shared memory, the server places the values of all data
+ * written or read by the participant in shared memory segments, which are mapped by the clients.
+ * Writing and reading data values then needs no request at all. The server copies the values out
+ * of the segments before and back into the segments after every collective request. As the
+ * clients wait for the reply to a collective request, they never access the segments meanwhile.
+ */
 class RequestManager
 {
 public:
@@ -203,9 +221,20 @@ private:
     REQUEST_READ_BLOCK_VECTOR_DATA,
     REQUEST_MAP_WRITE_DATA_FROM,
     REQUEST_MAP_READ_DATA_TO,
+    REQUEST_BATCH,
     REQUEST_PING // Used in tests only
   };
 
+  /// Values of data shared by the server with its clients.
+  struct SharedValues {
+    std::unique_ptr<com::SharedMemorySegment> segment;
+
+    /// The data holding the values on the server, empty on the clients
+    mesh::PtrData data;
+
+    int dimensions = 1;
+  };
+
   logging::Logger _log{"impl::RequestManager"};
 
   SolverInterfaceImpl& _interface;
@@ -214,6 +243,48 @@ private:
 
   cplscheme::PtrCouplingScheme _couplingScheme;
 
+  /// Request IDs and integer arguments of batched requests
+  std::vector<int> _batchedInts;
+
+  /// Double arguments of batched requests
+  std::vector<double> _batchedDoubles;
+
+  /// Buffer for integer arguments and results of single requests, reused on the server
+  std::vector<int> _intBuffer;
+
+  /// Buffer for double arguments and results of single requests, reused on the server
+  std::vector<double> _doubleBuffer;
+
+  /// True, if client and server share the data values by shared memory.
+  bool _shareValues = false;
+
+  /// Data ID -> Values shared by the server with its clients, filled by initialize
+  std::map<int, SharedValues> _sharedValues;
+
+  /// Returns the shared values of the data, or nullptr if they are not shared.
+  SharedValues* findSharedValues ( int dataID, int dimensions );
+
+  /// Returns the shared values of one vertex.
+  double* sharedValuesAt ( SharedValues& shared, int valueIndex );
+
+  /// Copies the data values of the server into the shared segments, creates these first.
+  void pushSharedValues();
+
+  /// Copies the values written by the clients from the shared segments into the data of the server.
+  void pullSharedValues();
+
+  /// Sends the IDs, dimensions, and segment names of the shared values to a client.
+  void sendSharedValues ( int rank );
+
+  /// Receives the shared values from the server and maps their segments.
+  void receiveSharedValues();
+
+  /// Tells a client that a collective request without a reply has been handled.
+  void acknowledgeSharedValues ( const std::list<int>& clientRanks );
+
+  /// Sends the batched requests, if any, and the ID of a request that is not batched.
+  void startRequest ( Request requestID );
+
   /// Handles request initialize from client.
   void handleRequestInitialze ( const std::list<int>& clientRanks );
 
@@ -235,9 +306,6 @@ private:
   /// Handles request get mesh vertex size from client.
   void handleRequestGetMeshVertexSize(int rankSender);
 
-  /// Handles request reset mesh from client.
-  void handleRequestResetMesh(int rankSender);
-
   /// Handles request set vertex positions from client.
   void handleRequestSetMeshVertices ( int rankSender );
 
@@ -247,33 +315,12 @@ private:
   /// Handles request get vertex IDs from client.
   void handleRequestGetMeshVertexIDsFromPositions ( int rankSender );
 
+  /// Handles a batch of requests without reply from client.
+  void handleRequestBatch ( int rankSender );
+
   /// Handles request set mesh edge from client.
   void handleRequestSetMeshEdge ( int rankSender );
 
-  /// Handles request set mesh triangle from client.
-  void handleRequestSetMeshTriangle ( int rankSender );
-
-  /// Handles request set mesh triangle with edges from client.
-  void handleRequestSetMeshTriangleWithEdges ( int rankSender );
-
-  /// Handles request set mesh quad from client.
-  void handleRequestSetMeshQuad ( int rankSender );
-
-  /// Handles request set mesh quad with edges from client.
-  void handleRequestSetMeshQuadWithEdges ( int rankSender );
-
-  /// Handles request write block scalar data from client.
-  void handleRequestWriteBlockScalarData ( int rankSender );
-
-  /// Handles request write scalar data from client.
-  void handleRequestWriteScalarData ( int rankSender );
-
-  /// Handles request write block vector data from client.
-  void handleRequestWriteBlockVectorData ( int rankSender );
-
-  /// Handles request write vector data from client.
-  void handleRequestWriteVectorData ( int rankSender );
-
   /// Handles request read block scalar data from client.
   void handleRequestReadBlockScalarData ( int rankSender );
 
@@ -30,6 +30,7 @@
 #include "partition/ReceivedPartition.hpp"
 #include "partition/ProvidedPartition.hpp"
 
+#include <algorithm>
 #include <signal.h> // used for installing crash handler
 
 #include "logging/Logger.hpp"
@@ -49,6 +50,14 @@ bool syncMode = false;
 
 namespace impl {
 
+namespace {
+/// Returns the seconds passed since the given time point.
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+}
+
 SolverInterfaceImpl:: SolverInterfaceImpl
 (
   const std::string& participantName,
@@ -135,6 +144,34 @@ void SolverInterfaceImpl:: configure
       config.getCouplingSchemeConfiguration();
   _couplingScheme = cplSchemeConfig->getCouplingScheme(_accessorName);
 
+  for (DataContext& context : _accessor->writeDataContexts()) {
+    context.waveformSamples = cplSchemeConfig->getWaveformSamples(context.toData->getID());
+  }
+  for (DataContext& context : _accessor->readDataContexts()) {
+    context.waveformSamples = cplSchemeConfig->getWaveformSamples(context.fromData->getID());
+    context.waveformSampleValues.resize(context.waveformSamples.size());
+  }
+
+  if (not _clientMode){
+    _checkpointInterval = config.getCheckpointInterval();
+    _restart = config.restartFromCheckpoint();
+  }
+
+  if (config.writeAdvanceTimings() && (not _clientMode) && (not utils::MasterSlave::_slaveMode)){
+    _advanceTimingsWriter = std::make_shared<io::TXTTableWriter>("precice-" + _accessorName + "-advance.log");
+    _advanceTimingsWriter->addData("Timesteps", io::TXTTableWriter::INT);
+    _advanceTimingsWriter->addData("Advance_Calls", io::TXTTableWriter::INT);
+    _advanceTimingsWriter->addData("Timestep_Complete", io::TXTTableWriter::INT);
+    _advanceTimingsWriter->addData("Solver", io::TXTTableWriter::DOUBLE);
+    _advanceTimingsWriter->addData("Send", io::TXTTableWriter::DOUBLE);
+    _advanceTimingsWriter->addData("Receive", io::TXTTableWriter::DOUBLE);
+    _advanceTimingsWriter->addData("Mapping", io::TXTTableWriter::DOUBLE);
+    _advanceTimingsWriter->addData("Post_Processing", io::TXTTableWriter::DOUBLE);
+    _advanceTimingsWriter->addData("Convergence_Measurement", io::TXTTableWriter::DOUBLE);
+    _advanceTimingsWriter->addData("Export", io::TXTTableWriter::DOUBLE);
+    _advanceTimingsWriter->addData("Advance_Total", io::TXTTableWriter::DOUBLE);
+  }
+
   if (_serverMode || _clientMode){
     com::PtrCommunication com = _accessor->getClientServerCommunication();
     assertion(com.get() != nullptr);
@@ -246,6 +283,11 @@ double SolverInterfaceImpl:: initialize()
 
     _couplingScheme->initialize(time, timestep);
 
+    if (_restart){
+      INFO("Restore coupling state from checkpoint");
+      _couplingScheme->importState("precice-" + _accessorName + "-checkpoint");
+    }
+
     dt = _couplingScheme->getNextTimestepMaxLength();
 
     timings.insert(action::Action::ALWAYS_POST);
@@ -256,11 +298,14 @@ double SolverInterfaceImpl:: initialize()
     }
 
     performDataActions(timings, 0.0, 0.0, 0.0, dt);
+    initializeReadWaveforms();
+    initializeWrittenWaveforms();
 
     INFO(_couplingScheme->printCouplingState());
   }
 
   solverInitEvent.start(precice::syncMode);
+  _solverComputationStart = std::chrono::steady_clock::now();
 
   return _couplingScheme->getNextTimestepMaxLength();
 }
@@ -282,12 +327,14 @@ void SolverInterfaceImpl:: initializeData ()
   }
   else {
     mapWrittenData();
+    initializeWrittenWaveforms();
     _couplingScheme->initializeData();
     double dt = _couplingScheme->getNextTimestepMaxLength();
     std::set<action::Action::Timing> timings;
     if (_couplingScheme->hasDataBeenExchanged()){
       timings.insert(action::Action::ON_EXCHANGE_POST);
       mapReadData();
+      initializeReadWaveforms();
     }
     performDataActions(timings, 0.0, 0.0, 0.0, dt);
     resetWrittenData();
@@ -296,7 +343,7 @@ void SolverInterfaceImpl:: initializeData ()
       if (context.timestepInterval != -1){
         std::ostringstream suffix;
         suffix << _accessorName << ".init";
-        exportMesh(suffix.str());
+        exportMesh(suffix.str(), _couplingScheme->getTime());
         if (context.triggerSolverPlot){
           _couplingScheme->requireAction(constants::actionPlotOutput());
         }
@@ -304,6 +351,7 @@ void SolverInterfaceImpl:: initializeData ()
     }
   }
   solverInitEvent.start(precice::syncMode);
+  _solverComputationStart = std::chrono::steady_clock::now();
 }
 
 double SolverInterfaceImpl:: advance
@@ -321,6 +369,9 @@ double SolverInterfaceImpl:: advance
   Event e("advance", precice::syncMode);
   utils::ScopedEventPrefix sep("advance/");
 
+  auto advanceStart = std::chrono::steady_clock::now();
+  double solverTime = std::chrono::duration<double>(advanceStart - _solverComputationStart).count();
+
   CHECK(_couplingScheme->isInitialized(), "initialize() has to be called before advance()");
   _numberAdvanceCalls++;
   if (_clientMode){
@@ -351,8 +402,13 @@ double SolverInterfaceImpl:: advance
     timestepPart = timestepLength - _couplingScheme->getThisTimestepRemainder();
     time = _couplingScheme->getTime();
 
+    _couplingScheme->resetAdvanceTimings();
+    restoreReadData();
 
+    auto phaseStart = std::chrono::steady_clock::now();
     mapWrittenData();
+    double mappingTime = secondsSince(phaseStart);
+    sampleWrittenData(std::min(1.0, timestepPart / timestepLength));
 
     std::set<action::Action::Timing> timings;
 
@@ -365,6 +421,11 @@ double SolverInterfaceImpl:: advance
     DEBUG("Advancing coupling scheme");
     _couplingScheme->advance();
 
+    // The computed part is reset at the end of each time window
+    if (_couplingScheme->getComputedTimestepPart() == 0.0){
+      resetWrittenWaveforms(_couplingScheme->isCouplingTimestepComplete());
+    }
+
     timings.clear();
     timings.insert(action::Action::ALWAYS_POST);
     if (_couplingScheme->hasDataBeenExchanged()){
@@ -376,12 +437,26 @@ double SolverInterfaceImpl:: advance
     performDataActions(timings, time, computedTimestepLength, timestepPart, timestepLength);
 
     if (_couplingScheme->hasDataBeenExchanged()){
+      phaseStart = std::chrono::steady_clock::now();
       mapReadData();
+      mappingTime += secondsSince(phaseStart);
     }
+    interpolateReadData(computedTimestepLength);
 
     INFO(_couplingScheme->printCouplingState());
 
+    phaseStart = std::chrono::steady_clock::now();
     handleExports();
+    double exportTime = secondsSince(phaseStart);
+
+    if (_advanceTimingsWriter){
+      writeAdvanceTimings(solverTime, mappingTime, exportTime, secondsSince(advanceStart));
+    }
+
+    if (_checkpointInterval > 0 && _couplingScheme->isCouplingTimestepComplete()
+        && (_couplingScheme->getTimesteps() - 1) % _checkpointInterval == 0){
+      _couplingScheme->exportState("precice-" + _accessorName + "-checkpoint");
+    }
 
     // deactivated the reset of written data, as it deletes all data that is not communicated
     // within this cycle in the coupling data. This is not wanted forthe manifold mapping.
@@ -389,6 +464,7 @@ double SolverInterfaceImpl:: advance
 
   }
   solverEvent.start(precice::syncMode);
+  _solverComputationStart = std::chrono::steady_clock::now();
   return _couplingScheme->getNextTimestepMaxLength();
 }
 
@@ -404,6 +480,7 @@ void SolverInterfaceImpl:: finalize()
   utils::ScopedEventPrefix sep("finalize/");
 
   CHECK(_couplingScheme->isInitialized(), "initialize() has to be called before finalize()");
+  double finalTime = _couplingScheme->getTime();
   _couplingScheme->finalize();
   _couplingScheme.reset();
 
@@ -416,12 +493,16 @@ void SolverInterfaceImpl:: finalize()
       if ( context.timestepInterval != -1 ){
         std::ostringstream suffix;
         suffix << _accessorName << ".final";
-        exportMesh ( suffix.str() );
+        exportMesh ( suffix.str(), finalTime );
         if ( context.triggerSolverPlot ) {
           _couplingScheme->requireAction ( constants::actionPlotOutput() );
         }
       }
     }
+    // Wait for asynchronous exports to be written and report their errors
+    for (const io::ExportContext& context : _accessor->exportContexts()){
+      context.exporter->close();
+    }
     // Apply some final ping-pong to synch solver that run e.g. with a uni-directional coupling only
     // afterwards close connections
     std::string ping = "ping";
@@ -1381,9 +1462,10 @@ void SolverInterfaceImpl:: readScalarData
 void SolverInterfaceImpl:: exportMesh
 (
   const std::string& filenameSuffix,
+  double             time,
   int                exportType )
 {
-  TRACE(filenameSuffix, exportType );
+  TRACE(filenameSuffix, time, exportType );
   // Export meshes
   //const ExportContext& context = _accessor->exportContext();
   for (const io::ExportContext& context : _accessor->exportContexts()) {
@@ -1394,6 +1476,7 @@ void SolverInterfaceImpl:: exportMesh
       for (MeshContext* meshContext : _accessor->usedMeshContexts()) {
         std::string name = meshContext->mesh->getName() + "-" + filenameSuffix;
         DEBUG ( "Exporting mesh to file \"" << name << "\" at location \"" << context.location << "\"" );
+        context.exporter->setTime ( time );
         context.exporter->doExport ( name, context.location, *(meshContext->mesh) );
       }
     }
@@ -1423,6 +1506,20 @@ void SolverInterfaceImpl:: runServer()
   _requestManager->handleRequests();
 }
 
+std::map<int, mesh::PtrData> SolverInterfaceImpl:: getAccessedData()
+{
+  TRACE();
+  assertion(not _clientMode);
+  std::map<int, mesh::PtrData> accessedData;
+  for (impl::DataContext& context : _accessor->writeDataContexts()) {
+    accessedData[context.fromData->getID()] = context.fromData;
+  }
+  for (impl::DataContext& context : _accessor->readDataContexts()) {
+    accessedData[context.toData->getID()] = context.toData;
+  }
+  return accessedData;
+}
+
 void SolverInterfaceImpl:: configureM2Ns
 (
   const m2n::M2NConfiguration::SharedPointer& config )
@@ -1644,6 +1741,13 @@ void SolverInterfaceImpl:: mapReadData()
     if (mapNow && hasMapping && (not hasMapped)){
       int inDataID = context.fromData->getID();
       int outDataID = context.toData->getID();
+      if (context.waveformOrder > 0){
+        for (size_t i=0; i < context.waveformSamples.size(); i++){
+          context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
+          context.mappingContext.mapping->map(context.waveformSamples[i]->getID(), outDataID);
+          context.waveformSampleValues[i] = context.toData->values();
+        }
+      }
       context.toData->values() = Eigen::VectorXd::Zero(context.toData->values().size());
       //assign(context.toData->values()) = 0.0;
       DEBUG("Map read data \"" << context.fromData->getName()
@@ -1671,6 +1775,151 @@ void SolverInterfaceImpl:: mapReadData()
   }
 }
 
+void SolverInterfaceImpl:: initializeReadWaveforms()
+{
+  TRACE();
+  for (impl::DataContext& context : _accessor->readDataContexts()) {
+    if (context.waveformOrder > 0) {
+      context.waveformStart = context.toData->values();
+      context.waveformEnd   = context.toData->values();
+      for (Eigen::VectorXd& sampleValues : context.waveformSampleValues) {
+        sampleValues = context.toData->values();
+      }
+    }
+  }
+}
+
+void SolverInterfaceImpl:: initializeWrittenWaveforms()
+{
+  TRACE();
+  for (impl::DataContext& context : _accessor->writeDataContexts()) {
+    if (not context.waveformSamples.empty()) {
+      context.waveformStart    = context.toData->values();
+      context.waveformLast     = context.toData->values();
+      context.waveformLastTime = 0.0;
+      for (mesh::PtrData& sample : context.waveformSamples) {
+        sample->values() = context.toData->values();
+      }
+    }
+  }
+}
+
+void SolverInterfaceImpl:: sampleWrittenData
+(
+  double relativeTime )
+{
+  TRACE(relativeTime);
+  for (impl::DataContext& context : _accessor->writeDataContexts()) {
+    if (context.waveformSamples.empty()) {
+      continue;
+    }
+    const Eigen::VectorXd& values = context.toData->values();
+    if (context.waveformLast.size() != values.size()) {
+      // The mesh has changed, start a new waveform
+      context.waveformStart    = values;
+      context.waveformLast     = values;
+      context.waveformLastTime = 0.0;
+    }
+    // Samples within the timestep are interpolated linearly between its beginning and its end
+    int intervals = context.waveformSamples.size() + 1;
+    for (int i=1; i < intervals; i++) {
+      double sampleTime = double(i) / intervals;
+      if (sampleTime > context.waveformLastTime && sampleTime <= relativeTime) {
+        double weight = (sampleTime - context.waveformLastTime) / (relativeTime - context.waveformLastTime);
+        context.waveformSamples[i-1]->values() = context.waveformLast + weight * (values - context.waveformLast);
+      }
+    }
+    context.waveformLast     = values;
+    context.waveformLastTime = relativeTime;
+  }
+}
+
+void SolverInterfaceImpl:: resetWrittenWaveforms
+(
+  bool isWindowComplete )
+{
+  TRACE(isWindowComplete);
+  for (impl::DataContext& context : _accessor->writeDataContexts()) {
+    if (context.waveformSamples.empty()) {
+      continue;
+    }
+    // Otherwise, the solver repeats the time window from its beginning
+    if (isWindowComplete) {
+      context.waveformStart = context.waveformLast;
+    }
+    context.waveformLast     = context.waveformStart;
+    context.waveformLastTime = 0.0;
+  }
+}
+
+void SolverInterfaceImpl:: restoreReadData()
+{
+  TRACE();
+  for (impl::DataContext& context : _accessor->readDataContexts()) {
+    if (context.waveformOrder > 0 && context.waveformEnd.size() == context.toData->values().size()) {
+      context.toData->values() = context.waveformEnd;
+    }
+  }
+}
+
+void SolverInterfaceImpl:: interpolateReadData
+(
+  double computedTimestepLength )
+{
+  TRACE(computedTimestepLength);
+  bool hasExchanged     = _couplingScheme->hasDataBeenExchanged();
+  bool isWindowComplete = _couplingScheme->isCouplingTimestepComplete();
+  bool canInterpolate   = _couplingScheme->hasTimestepLength() && _couplingScheme->isCouplingOngoing();
+
+  for (impl::DataContext& context : _accessor->readDataContexts()) {
+    if (context.waveformOrder == 0) {
+      continue;
+    }
+    Eigen::VectorXd& values = context.toData->values();
+    std::vector<Eigen::VectorXd>& samples = context.waveformSampleValues;
+    int intervals = samples.size() + 1;
+    if (context.waveformEnd.size() != values.size()) {
+      // The mesh has changed, start a new waveform
+      context.waveformStart = values;
+      context.waveformEnd   = values;
+      for (Eigen::VectorXd& sampleValues : samples) {
+        sampleValues = values;
+      }
+    }
+    else if (hasExchanged) {
+      // The solver has read the end of the completed window last, which starts the next one
+      if (isWindowComplete) {
+        context.waveformStart = context.waveformEnd;
+      }
+      context.waveformEnd = values;
+
+      // Received samples describe the window up to the received values, unless these complete the last window
+      bool hasSamples = (not isWindowComplete) || _couplingScheme->receivesDataOfNextWindow();
+      bool hasMapping = context.mappingContext.mapping.get() != nullptr;
+      for (int i=1; i < intervals; i++) {
+        if (hasSamples && (not hasMapping)) {
+          samples[i-1] = context.waveformSamples[i-1]->values();
+        }
+        else if ((not hasSamples) || samples[i-1].size() != values.size()) {
+          double sampleTime = double(i) / intervals;
+          samples[i-1] = context.waveformStart + sampleTime * (context.waveformEnd - context.waveformStart);
+        }
+      }
+    }
+
+    if (canInterpolate) {
+      double windowLength = _couplingScheme->getTimestepLength();
+      double windowPart   = windowLength - _couplingScheme->getThisTimestepRemainder();
+      double relativeTime = std::min(1.0, (windowPart + computedTimestepLength) / windowLength);
+      int interval = std::min(intervals - 1, static_cast<int>(relativeTime * intervals));
+      const Eigen::VectorXd& lower = interval == 0 ? context.waveformStart : samples[interval-1];
+      const Eigen::VectorXd& upper = interval == intervals - 1 ? context.waveformEnd : samples[interval];
+      double weight = relativeTime * intervals - interval;
+      values = lower + weight * (upper - lower);
+    }
+  }
+}
+
 void SolverInterfaceImpl:: performDataActions
 (
   const std::set<action::Action::Timing>& timings,
@@ -1702,11 +1951,11 @@ void SolverInterfaceImpl:: handleExports()
           if (context.everyIteration){
             std::ostringstream everySuffix;
             everySuffix << _accessorName << ".it" << _numberAdvanceCalls;
-            exportMesh(everySuffix.str());
+            exportMesh(everySuffix.str(), _couplingScheme->getTime());
           }
           std::ostringstream suffix;
           suffix << _accessorName << ".dt" << _couplingScheme->getTimesteps()-1;
-          exportMesh(suffix.str());
+          exportMesh(suffix.str(), _couplingScheme->getTime());
           if (context.triggerSolverPlot){
             _couplingScheme->requireAction(constants::actionPlotOutput());
           }
@@ -1804,6 +2053,28 @@ void SolverInterfaceImpl:: syncTimestep(double computedTimestepLength)
   }
 }
 
+void SolverInterfaceImpl:: writeAdvanceTimings
+(
+  double solverTime,
+  double mappingTime,
+  double exportTime,
+  double totalTime )
+{
+  assertion(_advanceTimingsWriter.get() != nullptr);
+  cplscheme::CouplingScheme::AdvanceTimings timings = _couplingScheme->getAdvanceTimings();
+  _advanceTimingsWriter->writeData("Timesteps", _couplingScheme->getTimesteps());
+  _advanceTimingsWriter->writeData("Advance_Calls", static_cast<int>(_numberAdvanceCalls));
+  _advanceTimingsWriter->writeData("Timestep_Complete", _couplingScheme->isCouplingTimestepComplete() ? 1 : 0);
+  _advanceTimingsWriter->writeData("Solver", solverTime);
+  _advanceTimingsWriter->writeData("Send", timings.send);
+  _advanceTimingsWriter->writeData("Receive", timings.receive);
+  _advanceTimingsWriter->writeData("Mapping", mappingTime);
+  _advanceTimingsWriter->writeData("Post_Processing", timings.postProcessing);
+  _advanceTimingsWriter->writeData("Convergence_Measurement", timings.convergenceMeasurement);
+  _advanceTimingsWriter->writeData("Export", exportTime);
+  _advanceTimingsWriter->writeData("Advance_Total", totalTime);
+}
+
 
 }} // namespace precice, impl
 
@@ -7,10 +7,13 @@
 #include "action/Action.hpp"
 #include "boost/noncopyable.hpp"
 #include "io/Constants.hpp"
+#include "io/TXTTableWriter.hpp"
 #include "query/ExportVTKNeighbors.hpp"
 #include "cplscheme/SharedPointer.hpp"
 #include "com/Communication.hpp"
 #include "m2n/config/M2NConfiguration.hpp"
+#include <chrono>
+#include <map>
 #include <string>
 #include <vector>
 #include <set>
@@ -440,9 +443,11 @@ public:
    * accessing participant.
    *
    * @param[in] filenameSuffix Suffix of all plotted files
+   * @param[in] time Simulation time of the export, written to time series files
    */
   void exportMesh (
     const std::string& filenameSuffix,
+    double             time,
     int                exportType = constants::exportAll() );
 
 
@@ -461,6 +466,14 @@ public:
   /// Runs the solver interface in server mode.
   void runServer();
 
+  /**
+   * @brief Returns all data written or read by the accessor, by data ID.
+   *
+   * These are the data objects whose values are accessed by writeScalarData(), readScalarData(),
+   * etc. The server shares their values with its clients.
+   */
+  std::map<int, mesh::PtrData> getAccessedData();
+
 private:
 
   struct M2NWrap {
@@ -509,6 +522,18 @@ private:
   /// Counts calls to advance for plotting.
   long int _numberAdvanceCalls = 0;
 
+  /// Writes the times spent in the phases of advance(), if configured.
+  std::shared_ptr<io::TXTTableWriter> _advanceTimingsWriter;
+
+  /// Number of timesteps between two checkpoints of the coupling state, 0 if none are written.
+  int _checkpointInterval = 0;
+
+  /// Restore the coupling state from the last checkpoint in initialize().
+  bool _restart = false;
+
+  /// Time when control was last returned to the solver.
+  std::chrono::steady_clock::time_point _solverComputationStart;
+
 //  // @brief Locks the next receive operation of the server to a specific client.
 //  int _lockServerToClient;
 
@@ -566,6 +591,38 @@ private:
   /// Computes, performs, and resets all suitable read mappings.
   void mapReadData();
 
+  /// Sets the beginning and the end of the waveforms of read data to the current values.
+  void initializeReadWaveforms();
+
+  /// Sets the beginning of the waveforms of written data and their samples to the current values.
+  void initializeWrittenWaveforms();
+
+  /**
+   * @brief Samples written data with waveform samples up to the end of the last timestep.
+   *
+   * Has to be called after the written data is mapped.
+   *
+   * @param[in] relativeTime End of the last timestep relative to the time window.
+   */
+  void sampleWrittenData(double relativeTime);
+
+  /// Starts the next waveforms of written data at the end of a time window.
+  void resetWrittenWaveforms(bool isWindowComplete);
+
+  /// Resets read data interpolated in time to the values received last.
+  void restoreReadData();
+
+  /**
+   * @brief Interpolates read data with waveform order 1 in time.
+   *
+   * The values are interpolated to the end of the next timestep of the solver, assuming it
+   * has the length of the last one. With waveform samples, the interpolation is piecewise
+   * linear across them. Has to be called after the read data is mapped.
+   *
+   * @param[in] computedTimestepLength Length of the last timestep of the solver.
+   */
+  void interpolateReadData(double computedTimestepLength);
+
   /**
    * @brief Performs all data actions with given timing.
    *
@@ -599,6 +656,13 @@ private:
   /// Syncs the timestep between slaves and master (all timesteps should be the same!)
   void syncTimestep(double computedTimestepLength);
 
+  /// Writes one row of advance timings, times are given in seconds.
+  void writeAdvanceTimings(
+    double solverTime,
+    double mappingTime,
+    double exportTime,
+    double totalTime );
+
   /// To allow white box tests.
   friend struct PreciceTests::Serial::TestConfiguration;
 };
@@ -268,7 +268,7 @@ BOOST_AUTO_TEST_CASE(CouplingOnLine, * testing::OnSize(4))
 }
 
 
-/// tests for various QN settings if correct number of iterations is returned
+/// tests for various QN settings if the coupling iterations converge within the expected number
 BOOST_AUTO_TEST_CASE(TestQN, * testing::OnSize(4))
 {
   int numberOfTests = 3;
@@ -278,7 +278,10 @@ BOOST_AUTO_TEST_CASE(TestQN, * testing::OnSize(4))
   configs[1] = _pathToTests + "QN2.xml";
   configs[2] = _pathToTests + "QN3.xml";
 
-  int correctIterations[3] = {29, 17, 15};
+  // The filters remove columns of V depending on the round-off of the scaled residuals, which
+  // can change the number of iterations, e.g., if the scaling is folded into Q^T*r. Hence, only
+  // the number of iterations with the scaling applied to the residual in place is an upper bound.
+  int maxIterations[3] = {29, 17, 15};
 
   std::string solverName, meshName, writeDataName, readDataName;
   int rank, size;
@@ -369,7 +372,8 @@ BOOST_AUTO_TEST_CASE(TestQN, * testing::OnSize(4))
       }
     }
     interface.finalize();
-    BOOST_TEST(iterations == correctIterations[k]);
+    BOOST_TEST(iterations > 0);
+    BOOST_TEST(iterations <= maxIterations[k]);
   }
 }
 
@@ -489,6 +493,76 @@ BOOST_AUTO_TEST_CASE(testDistributedCommunications, * testing::OnSize(4))
   }
 }
 
+/// Exchanges several data fields concurrently between a parallel controller and a parallel partner.
+BOOST_AUTO_TEST_CASE(MultiCouplingConcurrentExchange, * testing::OnSize(4))
+{
+  std::string writeIterCheckpoint(constants::actionWriteIterationCheckpoint());
+  std::string readIterCheckpoint(constants::actionReadIterationCheckpoint());
+
+  std::vector<Eigen::Vector3d> positions;
+  std::vector<Eigen::Vector3d> data;
+  for (int i=0; i<4; i++){
+    positions.push_back(Eigen::Vector3d(i*1.0, 0.0, 0.0));
+    data.push_back(Eigen::Vector3d(i*1.0, i*1.0, 1.0));
+  }
+
+  bool isFluid = utils::Parallel::getProcessRank() <= 1;
+  int rank = isFluid ? utils::Parallel::getProcessRank() : utils::Parallel::getProcessRank() - 2;
+  int i1 = -1, i2 = -1; //indices for data and positions
+  if (isFluid){
+    i1 = rank == 0 ? 0 : 2;
+    i2 = rank == 0 ? 2 : 4;
+  }
+  else {
+    i1 = rank == 0 ? 0 : 1;
+    i2 = rank == 0 ? 1 : 4;
+  }
+
+  SolverInterface precice(isFluid ? "Fluid" : "Structure", rank, 2);
+  config::Configuration config;
+  xml::configure(config.getXMLTag(), _pathToTests + "multi-concurrent-exchange.xml");
+  precice._impl->configure(config.getSolverInterfaceConfiguration());
+  int meshID = precice.getMeshID(isFluid ? "FluidMesh" : "StructureMesh");
+  int forcesID = precice.getDataID("Forces", meshID);
+  int pressuresID = precice.getDataID("Pressures", meshID);
+  int velocitiesID = precice.getDataID("Velocities", meshID);
+  int displacementsID = precice.getDataID("Displacements", meshID);
+
+  std::vector<int> vertexIDs;
+  for (int i=i1; i<i2; i++){
+    vertexIDs.push_back(precice.setMeshVertex(meshID, positions[i].data()));
+  }
+
+  precice.initialize();
+
+  for (size_t i=0; i<vertexIDs.size(); i++){
+    Eigen::Vector3d first = data[i+i1];
+    Eigen::Vector3d second = 2.0 * data[i+i1];
+    precice.writeVectorData(isFluid ? forcesID : velocitiesID, vertexIDs[i], first.data());
+    precice.writeVectorData(isFluid ? pressuresID : displacementsID, vertexIDs[i], second.data());
+  }
+
+  if (precice.isActionRequired(writeIterCheckpoint)){
+    precice.fulfilledAction(writeIterCheckpoint);
+  }
+  precice.advance(1.0);
+  if (precice.isActionRequired(readIterCheckpoint)){
+    precice.fulfilledAction(readIterCheckpoint);
+  }
+
+  for (size_t i=0; i<vertexIDs.size(); i++){
+    Eigen::Vector3d first, second;
+    precice.readVectorData(isFluid ? velocitiesID : forcesID, vertexIDs[i], first.data());
+    precice.readVectorData(isFluid ? displacementsID : pressuresID, vertexIDs[i], second.data());
+    for (int d=0; d<3; d++){
+      BOOST_TEST(first[d] == data[i+i1][d]);
+      BOOST_TEST(second[d] == 2.0 * data[i+i1][d]);
+    }
+  }
+
+  precice.finalize();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 #endif // PRECICE_NO_MPI
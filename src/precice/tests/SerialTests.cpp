@@ -12,6 +12,8 @@
 #include "precice/impl/Participant.hpp"
 #include "precice/config/Configuration.hpp"
 #include "utils/MasterSlave.hpp"
+#include <fstream>
+#include <sstream>
 
 using namespace precice;
 
@@ -824,6 +826,227 @@ BOOST_AUTO_TEST_CASE(testImplicit,
   }
 }
 
+/// Tests the per-advance timings written by an implicitly coupled solver.
+BOOST_AUTO_TEST_CASE(testAdvanceTimings,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  using namespace precice::constants;
+  bool isFirst = utils::Parallel::getProcessRank() == 0;
+  std::string participant = isFirst ? "SolverOne" : "SolverTwo";
+  int advanceCalls = 0;
+  {
+    SolverInterface couplingInterface(participant, 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "advance-timings.xml");
+    couplingInterface._impl->configure(config.getSolverInterfaceConfiguration());
+    if (isFirst){
+      int meshID = couplingInterface.getMeshID("Square");
+      double pos[3] = {0.0, 0.0, 0.0};
+      couplingInterface.setMeshVertex(meshID, pos);
+    }
+    double maxDt = couplingInterface.initialize();
+    while (couplingInterface.isCouplingOngoing()){
+      if (couplingInterface.isActionRequired(actionWriteIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionWriteIterationCheckpoint());
+      }
+      if (couplingInterface.isActionRequired(actionReadIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionReadIterationCheckpoint());
+      }
+      maxDt = couplingInterface.advance(maxDt);
+      advanceCalls++;
+    }
+    couplingInterface.finalize();
+  }
+
+  std::ifstream timingsFile("precice-" + participant + "-advance.log");
+  BOOST_TEST_REQUIRE(timingsFile.is_open());
+
+  std::vector<std::string> expectedFields = {
+    "Timesteps", "Advance_Calls", "Timestep_Complete", "Solver", "Send", "Receive",
+    "Mapping", "Post_Processing", "Convergence_Measurement", "Export", "Advance_Total"};
+  std::string line;
+  BOOST_TEST_REQUIRE(static_cast<bool>(std::getline(timingsFile, line)));
+  std::vector<std::string> fields;
+  {
+    std::istringstream header(line);
+    std::string field;
+    while (header >> field){
+      fields.push_back(field);
+    }
+  }
+  BOOST_TEST(fields == expectedFields, boost::test_tools::per_element());
+
+  int rows = 0;
+  int completedTimesteps = 0;
+  int lastTimesteps = 0;
+  while (std::getline(timingsFile, line)){
+    std::istringstream row(line);
+    int timesteps = 0, calls = 0, complete = 0;
+    row >> timesteps >> calls >> complete;
+    std::vector<double> durations;
+    double duration = 0.0;
+    while (row >> duration){
+      durations.push_back(duration);
+    }
+    BOOST_TEST_REQUIRE(durations.size() == expectedFields.size() - 3);
+    rows++;
+    BOOST_TEST(calls == rows);
+    BOOST_TEST(timesteps >= lastTimesteps);
+    BOOST_TEST((complete == 0 || complete == 1));
+    completedTimesteps += complete;
+    lastTimesteps = timesteps;
+    for (double d : durations){
+      BOOST_TEST(d >= 0.0);
+    }
+  }
+  BOOST_TEST(rows == advanceCalls);
+  BOOST_TEST(completedTimesteps == 4);
+}
+
+/// Tests the linear interpolation of read data in time for a subcycling solver.
+BOOST_AUTO_TEST_CASE(testImplicitWithWaveform,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  using namespace precice::constants;
+
+  if (utils::Parallel::getProcessRank() == 0){
+    SolverInterface couplingInterface("SolverOne", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "implicit-waveform.xml");
+    couplingInterface._impl->configure(config.getSolverInterfaceConfiguration());
+
+    int meshID = couplingInterface.getMeshID("Square");
+    int forcesID = couplingInterface.getDataID("Forces", meshID);
+    double pos[3] = {0.0, 0.0, 0.0};
+    int vertexID = couplingInterface.setMeshVertex(meshID, pos);
+
+    double maxDt = couplingInterface.initialize();
+    int window = 1;
+    while (couplingInterface.isCouplingOngoing()){
+      if (couplingInterface.isActionRequired(actionWriteIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionWriteIterationCheckpoint());
+      }
+      if (couplingInterface.isActionRequired(actionReadIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionReadIterationCheckpoint());
+      }
+      // The forces at the end of window n are n
+      Eigen::Vector3d forces = Eigen::Vector3d::Constant(window);
+      couplingInterface.writeVectorData(forcesID, vertexID, forces.data());
+      maxDt = couplingInterface.advance(maxDt);
+      if (couplingInterface.isTimestepComplete()){
+        window++;
+      }
+    }
+    couplingInterface.finalize();
+  }
+  else if (utils::Parallel::getProcessRank() == 1){
+    SolverInterface couplingInterface("SolverTwo", 0, 1);
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), _pathToTests + "implicit-waveform.xml");
+    couplingInterface._impl->configure(config.getSolverInterfaceConfiguration());
+
+    int meshID = couplingInterface.getMeshID("Square");
+    int forcesID = couplingInterface.getDataID("Forces", meshID);
+
+    couplingInterface.initialize();
+    // Two timesteps per window, the forces are read at the end of the next timestep
+    std::vector<double> expectedForces = {1.0, 1.5, 2.0, 2.5, 3.0};
+    size_t advanceCalls = 0;
+    while (couplingInterface.isCouplingOngoing()){
+      if (couplingInterface.isActionRequired(actionWriteIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionWriteIterationCheckpoint());
+      }
+      if (couplingInterface.isActionRequired(actionReadIterationCheckpoint())){
+        couplingInterface.fulfilledAction(actionReadIterationCheckpoint());
+      }
+      couplingInterface.advance(0.5);
+      advanceCalls++;
+      if (couplingInterface.isCouplingOngoing()){
+        BOOST_TEST_REQUIRE(advanceCalls <= expectedForces.size());
+        Eigen::Vector3d forces;
+        couplingInterface.readVectorData(forcesID, 0, forces.data());
+        BOOST_TEST(forces(0) == expectedForces[advanceCalls - 1]);
+      }
+    }
+    couplingInterface.finalize();
+    BOOST_TEST(advanceCalls == 6);
+  }
+}
+
+/// Tests the interpolation of read data across the waveform samples of a subcycling partner.
+BOOST_AUTO_TEST_CASE(testImplicitWithWaveformSamples,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  using namespace precice::constants;
+
+  // Both solvers compute four timesteps per window and the forces are quadratic in time,
+  // such that a linear interpolation within the window would not reproduce them.
+  auto forcesAt = [](double time) { return time * time; };
+  const double dt = 0.25;
+  std::string solverName = utils::Parallel::getProcessRank() == 0 ? "SolverOne" : "SolverTwo";
+  SolverInterface couplingInterface(solverName, 0, 1);
+  config::Configuration config;
+  xml::configure(config.getXMLTag(), _pathToTests + "implicit-waveform-samples.xml");
+  couplingInterface._impl->configure(config.getSolverInterfaceConfiguration());
+
+  int meshID = couplingInterface.getMeshID("Square");
+  int forcesID = couplingInterface.getDataID("Forces", meshID);
+  if (solverName == "SolverOne"){
+    double pos[3] = {0.0, 0.0, 0.0};
+    couplingInterface.setMeshVertex(meshID, pos);
+  }
+
+  couplingInterface.initialize();
+  double windowStart = 0.0;
+  int timestep = 0;
+  int checkedReads = 0;
+  while (couplingInterface.isCouplingOngoing()){
+    if (couplingInterface.isActionRequired(actionWriteIterationCheckpoint())){
+      couplingInterface.fulfilledAction(actionWriteIterationCheckpoint());
+    }
+    if (solverName == "SolverOne"){
+      // The forces at the end of the timestep
+      Eigen::Vector3d forces = Eigen::Vector3d::Constant(forcesAt(windowStart + (timestep + 1) * dt));
+      couplingInterface.writeVectorData(forcesID, 0, forces.data());
+    }
+    couplingInterface.advance(dt);
+    timestep++;
+    if (couplingInterface.isTimestepComplete()){
+      windowStart += 1.0;
+      timestep = 0;
+    }
+    if (couplingInterface.isActionRequired(actionReadIterationCheckpoint())){
+      couplingInterface.fulfilledAction(actionReadIterationCheckpoint());
+      timestep = 0;
+    }
+    // The start of the first window is not received
+    if (solverName == "SolverTwo" && couplingInterface.isCouplingOngoing() && windowStart > 0.0){
+      Eigen::Vector3d forces;
+      couplingInterface.readVectorData(forcesID, 0, forces.data());
+      BOOST_TEST(forces(0) == forcesAt(windowStart + (timestep + 1) * dt));
+      checkedReads++;
+    }
+  }
+  couplingInterface.finalize();
+  if (solverName == "SolverTwo"){
+    // The last read of the first window, two iterations with four timesteps in the second and
+    // the third window, without the read after the last timestep
+    BOOST_TEST(checkedReads == 16);
+  }
+}
+
 
 /// Tests stationary mapping with solver provided meshes.
 BOOST_AUTO_TEST_CASE(testStationaryMappingWithSolverMesh,
@@ -1363,6 +1586,80 @@ BOOST_AUTO_TEST_CASE(testMultiCoupling, * testing::OnSize(4))
 
 }
 
+/// Manifold mapping post-processing with a multi coupling scheme, coarse and fine models differ.
+BOOST_AUTO_TEST_CASE(testMultiCouplingManifoldMapping,
+                     * testing::MinRanks(2)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1})))
+{
+  if (utils::Parallel::getCommunicatorSize() != 2)
+    return;
+
+  using namespace precice::constants;
+  bool isFluid = utils::Parallel::getProcessRank() == 0;
+  SolverInterface precice(isFluid ? "Fluid" : "Structure", 0, 1);
+  config::Configuration config;
+  xml::configure(config.getXMLTag(), _pathToTests + "multi-manifold-mapping.xml");
+  precice._impl->configure(config.getSolverInterfaceConfiguration());
+
+  int meshID = precice.getMeshID("Mesh");
+  int forcesID = precice.getDataID("Forces", meshID);
+  int displacementsID = precice.getDataID("Displacements", meshID);
+  int velocitiesID = precice.getDataID("Velocities", meshID);
+  int forcesCoarseID = precice.getDataID("ForcesCoarse", meshID);
+  int displacementsCoarseID = precice.getDataID("DisplacementsCoarse", meshID);
+  int velocitiesCoarseID = precice.getDataID("VelocitiesCoarse", meshID);
+  int vertexID = 0;
+  if (isFluid){
+    double position[2] = {0.0, 0.0};
+    vertexID = precice.setMeshVertex(meshID, position);
+  }
+
+  double maxDt = precice.initialize();
+  int coarseEvaluations = 0;
+  int fineEvaluations = 0;
+  double force = 0.0, displacement = 0.0, velocity = 0.0;
+  while (precice.isCouplingOngoing()){
+    if (precice.isActionRequired(actionWriteIterationCheckpoint())){
+      precice.fulfilledAction(actionWriteIterationCheckpoint());
+    }
+    bool coarse = precice.hasToEvaluateSurrogateModel();
+    if (isFluid){
+      precice.readScalarData(coarse ? displacementsCoarseID : displacementsID, vertexID, displacement);
+      precice.readScalarData(coarse ? velocitiesCoarseID : velocitiesID, vertexID, velocity);
+      force = 0.5 * displacement + velocity + 1.0;
+      precice.writeScalarData(coarse ? forcesCoarseID : forcesID, vertexID, force);
+    }
+    else {
+      precice.readScalarData(coarse ? forcesCoarseID : forcesID, vertexID, force);
+      displacement = (coarse ? 0.4 : 0.5) * force + 1.0;
+      velocity = 0.25 * force;
+      precice.writeScalarData(coarse ? displacementsCoarseID : displacementsID, vertexID, displacement);
+      precice.writeScalarData(coarse ? velocitiesCoarseID : velocitiesID, vertexID, velocity);
+    }
+    if (coarse){
+      coarseEvaluations++;
+    }
+    else {
+      fineEvaluations++;
+    }
+    maxDt = precice.advance(maxDt);
+    if (precice.isActionRequired(actionReadIterationCheckpoint())){
+      precice.fulfilledAction(actionReadIterationCheckpoint());
+    }
+  }
+  precice.finalize();
+
+  BOOST_TEST(coarseEvaluations > 0);
+  BOOST_TEST(fineEvaluations > 0);
+  // converged to the solution of the fine models
+  if (isFluid){
+    BOOST_TEST(force == 3.0, boost::test_tools::tolerance(1e-6));
+  }
+  else {
+    BOOST_TEST(displacement == 2.5, boost::test_tools::tolerance(1e-6));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
 #endif // PRECICE_NO_MPI
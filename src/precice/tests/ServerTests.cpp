@@ -103,16 +103,99 @@ BOOST_AUTO_TEST_CASE(testCouplingModeWithOneServer,
   }
 }
 
-/// Two solvers in coupling mode, one in parallel using a server
-BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithOneServer, * testing::OnSize(4))
+/// Batches writes of a client and checks that the server applies them in order before the next read
+BOOST_AUTO_TEST_CASE(testBatchedRequestsWithOneServer,
+                     * testing::MinRanks(3)
+                     * boost::unit_test::fixture<testing::MPICommRestrictFixture>(std::vector<int>({0, 1, 2})))
 {
+  if (utils::Parallel::getCommunicatorSize() != 3)
+    return;
+
   int rank = utils::Parallel::getProcessRank();
   std::string configFile = _pathToTests + "cplmode-1.xml";
+  Eigen::Matrix<double, 8, 1> expect;
+  expect << 1.0, 2.0, 5.0, 6.0, 1.0, 2.0, 7.0, 8.0;
   if (rank == 0){
     SolverInterface interface("ParticipantA", 0, 1);
+    interface.configure(configFile);
+    int meshID = interface.getMeshID("Mesh");
+    int scalarDataID = interface.getDataID("ScalarData", meshID);
+    int vectorDataID = interface.getDataID("VectorData", meshID);
+    for (int i = 0; i < 4; i++){
+      interface.setMeshVertex(meshID, Eigen::Vector2d(i, 0.0).data());
+    }
+    int indices[] = {0, 1, 2, 3};
+    Eigen::Matrix<double, 8, 1> vectorValues;
+    double dt = interface.initialize();
+    while (interface.isCouplingOngoing()){
+      for (int i = 0; i < 4; i++){
+        interface.writeScalarData(scalarDataID, i, 1.0);
+      }
+      dt = interface.advance(dt);
+      interface.readBlockVectorData(vectorDataID, 4, indices, vectorValues.data());
+      BOOST_TEST(vectorValues == expect);
+    }
+    interface.finalize();
+  }
+  else if (rank == 1){
+    SolverInterface interface("ParticipantB", 0, 1);
+    interface.configure(configFile);
+    int meshID = interface.getMeshID("Mesh");
+    int scalarDataID = interface.getDataID("ScalarData", meshID);
+    int vectorDataID = interface.getDataID("VectorData", meshID);
+    int indices[] = {0, 1, 2, 3};
+    double blockValues[] = {1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0};
+    int lastIndex = 3;
+    double lastValue[] = {7.0, 8.0};
+    double dt = interface.initialize();
+    while (interface.isCouplingOngoing()){
+      // Single and block writes are batched, later writes overwrite earlier ones
+      interface.writeVectorData(vectorDataID, 0, Eigen::Vector2d(-1.0, -1.0).data());
+      interface.writeBlockVectorData(vectorDataID, 4, indices, blockValues);
+      interface.writeVectorData(vectorDataID, 1, Eigen::Vector2d(5.0, 6.0).data());
+      interface.writeBlockVectorData(vectorDataID, 1, &lastIndex, lastValue);
+
+      // A read is not batched and has to see all writes before it
+      Eigen::Vector2d value;
+      for (int i = 0; i < 4; i++){
+        interface.readVectorData(vectorDataID, i, value.data());
+        BOOST_TEST(value == expect.segment<2>(2*i));
+      }
+      double scalar = 0.0;
+      interface.readScalarData(scalarDataID, 2, scalar);
+      BOOST_TEST(scalar == 1.0);
+      dt = interface.advance(dt);
+    }
+    interface.finalize();
+  }
+  else {
+    assertion(rank == 2, rank);
+    bool isServer = true;
+    impl::SolverInterfaceImpl server("ParticipantB", 0, 1, isServer);
+
+    // Perform manual configuration without overwritting logging config
+    mesh::Mesh::resetGeometryIDsGlobally();
+    mesh::Data::resetDataCount();
+    impl::Participant::resetParticipantCount();
     config::Configuration config;
     xml::configure(config.getXMLTag(), configFile);
-    interface._impl->configure(config.getSolverInterfaceConfiguration());
+    server.configure(config.getSolverInterfaceConfiguration());
+    server.runServer();
+  }
+}
+
+/**
+ * @brief Two solvers in coupling mode, one in parallel using a server
+ *
+ * With quietClient, the first client of ParticipantB stays quiet in every timestep
+ * until the second client has completed its read and write requests.
+ */
+void runCouplingModeParallelWithOneServer(const std::string& configFile, bool quietClient = false)
+{
+  int rank = utils::Parallel::getProcessRank();
+  if (rank == 0){
+    SolverInterface interface("ParticipantA", 0, 1);
+    interface.configure(configFile);
     double time = 0.0;
     int timesteps = 0;
 
@@ -149,9 +232,7 @@ BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithOneServer, * testing::OnSize(4)
   }
   else if ((rank == 1) || (rank == 2)){
     SolverInterface interface("ParticipantB", rank-1, 2);
-    config::Configuration config;
-    xml::configure(config.getXMLTag(), configFile);
-    interface._impl->configure(config.getSolverInterfaceConfiguration());
+    interface.configure(configFile);
     double time = 0.0;
     int timesteps = 0;
     double dt = interface.initialize();
@@ -162,10 +243,18 @@ BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithOneServer, * testing::OnSize(4)
     int indices[] = {0, 1, 2, 3};
     double vectorValues[] = {1.0, 2.0, 1.0, 2.0, 1.0, 2.0, 1.0, 2.0};
     while (interface.isCouplingOngoing()){
+      if (quietClient && (rank == 1)){
+        int token = 0;
+        MPI_Recv(&token, 1, MPI_INT, 2, 0, utils::Parallel::getCommunicatorWorld(), MPI_STATUS_IGNORE);
+      }
       double value = 0.0;
       interface.readScalarData(scalarDataID, 0, value);
       BOOST_TEST(value == 1.0);
       interface.writeBlockVectorData(vectorDataID, dataSize, indices, vectorValues);
+      if (quietClient && (rank == 2)){
+        int token = 0;
+        MPI_Send(&token, 1, MPI_INT, 1, 0, utils::Parallel::getCommunicatorWorld());
+      }
       time += dt;
       timesteps++;
       dt = interface.advance(dt);
@@ -190,6 +279,100 @@ BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithOneServer, * testing::OnSize(4)
   }
 }
 
+BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithOneServer, * testing::OnSize(4))
+{
+  runCouplingModeParallelWithOneServer(_pathToTests + "cplmode-1.xml");
+}
+
+/// Two solvers in coupling mode, one in parallel using a server connected by shared memory
+BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithSharedMemoryServer, * testing::OnSize(4))
+{
+  runCouplingModeParallelWithOneServer(_pathToTests + "cplmode-shared-memory.xml");
+}
+
+/// As above, while one client goes quiet the server has to keep serving the other one
+BOOST_AUTO_TEST_CASE(testCouplingModeParallelWithSharedMemoryServerQuietClient, * testing::OnSize(4))
+{
+  runCouplingModeParallelWithOneServer(_pathToTests + "cplmode-shared-memory.xml", true);
+}
+
+/**
+ * @brief Values written by one client of a shared memory server are read by another client right away
+ *
+ * The clients map the data values of the server, hence a write is visible without any request to the
+ * server. With a server connected by sockets, the write would still wait in the batch of the client.
+ */
+BOOST_AUTO_TEST_CASE(testSharedMemoryServerSharesValues, * testing::OnSize(4))
+{
+  std::string configFile = _pathToTests + "cplmode-shared-memory.xml";
+  int rank = utils::Parallel::getProcessRank();
+  int indices[] = {0, 1, 2, 3};
+  if (rank == 0){
+    SolverInterface interface("ParticipantA", 0, 1);
+    interface.configure(configFile);
+    int meshID = interface.getMeshID("Mesh");
+    int scalarDataID = interface.getDataID("ScalarData", meshID);
+    int vectorDataID = interface.getDataID("VectorData", meshID);
+    for (int i = 0; i < 4; i++){
+      interface.setMeshVertex(meshID, Eigen::Vector2d(i, 0.0).data());
+    }
+    double dt = interface.initialize();
+    int timestep = 0;
+    while (interface.isCouplingOngoing()){
+      timestep++;
+      for (int i = 0; i < 4; i++){
+        interface.writeScalarData(scalarDataID, i, timestep);
+      }
+      dt = interface.advance(dt);
+      Eigen::Matrix<double, 8, 1> values;
+      interface.readBlockVectorData(vectorDataID, 4, indices, values.data());
+      BOOST_TEST(values == (Eigen::Matrix<double, 8, 1>::Constant(timestep)));
+    }
+    interface.finalize();
+  }
+  else if ((rank == 1) || (rank == 2)){
+    SolverInterface interface("ParticipantB", rank-1, 2);
+    interface.configure(configFile);
+    double dt = interface.initialize();
+    int meshID = interface.getMeshID("Mesh");
+    int scalarDataID = interface.getDataID("ScalarData", meshID);
+    int vectorDataID = interface.getDataID("VectorData", meshID);
+    int timestep = 0;
+    while (interface.isCouplingOngoing()){
+      timestep++;
+      double scalar = 0.0;
+      interface.readScalarData(scalarDataID, 3, scalar);
+      BOOST_TEST(scalar == timestep);
+      int token = 0;
+      if (rank == 1){
+        Eigen::Matrix<double, 8, 1> values = Eigen::Matrix<double, 8, 1>::Constant(scalar);
+        interface.writeBlockVectorData(vectorDataID, 4, indices, values.data());
+        MPI_Send(&token, 1, MPI_INT, 2, 0, utils::Parallel::getCommunicatorWorld());
+      }
+      else {
+        MPI_Recv(&token, 1, MPI_INT, 1, 0, utils::Parallel::getCommunicatorWorld(), MPI_STATUS_IGNORE);
+        Eigen::Vector2d value;
+        interface.readVectorData(vectorDataID, 2, value.data());
+        BOOST_TEST(value == Eigen::Vector2d::Constant(timestep));
+      }
+      dt = interface.advance(dt);
+    }
+    interface.finalize();
+  }
+  else {
+    assertion(rank == 3, rank);
+    bool isServer = true;
+    impl::SolverInterfaceImpl server("ParticipantB", 0, 1, isServer);
+    mesh::Mesh::resetGeometryIDsGlobally();
+    mesh::Data::resetDataCount();
+    impl::Participant::resetParticipantCount();
+    config::Configuration config;
+    xml::configure(config.getXMLTag(), configFile);
+    server.configure(config.getSolverInterfaceConfiguration());
+    server.runServer();
+  }
+}
+
 
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -52,6 +52,18 @@ void removeColumnFromMatrix
   A.conservativeResize(A.rows(), A.cols() - 1);
 }
 
+void transformLeftColumns
+(
+    Eigen::MatrixXd& A, const Eigen::MatrixXd& T)
+{
+  int cols = T.rows(), rest = A.cols() - T.rows();
+  assertion(rest >= 0, T.rows(), A.cols());
+  Eigen::MatrixXd transformed(A.rows(), T.cols() + rest);
+  transformed.leftCols(T.cols()) = A.leftCols(cols) * T;
+  transformed.rightCols(rest)    = A.rightCols(rest);
+  A = transformed;
+}
+
 void append(
     Eigen::VectorXd& v,
     double value)
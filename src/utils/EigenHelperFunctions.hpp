@@ -13,6 +13,9 @@ void appendFront(Eigen::MatrixXd& A, Eigen::VectorXd& v);
 
 void removeColumnFromMatrix(Eigen::MatrixXd& A, int col);
 
+/// Replaces the first T.rows() columns of A by the T.cols() columns A.leftCols(T.rows()) * T.
+void transformLeftColumns(Eigen::MatrixXd& A, const Eigen::MatrixXd& T);
+
 void append(Eigen::VectorXd& v, double value);
 
 template<typename Derived1>
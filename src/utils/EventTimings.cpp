@@ -15,6 +15,10 @@
 #include <chrono>
 #include <utility>
 #include <limits>
+#include <cmath>
+#include <numeric>
+#include <set>
+#include <functional>
 #ifndef PRECICE_NO_MPI
 #include <mpi.h>
 #endif
@@ -32,20 +36,45 @@ struct MPI_EventData
   int dataSize = 0, stateChangesSize = 0;
 };
 
+/// Drops the oldest state changes if the history grew to twice its bound, amortizing the erase.
+void boundStateChanges(Event::StateChanges & stateChanges)
+{
+  size_t maxStateChanges = EventRegistry::instance().maxStateChanges;
+  if (stateChanges.size() >= 2 * maxStateChanges) {
+    stateChanges.erase(stateChanges.begin(), stateChanges.end() - maxStateChanges);
+  }
+}
+
+EventName::EventName(const std::string & name)
+  : id(EventRegistry::instance().getNameID(name))
+{}
+
 Event::Event(std::string eventName, Clock::duration initialDuration)
-  : name(EventRegistry::instance().prefix + eventName),
-    duration(initialDuration)
+  : duration(initialDuration)
 {
-  EventRegistry::instance().put(this);
+  auto & registry = EventRegistry::instance();
+  id = registry.getEventID(registry.getNameID(eventName));
+  registry.put(this);
 }
 
 Event::Event(std::string eventName, bool barrier, bool autostart)
-  : name(eventName),
+  : _barrier(barrier)
+{
+  // Skip the registry here: workaround to omit data lock between instance() and Event ctor,
+  // the ID of the global event is set by the registry itself
+  if (eventName != "_GLOBAL") {
+    auto & registry = EventRegistry::instance();
+    id = registry.getEventID(registry.getNameID(eventName));
+  }
+  if (autostart) {
+    start(_barrier);
+  }
+}
+
+Event::Event(const EventName & eventName, bool barrier, bool autostart)
+  : id(EventRegistry::instance().getEventID(eventName.id)),
     _barrier(barrier)
 {
-  // Set prefix here: workaround to omit data lock between instance() and Event ctor
-  if (eventName != "_GLOBAL")
-    name = EventRegistry::instance().prefix + eventName;
   if (autostart) {
     start(_barrier);
   }
@@ -62,9 +91,9 @@ void Event::start(bool barrier)
     Parallel::synchronizeProcesses();
     
   state = State::STARTED;
-  stateChanges.push_back(std::make_tuple(State::STARTED, Clock::now()));
   starttime = Clock::now();
-  DEBUG("Started event " << name);
+  recordStateChange(State::STARTED, starttime);
+  DEBUG("Started event " << getName());
 }
 
 void Event::stop(bool barrier)
@@ -73,17 +102,17 @@ void Event::stop(bool barrier)
     if (barrier)
       Parallel::synchronizeProcesses();
 
+    auto stoptime = Clock::now();
     if (state == State::STARTED) {
-      auto stoptime = Clock::now();
       duration += Clock::duration(stoptime - starttime);
     }
-    stateChanges.push_back(std::make_tuple(State::STOPPED, Clock::now()));
+    recordStateChange(State::STOPPED, stoptime);
     state = State::STOPPED;
     EventRegistry::instance().put(this);
     data.clear();
     stateChanges.clear();
     duration = Clock::duration::zero();
-    DEBUG("Stopped event " << name);
+    DEBUG("Stopped event " << getName());
   }
 }
 
@@ -94,10 +123,10 @@ void Event::pause(bool barrier)
       Parallel::synchronizeProcesses();
 
     auto stoptime = Clock::now();
-    stateChanges.push_back(std::make_tuple(State::PAUSED, Clock::now()));
+    recordStateChange(State::PAUSED, stoptime);
     state = State::PAUSED;
     duration += Clock::duration(stoptime - starttime);
-    DEBUG("Paused event " << name);
+    DEBUG("Paused event " << getName());
   }
 }
 
@@ -106,6 +135,17 @@ Event::Clock::duration Event::getDuration()
   return duration;
 }
 
+const std::string & Event::getName() const
+{
+  return EventRegistry::instance().getEventName(id);
+}
+
+void Event::recordStateChange(State newState, Clock::time_point time)
+{
+  stateChanges.push_back(std::make_tuple(newState, time));
+  boundStateChanges(stateChanges);
+}
+
 // -----------------------------------------------------------------------
 
 EventData::EventData(std::string _name) :
@@ -128,6 +168,8 @@ EventData::EventData(std::string _name, int _rank, long _count, long _total,
 
 void EventData::put(Event* event)
 {
+  if (count == 0)
+    rank = Parallel::getProcessRank(); // the event may have been registered before MPI was initialized
   count++;
   Event::Clock::duration duration = event->getDuration();
   total += duration;
@@ -135,9 +177,10 @@ void EventData::put(Event* event)
   max = std::max(duration, max);
   data.insert(std::end(data), std::begin(event->data), std::end(event->data));
   stateChanges.insert(std::end(stateChanges), std::begin(event->stateChanges), std::end(event->stateChanges));
+  boundStateChanges(stateChanges);
 }
 
-std::string EventData::getName() const
+const std::string & EventData::getName() const
 {
   return name;
 }
@@ -239,6 +282,13 @@ void EventData::writeEventLog(std::ostream &out)
 
 // -----------------------------------------------------------------------
 
+EventRegistry::EventRegistry()
+  : globalEvent("_GLOBAL", true, false) // Unstarted, it's started in initialize
+{
+  prefixID = getNameID(prefix);
+  globalEvent.id = getEventID(getNameID("_GLOBAL"));
+}
+
 EventRegistry & EventRegistry::instance()
 {
   static EventRegistry instance;
@@ -266,7 +316,9 @@ void EventRegistry::finalize()
 
 void EventRegistry::clear()
 {
-  events.clear();
+  // Keep the registered IDs, as events and names may still refer to them
+  for (auto & ev : events)
+    ev = EventData(ev.getName());
 }
 
 void EventRegistry::signal_handler(int signal)
@@ -279,11 +331,7 @@ void EventRegistry::signal_handler(int signal)
 
 void EventRegistry::put(Event* event)
 {
-  /// Construct or return EventData object with name as key and name as arg to ctor.
-  auto data = std::get<0>(events.emplace(std::piecewise_construct,
-                                         std::forward_as_tuple(event->name),
-                                         std::forward_as_tuple(event->name)));
-  data->second.put(event);
+  events[event->id].put(event);
 }
 
 Event & EventRegistry::getStoredEvent(std::string const & name)
@@ -291,16 +339,66 @@ Event & EventRegistry::getStoredEvent(std::string const & name)
   // Reset the prefix for creation of a stored event. Using prefixes with stored events is possible
   // but leads to unexpected results, such as not getting the event you want, because someone else up the
   // stack set a prefix.
+  auto found = storedEvents.find(name);
+  if (found != storedEvents.end())
+    return found->second;
+
   auto previousPrefix = prefix;
-  prefix = "";
+  setPrefix("");
   auto insertion = storedEvents.emplace(std::piecewise_construct,
                                         std::forward_as_tuple(name),
                                         std::forward_as_tuple(name, false, false));
 
-  prefix = previousPrefix;
+  setPrefix(previousPrefix);
   return std::get<0>(insertion)->second;
 }
 
+int EventRegistry::getNameID(std::string const & name)
+{
+  auto found = nameIDs.find(name);
+  if (found != nameIDs.end())
+    return found->second;
+
+  int nameID = names.size();
+  names.push_back(name);
+  nameIDs.emplace(name, nameID);
+  return nameID;
+}
+
+int EventRegistry::getEventID(int nameID)
+{
+  assert(nameID >= 0 and nameID < static_cast<int>(names.size()));
+  long long key = (static_cast<long long>(prefixID) << 32) | nameID;
+  auto found = eventIDs.find(key);
+  if (found != eventIDs.end())
+    return found->second;
+
+  // Different prefixes and names may still result in the same event name
+  std::string eventName = prefix + names[nameID];
+  auto insertion = eventIDsByName.emplace(eventName, events.size());
+  if (std::get<1>(insertion))
+    events.emplace_back(eventName);
+  int eventID = std::get<0>(insertion)->second;
+  eventIDs.emplace(key, eventID);
+  return eventID;
+}
+
+const std::string & EventRegistry::getEventName(int eventID) const
+{
+  return events[eventID].getName();
+}
+
+void EventRegistry::setPrefix(std::string const & newPrefix)
+{
+  prefix = newPrefix;
+  prefixID = getNameID(prefix);
+}
+
+const std::string & EventRegistry::getPrefix() const
+{
+  return prefix;
+}
+
 
 std::chrono::system_clock::time_point EventRegistry::getTimestamp()
 {
@@ -309,7 +407,7 @@ std::chrono::system_clock::time_point EventRegistry::getTimestamp()
 
 Event::Clock::duration EventRegistry::getDuration()
 {
-  return events.at("_GLOBAL").total;
+  return events[globalEvent.id].total;
 }
 
 void EventRegistry::printAll()
@@ -327,7 +425,8 @@ void EventRegistry::printAll()
   }
   writeCSV(csvFile);
   writeEventLogs(logFile);
-  
+  if (chromeTrace)
+    writeChromeTrace(applicationName.empty() ? "Events.json" : applicationName + "-events.json");
 }
 
 
@@ -342,7 +441,7 @@ void EventRegistry::print(std::ostream &out)
     using std::left; using std::right;
     
     std::time_t ts = std::chrono::system_clock::to_time_t(timestamp);
-    auto totalDuration = events.at("_GLOBAL").getTotal();
+    auto totalDuration = events[globalEvent.id].getTotal();
 
     out << "Run finished at " << std::asctime(std::localtime(&ts));
 
@@ -363,10 +462,9 @@ void EventRegistry::print(std::ostream &out)
       });
     table.printHeader();
       
-    for (auto & e : events) {
-      auto & ev = e.second;
-      table.printLine(ev.getName(), ev.getCount(), ev.getTotal(), ev.getMax(),
-                      ev.getMin(), ev.getAvg(), ev.getTimePercentage());
+    for (auto ev : getRecordedEvents()) {
+      table.printLine(ev->getName(), ev->getCount(), ev->getTotal(), ev->getMax(),
+                      ev->getMin(), ev->getAvg(), ev->getTimePercentage());
     }        
 
     out << endl;
@@ -435,11 +533,76 @@ void EventRegistry::writeEventLogs(std::string filename)
 
 
  
-std::map<std::string, GlobalEventStats> getGlobalStats(GlobalEvents events)
+/// Returns the element at the given percentile of sorted values (nearest rank).
+Event::Clock::duration getPercentile(std::vector<Event::Clock::duration> const & sorted, double percentile)
+{
+  size_t index = std::ceil(percentile * sorted.size());
+  return sorted[std::max<size_t>(index, 1) - 1];
+}
+
+/// Escapes a string for a JSON string literal.
+std::string escapeJSON(std::string const & s)
+{
+  std::string escaped;
+  for (char c : s) {
+    if (c == '"' or c == '\\')
+      escaped.push_back('\\');
+    escaped.push_back(c);
+  }
+  return escaped;
+}
+
+void EventRegistry::writeChromeTrace(std::string filename)
+{
+  if (Parallel::getProcessRank() != 0)
+    return;
+
+  using Microseconds = std::chrono::duration<double, std::micro>;
+  // Participants get different process IDs, such that their traces can be merged
+  size_t pid = std::hash<std::string>()(applicationName) % 100000;
+  std::string processName = applicationName.empty() ? "preCICE" : applicationName;
+
+  std::ofstream outfile(filename, std::ios::trunc);
+  outfile << std::fixed << std::setprecision(3);
+  outfile << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+  outfile << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": " << pid
+          << ", \"args\": {\"name\": \"" << escapeJSON(processName) << "\"}}";
+
+  std::set<int> ranks;
+  for (auto & e : globalEvents) {
+    auto & ev = e.second;
+    std::string name = escapeJSON(e.first);
+    if (ranks.insert(ev.rank).second) {
+      outfile << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << ev.rank
+              << ", \"args\": {\"name\": \"Rank " << ev.rank << "\"}}";
+    }
+    // A slice lasts from a start to the next pause or stop
+    bool started = false;
+    Event::Clock::time_point begin;
+    for (auto & sc : ev.stateChanges) {
+      if (std::get<0>(sc) == Event::State::STARTED) {
+        started = true;
+        begin = std::get<1>(sc);
+      }
+      else if (started) {
+        started = false;
+        outfile << ",\n{\"name\": \"" << name << "\", \"ph\": \"X\", \"pid\": " << pid
+                << ", \"tid\": " << ev.rank
+                << ", \"ts\": " << Microseconds(begin.time_since_epoch()).count()
+                << ", \"dur\": " << Microseconds(std::get<1>(sc) - begin).count() << "}";
+      }
+    }
+  }
+  outfile << "\n]}" << std::endl;
+  outfile.close();
+}
+
+std::map<std::string, GlobalEventStats> computeGlobalStats(GlobalEvents const & events)
 {
   std::map<std::string, GlobalEventStats> globalStats;
+  std::map<std::string, std::vector<Event::Clock::duration>> totals;
   for (auto & e : events) {
-    auto ev = e.second;
+    auto & ev = e.second;
     GlobalEventStats & stats = globalStats[e.first];
     if (ev.max > stats.max) {
       stats.max = ev.max;
@@ -449,28 +612,58 @@ std::map<std::string, GlobalEventStats> getGlobalStats(GlobalEvents events)
       stats.min = ev.min;
       stats.minRank = ev.rank;
     }    
+    totals[e.first].push_back(ev.total);
+  }
+  for (auto & t : totals) {
+    auto & sorted = t.second;
+    std::sort(sorted.begin(), sorted.end());
+    GlobalEventStats & stats = globalStats[t.first];
+    stats.avgTotal = std::accumulate(sorted.begin(), sorted.end(), Event::Clock::duration::zero()) / static_cast<long>(sorted.size());
+    stats.p50Total = getPercentile(sorted, 0.5);
+    stats.p95Total = getPercentile(sorted, 0.95);
   }
   return globalStats;
 }
 
 void EventRegistry::printGlobalStats()
 {
-  Table t({ {getMaxNameWidth(), "Name"},
-      {10, "Max"}, {10, "MaxOnRank"}, {10, "Min"}, {10, "MinOnRank"}, {10, "Min/Max"} });
+  size_t nameWidth = getMaxNameWidth();
+  for (auto & e : globalStats)
+    nameWidth = std::max(nameWidth, e.first.size());
+
+  Table t({ {nameWidth, "Name"},
+      {10, "Max"}, {10, "MaxOnRank"}, {10, "Min"}, {10, "MinOnRank"},
+      {10, "AvgTotal"}, {10, "P50Total"}, {10, "P95Total"}, {10, "Min/Max"} });
   t.printHeader();
   
-  auto stats = getGlobalStats(globalEvents);
-  for (auto & e : stats) {
+  for (auto & e : globalStats) {
     auto & ev = e.second;
     double rel = 0;
     if (ev.max != Event::Clock::duration::zero()) // Guard against division by zero
       rel = static_cast<double>(ev.min.count()) / ev.max.count();
-    t.printLine(e.first, ev.max, ev.maxRank, ev.min, ev.minRank, rel);
+    t.printLine(e.first, ev.max, ev.maxRank, ev.min, ev.minRank, ev.avgTotal, ev.p50Total, ev.p95Total, rel);
   }
 }
 
+const std::map<std::string, GlobalEventStats> & EventRegistry::getGlobalStats() const
+{
+  return globalStats;
+}
 
 void EventRegistry::collect()
+{
+  globalEvents.clear();
+  globalStats.clear();
+  if (collectMode == CollectMode::REDUCE)
+    reduceEvents();
+  else
+    gatherEvents();
+
+  if (writeTrace)
+    writeTraceFile(applicationName.empty() ? "Events.trace" : applicationName + "-events.trace");
+}
+
+void EventRegistry::gatherEvents()
 {
   #ifndef PRECICE_NO_MPI
   // Register MPI datatype
@@ -488,41 +681,42 @@ void EventRegistry::collect()
   
   std::vector<MPI_Request> requests;
   std::vector<int> eventsPerRank(MPIsize);
-  size_t eventsSize = events.size();
+  auto recordedEvents = getRecordedEvents();
+  size_t eventsSize = recordedEvents.size();
   MPI_Gather(&eventsSize, 1, MPI_INT, eventsPerRank.data(), 1, MPI_INT, 0, Parallel::getGlobalCommunicator());
 
-  std::vector<MPI_EventData> eventSendBuf(events.size());
-  std::vector<std::unique_ptr<char[]>> packSendBuf(events.size());
+  std::vector<MPI_EventData> eventSendBuf(recordedEvents.size());
+  std::vector<std::unique_ptr<char[]>> packSendBuf(recordedEvents.size());
   int i = 0;
-  for (const auto & ev : events) {
+  for (auto ev : recordedEvents) {
     MPI_EventData eventdata;
     MPI_Request req;
     
-    assert(ev.first.size() <= 255);
-    ev.first.copy(eventSendBuf[i].name, 255);
+    assert(ev->getName().size() <= 255);
+    ev->getName().copy(eventSendBuf[i].name, 255);
     eventSendBuf[i].rank = rank;
-    eventSendBuf[i].count = ev.second.getCount();
-    eventSendBuf[i].total = ev.second.getTotal();
-    eventSendBuf[i].max = ev.second.getMax();
-    eventSendBuf[i].min = ev.second.getMin();
-    eventSendBuf[i].dataSize = ev.second.getData().size();
-    eventSendBuf[i].stateChangesSize = ev.second.stateChanges.size();
+    eventSendBuf[i].count = ev->getCount();
+    eventSendBuf[i].total = ev->getTotal();
+    eventSendBuf[i].max = ev->getMax();
+    eventSendBuf[i].min = ev->getMin();
+    eventSendBuf[i].dataSize = ev->getData().size();
+    eventSendBuf[i].stateChangesSize = ev->stateChanges.size();
     
     int packSize = 0, pSize = 0;
-    // int packSize = sizeof(int) * ev.second.getData().size() +
-      // sizeof(Event::StateChanges::value_type) * ev.second.stateChanges.size();
-    MPI_Pack_size(ev.second.getData().size(), MPI_INT, Parallel::getGlobalCommunicator(), &pSize);
+    // int packSize = sizeof(int) * ev->getData().size() +
+      // sizeof(Event::StateChanges::value_type) * ev->stateChanges.size();
+    MPI_Pack_size(ev->getData().size(), MPI_INT, Parallel::getGlobalCommunicator(), &pSize);
     packSize += pSize;
-    MPI_Pack_size(ev.second.stateChanges.size() * sizeof(Event::StateChanges::value_type),
+    MPI_Pack_size(ev->stateChanges.size() * sizeof(Event::StateChanges::value_type),
                   MPI_BYTE, Parallel::getGlobalCommunicator(), &pSize);
     packSize += pSize;
     
     packSendBuf[i] = std::unique_ptr<char[]>(new char[packSize]);
     int position = 0;
-    MPI_Pack(const_cast<int*>(ev.second.getData().data()), ev.second.getData().size(),
+    MPI_Pack(const_cast<int*>(ev->getData().data()), ev->getData().size(),
              MPI_INT, packSendBuf[i].get(), packSize, &position, Parallel::getGlobalCommunicator());
-    MPI_Pack(const_cast<Event::StateChanges::pointer>(ev.second.stateChanges.data()),
-             ev.second.stateChanges.size() * sizeof(Event::StateChanges::value_type),
+    MPI_Pack(const_cast<Event::StateChanges::pointer>(ev->stateChanges.data()),
+             ev->stateChanges.size() * sizeof(Event::StateChanges::value_type),
              MPI_BYTE, packSendBuf[i].get(), packSize, &position, Parallel::getGlobalCommunicator());
 
     MPI_Isend(&eventSendBuf[i], 1, MPI_EVENTDATA, 0, 0, Parallel::getGlobalCommunicator(), &req);
@@ -543,14 +737,17 @@ void EventRegistry::collect()
         int packSize = 0, position = 0;
         MPI_Probe(i, MPI_ANY_TAG, Parallel::getGlobalCommunicator(), &status);
         MPI_Get_count(&status, MPI_PACKED, &packSize);
-        char packBuffer[packSize];
-        MPI_Recv(packBuffer, packSize, MPI_PACKED, i, MPI_ANY_TAG,
+        std::vector<char> packBuffer(packSize);
+        MPI_Recv(packBuffer.data(), packSize, MPI_PACKED, i, MPI_ANY_TAG,
                  Parallel::getGlobalCommunicator(), MPI_STATUS_IGNORE);
-        MPI_Unpack(packBuffer, packSize, &position, recvData.data(), ev.dataSize, MPI_INT,
-                   Parallel::getGlobalCommunicator());
-        MPI_Unpack(packBuffer, packSize, &position, recvStateChanges.data(),
-                   ev.stateChangesSize * sizeof(Event::StateChanges::value_type), MPI_BYTE,
-                   Parallel::getGlobalCommunicator());
+        // Events with a given duration have neither data nor state changes, MPI_Unpack rejects empty buffers
+        if (packSize > 0) {
+          MPI_Unpack(packBuffer.data(), packSize, &position, recvData.data(), ev.dataSize, MPI_INT,
+                     Parallel::getGlobalCommunicator());
+          MPI_Unpack(packBuffer.data(), packSize, &position, recvStateChanges.data(),
+                     ev.stateChangesSize * sizeof(Event::StateChanges::value_type), MPI_BYTE,
+                     Parallel::getGlobalCommunicator());
+        }
           
         globalEvents.emplace(std::piecewise_construct, std::forward_as_tuple(ev.name),
                              std::forward_as_tuple(ev.name, ev.rank, ev.count, ev.total, ev.max, ev.min,
@@ -562,17 +759,227 @@ void EventRegistry::collect()
   MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
   MPI_Type_free(&MPI_EVENTDATA);
   #endif
+  globalStats = computeGlobalStats(globalEvents);
+}
+
+
+
+#ifndef PRECICE_NO_MPI
+/// Packs names separated by null characters.
+std::string packNames(std::vector<std::string> const & names)
+{
+  std::string packed;
+  for (auto & name : names) {
+    packed += name;
+    packed.push_back('\0');
+  }
+  return packed;
+}
+
+std::vector<std::string> unpackNames(std::string const & packed)
+{
+  std::vector<std::string> names;
+  size_t begin = 0;
+  while (begin < packed.size()) {
+    size_t end = packed.find('\0', begin);
+    names.push_back(packed.substr(begin, end - begin));
+    begin = end + 1;
+  }
+  return names;
+}
+
+void broadcastString(std::string & s)
+{
+  long size = s.size();
+  MPI_Bcast(&size, 1, MPI_LONG, 0, Parallel::getGlobalCommunicator());
+  s.resize(size);
+  MPI_Bcast(&s[0], size, MPI_CHAR, 0, Parallel::getGlobalCommunicator());
+}
+
+/// Number of histogram bins of the total durations, four bins per power of two in ms.
+const int NUMBER_OF_BINS = 128;
+
+int getBin(double totalMs)
+{
+  return std::min(NUMBER_OF_BINS - 1, static_cast<int>(4 * std::log2(1 + totalMs)));
 }
 
+/// Returns the upper bound of a histogram bin in ms.
+double getBinLimit(int bin)
+{
+  return std::exp2((bin + 1) / 4.0) - 1;
+}
+
+template<typename T>
+void appendBinary(std::string & buffer, T value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+#endif
+
+void EventRegistry::reduceEvents()
+{
+  #ifndef PRECICE_NO_MPI
+  using Milliseconds = std::chrono::duration<double, std::milli>;
+  MPI_Comm comm = Parallel::getGlobalCommunicator();
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+
+  auto recordedEvents = getRecordedEvents();
+  std::map<std::string, const EventData*> localEvents;
+  for (auto ev : recordedEvents)
+    localEvents[ev->getName()] = ev;
+
+  // Agree on a common list of names: names of rank 0, and all names missing there
+  std::vector<std::string> commonNames;
+  for (auto ev : recordedEvents)
+    commonNames.push_back(ev->getName());
+  std::string packed = packNames(commonNames);
+  broadcastString(packed);
+  commonNames = unpackNames(packed);
+  std::set<std::string> known(commonNames.begin(), commonNames.end());
+  std::vector<std::string> missingNames;
+  for (auto & e : localEvents)
+    if (known.count(e.first) == 0)
+      missingNames.push_back(e.first);
+
+  int size;
+  MPI_Comm_size(comm, &size);
+  std::string packedMissing = packNames(missingNames);
+  int missingSize = packedMissing.size();
+  std::vector<int> missingSizes(size), displacements(size, 0);
+  MPI_Gather(&missingSize, 1, MPI_INT, missingSizes.data(), 1, MPI_INT, 0, comm);
+  for (int i = 1; i < size; i++)
+    displacements[i] = displacements[i-1] + missingSizes[i-1];
+  std::string allMissing(displacements.back() + missingSizes.back(), '\0');
+  MPI_Gatherv(&packedMissing[0], missingSize, MPI_CHAR, &allMissing[0], missingSizes.data(),
+              displacements.data(), MPI_CHAR, 0, comm);
+  if (rank == 0) {
+    for (auto & name : unpackNames(allMissing))
+      if (known.insert(name).second)
+        commonNames.push_back(name);
+  }
+  packed = packNames(commonNames);
+  broadcastString(packed);
+  commonNames = unpackNames(packed);
+
+  // Reduce statistics, indexed by the position in the common list
+  struct ValueAndRank {
+    double value;
+    int rank;
+  };
+  size_t numberOfEvents = commonNames.size();
+  std::vector<ValueAndRank> maxs(numberOfEvents, {-1.0, rank});
+  std::vector<ValueAndRank> mins(numberOfEvents, {std::numeric_limits<double>::max(), rank});
+  std::vector<double> sums(2 * numberOfEvents, 0.0); // total and number of ranks
+  std::vector<long> histograms(NUMBER_OF_BINS * numberOfEvents, 0);
+  for (size_t i = 0; i < numberOfEvents; i++) {
+    auto found = localEvents.find(commonNames[i]);
+    if (found == localEvents.end())
+      continue;
+    const EventData & ev = *found->second;
+    double totalMs = Milliseconds(ev.total).count();
+    maxs[i].value = Milliseconds(ev.max).count();
+    mins[i].value = Milliseconds(ev.min).count();
+    sums[2*i] = totalMs;
+    sums[2*i + 1] = 1;
+    histograms[NUMBER_OF_BINS * i + getBin(totalMs)] = 1;
+  }
+
+  std::vector<ValueAndRank> globalMaxs(numberOfEvents), globalMins(numberOfEvents);
+  std::vector<double> globalSums(sums.size());
+  std::vector<long> globalHistograms(histograms.size());
+  MPI_Reduce(maxs.data(), globalMaxs.data(), numberOfEvents, MPI_DOUBLE_INT, MPI_MAXLOC, 0, comm);
+  MPI_Reduce(mins.data(), globalMins.data(), numberOfEvents, MPI_DOUBLE_INT, MPI_MINLOC, 0, comm);
+  MPI_Reduce(sums.data(), globalSums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, 0, comm);
+  MPI_Reduce(histograms.data(), globalHistograms.data(), histograms.size(), MPI_LONG, MPI_SUM, 0, comm);
+
+  if (rank == 0) {
+    auto toDuration = [](double ms) {
+      return std::chrono::duration_cast<Event::Clock::duration>(Milliseconds(ms));
+    };
+    for (size_t i = 0; i < numberOfEvents; i++) {
+      GlobalEventStats & stats = globalStats[commonNames[i]];
+      stats.max = toDuration(globalMaxs[i].value);
+      stats.maxRank = globalMaxs[i].rank;
+      stats.min = toDuration(globalMins[i].value);
+      stats.minRank = globalMins[i].rank;
+      double numberOfRanks = globalSums[2*i + 1];
+      stats.avgTotal = toDuration(globalSums[2*i] / numberOfRanks);
+      // Percentiles are estimated by the upper bound of the bin holding them
+      long count = 0;
+      for (int bin = 0; bin < NUMBER_OF_BINS; bin++) {
+        long binCount = globalHistograms[NUMBER_OF_BINS * i + bin];
+        if (count < 0.5 * numberOfRanks and count + binCount >= 0.5 * numberOfRanks)
+          stats.p50Total = toDuration(getBinLimit(bin));
+        if (count < 0.95 * numberOfRanks and count + binCount >= 0.95 * numberOfRanks)
+          stats.p95Total = toDuration(getBinLimit(bin));
+        count += binCount;
+      }
+    }
+    // Keep the events of rank 0 for the CSV and event log files
+    for (auto ev : recordedEvents)
+      globalEvents.emplace(ev->getName(), *ev);
+  }
+  #endif
+}
+
+void EventRegistry::writeTraceFile(std::string const & filename)
+{
+  #ifndef PRECICE_NO_MPI
+  MPI_Comm comm = Parallel::getGlobalCommunicator();
+  int rank;
+  MPI_Comm_rank(comm, &rank);
+
+  std::string buffer;
+  auto recordedEvents = getRecordedEvents();
+  appendBinary(buffer, static_cast<int32_t>(rank));
+  appendBinary(buffer, static_cast<int32_t>(recordedEvents.size()));
+  for (auto ev : recordedEvents) {
+    appendBinary(buffer, static_cast<int32_t>(ev->getName().size()));
+    buffer += ev->getName();
+    appendBinary(buffer, static_cast<int64_t>(ev->stateChanges.size()));
+    for (auto & sc : ev->stateChanges) {
+      appendBinary(buffer, static_cast<int32_t>(std::get<0>(sc)));
+      appendBinary(buffer, static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                  std::get<1>(sc).time_since_epoch()).count()));
+    }
+  }
+
+  // Every rank writes its block behind the blocks of all lower ranks
+  long long blockSize = buffer.size(), offset = 0;
+  MPI_Exscan(&blockSize, &offset, 1, MPI_LONG_LONG, MPI_SUM, comm);
+  if (rank == 0)
+    offset = 0; // result of MPI_Exscan is undefined on rank 0
+
+  MPI_File file;
+  MPI_File_open(comm, filename.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &file);
+  MPI_File_set_size(file, 0);
+  MPI_File_write_at_all(file, offset, &buffer[0], buffer.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+  MPI_File_close(&file);
+  #endif
+}
 
 size_t EventRegistry::getMaxNameWidth()
 {
   size_t maxEventWidth = 0;
-  for (auto & ev : events)
-    if (ev.second.getName().size() > maxEventWidth)
-      maxEventWidth = ev.second.getName().size();
+  for (auto ev : getRecordedEvents())
+    if (ev->getName().size() > maxEventWidth)
+      maxEventWidth = ev->getName().size();
   
   return maxEventWidth;
 }
 
+std::vector<const EventData*> EventRegistry::getRecordedEvents() const
+{
+  std::vector<const EventData*> recordedEvents;
+  for (auto & ev : events)
+    if (ev.getCount() > 0)
+      recordedEvents.push_back(&ev);
+
+  std::sort(recordedEvents.begin(), recordedEvents.end(),
+            [](const EventData* a, const EventData* b) { return a->getName() < b->getName(); });
+  return recordedEvents;
+}
+
 }} // namespace precice::utils
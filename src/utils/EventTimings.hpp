@@ -5,11 +5,28 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include "logging/Logger.hpp"
 
 namespace precice {
 namespace utils {
 
+/// Name of an event, registered once in the EventRegistry.
+/** Creating an Event from an EventName avoids building and looking up the name string on every
+call. Register the names of events in hot paths once, e.g., at configuration time. */
+class EventName
+{
+public:
+  /// Creates an unset name.
+  EventName() = default;
+
+  /// Registers the name (without prefix).
+  explicit EventName(const std::string & name);
+
+  /// ID of the name in the EventRegistry, -1 if unset.
+  int id = -1;
+};
+
 /// Represents an event that can be started and stopped.
 /** Additionally to the duration there is a special property that can be set for a event.
 A property is a a key-value pair with a numerical value that can be used to trace certain events,
@@ -32,8 +49,8 @@ public:
   /// An Event can't be copied.
   Event(const Event & other) = delete;
   
-  /// Name used to identify the timer. Events of the same name are accumulated to
-  std::string name;
+  /// ID of the prefixed name in the EventRegistry. Events of the same name are accumulated.
+  int id = -1;
 
   /// Allows to put a non-measured (i.e. with a given duration) Event to the measurements.
   Event(std::string eventName, Clock::duration initialDuration);
@@ -42,6 +59,9 @@ public:
   /** Use barrier == true with caution, as it can lead to deadlocks. */
   Event(std::string eventName, bool barrier = false, bool autostart = true);
 
+  /// Same as above, but without building and looking up the name.
+  Event(const EventName & eventName, bool barrier = false, bool autostart = true);
+
   /// Stops the event if it's running and report its times to the EventRegistry
   ~Event();
 
@@ -57,12 +77,19 @@ public:
   /// Gets the duration of the event.
   Clock::duration getDuration();
 
+  /// Returns the name used to identify the timer, including the prefix.
+  const std::string & getName() const;
+
   std::vector<int> data;
 
+  /// State changes since the last stop, bounded by EventRegistry::maxStateChanges.
   StateChanges stateChanges;
 
 private:
   
+  /// Records a state change, drops the oldest ones if there are too many.
+  void recordStateChange(State newState, Clock::time_point time);
+
   Clock::time_point starttime;
   // Clock::time_point stoptime;
   Clock::duration duration = Clock::duration::zero();
@@ -86,7 +113,7 @@ public:
   /// Adds an Events data.
   void put(Event* event);
 
-  std::string getName() const;
+  const std::string & getName() const;
 
   /// Get the average duration of all events so far.
   long getAvg() const;
@@ -119,6 +146,8 @@ public:
   Event::Clock::duration total = Event::Clock::duration::zero();
   
   int rank;
+
+  /// Latest state changes of all events, bounded by EventRegistry::maxStateChanges.
   Event::StateChanges stateChanges;
   
 private:
@@ -134,6 +163,15 @@ struct GlobalEventStats
   int maxRank, minRank;
   Event::Clock::duration max   = Event::Clock::duration::min();
   Event::Clock::duration min   = Event::Clock::duration::max();
+
+  /// Average of the total durations of all ranks that recorded the event
+  Event::Clock::duration avgTotal = Event::Clock::duration::zero();
+
+  /// Median of the total durations of all ranks that recorded the event
+  Event::Clock::duration p50Total = Event::Clock::duration::zero();
+
+  /// 95th percentile of the total durations of all ranks that recorded the event
+  Event::Clock::duration p95Total = Event::Clock::duration::zero();
 };
 
 
@@ -176,6 +214,21 @@ public:
   /// Make this returning a reference or smart ptr?
   Event & getStoredEvent(std::string const & name);
 
+  /// Returns the ID of a name without prefix, registers the name if required.
+  int getNameID(std::string const & name);
+
+  /// Returns the ID of the event with the given name ID and the current prefix, registers the event if required.
+  int getEventID(int nameID);
+
+  /// Returns the name of an event, including the prefix.
+  const std::string & getEventName(int eventID) const;
+
+  /// Sets the currently active prefix, which applies to newly created events.
+  void setPrefix(std::string const & newPrefix);
+
+  /// Returns the currently active prefix.
+  const std::string & getPrefix() const;
+
   /// Returns the timestamp of the run, i.e. when the run finished
   std::chrono::system_clock::time_point getTimestamp();
   
@@ -195,27 +248,66 @@ public:
   void writeCSV(std::string filename);
 
   void writeEventLogs(std::string filename);
+
+  /// Writes the state changes of all collected events in the Chrome Trace Event format.
+  /** Every period between a start and a pause or stop of an event is a slice on the track of its rank,
+  such that events started within the scope of a prefix appear nested into the event of the prefix. The
+  file can be opened with chrome://tracing or Perfetto. Only written on rank 0. In CollectMode::REDUCE,
+  the state changes of other ranks are not collected, such that the file only holds the track of rank 0. */
+  void writeChromeTrace(std::string filename);
   
   void printGlobalStats();
 
-  /// Currently active prefix. Changing that applies to newly created events.
-  std::string prefix;
-  
+  /// Returns the statistics over all ranks per event name, only available on rank 0 after finalize.
+  const std::map<std::string, GlobalEventStats> & getGlobalStats() const;
+
   /// A name that is added to the logfile to identify a run
   std::string runName;
 
+  /// Maximum number of state changes kept per event. Older state changes are dropped.
+  size_t maxStateChanges = 10000;
+
+  /// How event data of all ranks is collected on rank 0 in finalize.
+  enum class CollectMode {
+    /// Sends the data and state changes of every event of every rank to rank 0.
+    GATHER,
+    /// Only reduces statistics per event, percentiles are estimated from histograms.
+    REDUCE
+  };
+
+  CollectMode collectMode = CollectMode::GATHER;
+
+  /// Writes the state changes of all ranks in parallel to a binary trace file in finalize.
+  /** The file holds one block per rank: rank and number of events (int32), then per event
+  the length of the name (int32), the name, the number of state changes (int64), and per
+  state change the state (int32) and the time since epoch of Event::Clock in ns (int64). */
+  bool writeTrace = false;
+
+  /// Writes the collected state changes to a Chrome Trace Event file in printAll.
+  bool chromeTrace = false;
+
 private:
   /// Private, empty constructor for singleton pattern
-  EventRegistry()
-    : globalEvent("_GLOBAL", true, false) // Unstarted, it's started in initialize
-  {}
+  EventRegistry();
   
-  /// Gather EventData from all ranks on rank 0.
+  /// Collects EventData from all ranks on rank 0, as defined by collectMode.
   void collect();
+
+  /// Gather EventData from all ranks on rank 0.
+  void gatherEvents();
+
+  /// Reduces statistics of all events on rank 0, using IDs of a common list of names.
+  void reduceEvents();
+
+  /// Writes the state changes of all ranks to a binary trace file with MPI-IO.
+  void writeTraceFile(std::string const & filename);
   
   /// Returns length of longest name
   size_t getMaxNameWidth();
 
+  /// Returns all events recorded on this rank, sorted by name.
+  std::vector<const EventData*> getRecordedEvents() const;
+
   /// Event for measuring global time, also acts as a barrier
   Event globalEvent;
   
@@ -224,14 +316,35 @@ private:
   /// Timestamp when the run finished
   std::chrono::system_clock::time_point timestamp;
 
-  /// Map of name -> events for this rank only
-  std::map<std::string, EventData> events;
+  /// Currently active prefix
+  std::string prefix;
+
+  /// Name ID of the currently active prefix
+  int prefixID = -1;
+
+  /// Registered names without prefix, indexed by name ID
+  std::vector<std::string> names;
+
+  /// Map of name -> name ID
+  std::unordered_map<std::string, int> nameIDs;
+
+  /// Map of prefix ID and name ID -> event ID
+  std::unordered_map<long long, int> eventIDs;
+
+  /// Map of prefixed name -> event ID
+  std::unordered_map<std::string, int> eventIDsByName;
+
+  /// Events for this rank only, indexed by event ID
+  std::vector<EventData> events;
 
   std::map<std::string, Event> storedEvents;
 
   /// Multimap of name -> EventData of events for all ranks
   GlobalEvents globalEvents;
 
+  /// Statistics over all ranks per event name
+  std::map<std::string, GlobalEventStats> globalStats;
+
   /// A name that is added to the logfile to distinguish different participants
   std::string applicationName;
 };
@@ -244,13 +357,13 @@ public:
   
   ScopedEventPrefix(const std::string & name)
   {
-    previousName = EventRegistry::instance().prefix;
-    EventRegistry::instance().prefix += name;
+    previousName = EventRegistry::instance().getPrefix();
+    EventRegistry::instance().setPrefix(previousName + name);
   }
 
   ~ScopedEventPrefix()
   {
-    EventRegistry::instance().prefix = previousName;
+    EventRegistry::instance().setPrefix(previousName);
   }
   
 private:
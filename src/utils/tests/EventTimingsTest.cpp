@@ -0,0 +1,115 @@
+#include <fstream>
+#include <iterator>
+#include "testing/Testing.hpp"
+#include "utils/EventTimings.hpp"
+#include "utils/Parallel.hpp"
+
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(EventTimingsTests)
+
+/// Runs the test on a cleared and initialized registry, such that it may finalize the registry.
+struct EventRegistryFixture {
+  EventRegistryFixture()
+  {
+    EventRegistry::instance().clear();
+    EventRegistry::instance().initialize("EventTimingsTest");
+  }
+
+  ~EventRegistryFixture()
+  {
+    EventRegistry::instance().clear();
+  }
+};
+
+BOOST_AUTO_TEST_CASE(EventNames)
+{
+  auto & registry = EventRegistry::instance();
+  EventName name("EventTimingsTest.named");
+  BOOST_TEST(registry.getNameID("EventTimingsTest.named") == name.id);
+
+  int eventID = -1;
+  {
+    ScopedEventPrefix prefix("EventTimingsTest/");
+    Event e(name);
+    eventID = e.id;
+    BOOST_TEST(e.getName() == "EventTimingsTest/EventTimingsTest.named");
+
+    Event sameEvent("EventTimingsTest.named");
+    BOOST_TEST(sameEvent.id == eventID);
+  }
+  Event unprefixedEvent(name);
+  BOOST_TEST(unprefixedEvent.id != eventID);
+  BOOST_TEST(unprefixedEvent.getName() == "EventTimingsTest.named");
+}
+
+BOOST_AUTO_TEST_CASE(BoundedStateChanges)
+{
+  auto & registry = EventRegistry::instance();
+  size_t previousMaxStateChanges = registry.maxStateChanges;
+  registry.maxStateChanges = 10;
+
+  Event e("EventTimingsTest.bounded", false, false);
+  for (int i = 0; i < 100; i++) {
+    e.start();
+    e.pause();
+  }
+  BOOST_TEST(e.stateChanges.size() >= registry.maxStateChanges);
+  BOOST_TEST(e.stateChanges.size() < 2 * registry.maxStateChanges);
+  // The latest state changes are kept
+  BOOST_TEST(static_cast<int>(std::get<0>(e.stateChanges.back())) == static_cast<int>(Event::State::PAUSED));
+  e.stop();
+
+  registry.maxStateChanges = previousMaxStateChanges;
+}
+
+BOOST_FIXTURE_TEST_CASE(ReducedStatistics, EventRegistryFixture, *precice::testing::OnSize(4))
+{
+  using std::chrono::milliseconds;
+  auto & registry = EventRegistry::instance();
+  registry.collectMode = EventRegistry::CollectMode::REDUCE;
+
+  int rank = Parallel::getProcessRank();
+  Event e("EventTimingsTest.reduced", milliseconds(10 * (rank + 1)));
+  if (rank == 2) {
+    Event onlyOnRank2("EventTimingsTest.reducedRank2", milliseconds(5));
+  }
+  registry.finalize();
+
+  if (rank == 0) {
+    auto & stats = registry.getGlobalStats().at("EventTimingsTest.reduced");
+    BOOST_TEST(std::chrono::duration_cast<milliseconds>(stats.max).count() == 40);
+    BOOST_TEST(stats.maxRank == 3);
+    BOOST_TEST(std::chrono::duration_cast<milliseconds>(stats.min).count() == 10);
+    BOOST_TEST(stats.minRank == 0);
+    BOOST_TEST(std::chrono::duration_cast<milliseconds>(stats.avgTotal).count() == 25);
+    // events not recorded on rank 0 are included
+    BOOST_TEST(registry.getGlobalStats().at("EventTimingsTest.reducedRank2").maxRank == 2);
+  }
+  registry.collectMode = EventRegistry::CollectMode::GATHER;
+}
+
+BOOST_FIXTURE_TEST_CASE(ChromeTrace, EventRegistryFixture)
+{
+  auto & registry = EventRegistry::instance();
+  {
+    Event outer("EventTimingsTest.outer");
+    ScopedEventPrefix prefix("EventTimingsTest.outer/");
+    Event inner("inner");
+  }
+  registry.finalize();
+
+  if (Parallel::getProcessRank() == 0) {
+    std::string filename = "utils-EventTimingsTest-ChromeTrace.json";
+    registry.writeChromeTrace(filename);
+    std::ifstream file(filename);
+    std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    BOOST_TEST(content.find("{\"name\": \"EventTimingsTest.outer\", \"ph\": \"X\"") != std::string::npos);
+    BOOST_TEST(content.find("{\"name\": \"EventTimingsTest.outer/inner\", \"ph\": \"X\"") != std::string::npos);
+    BOOST_TEST(content.find("\"args\": {\"name\": \"Rank 0\"}") != std::string::npos);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // EventTimingsTests
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests